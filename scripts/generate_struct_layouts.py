@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""
+Script to generate GameStructLayouts.hpp/.cpp from GameStructs.hpp.
+Emits one entry per struct generated from a named managed type, listing every field with its managed name
+and its offsetof in the C++ struct. StructLayoutValidator compares those against the running game at startup.
+"""
+
+import argparse
+import logging
+import sys
+from pathlib import Path
+from typing import List, Optional, Tuple
+
+from update_game_structs import StructParser, Struct
+
+logging.basicConfig(level=logging.INFO, format='%(levelname)s: %(message)s')
+logger = logging.getLogger(__name__)
+
+HEADER_TEMPLATE = """// Generated by scripts/generate_struct_layouts.py from GameStructs.hpp, do not edit
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Every struct in GameStructs.hpp generated from a named managed type
+enum class GameStructId : uint16_t {{
+{enum_entries}
+    Count
+}};
+
+constexpr size_t GameStructCount = static_cast<size_t>(GameStructId::Count);
+
+struct GameStructField {{
+    const char* name; // Managed field name
+    uint32_t offset;  // offsetof in the C++ struct
+}};
+
+struct GameStructLayout {{
+    const char* structName;
+    const char* nameSpace;
+    const char* className;
+    bool isValueType; // C++ offsets are unboxed, the managed ones include the object header
+    const GameStructField* fields;
+    uint32_t fieldCount;
+}};
+
+// Indexed by GameStructId
+extern const GameStructLayout gameStructLayouts[GameStructCount];
+"""
+
+SOURCE_TEMPLATE = """// Generated by scripts/generate_struct_layouts.py from GameStructs.hpp, do not edit
+#include "GameStructLayouts.hpp"
+#include "GameStructs.hpp"
+
+{field_arrays}
+
+const GameStructLayout gameStructLayouts[GameStructCount] = {{
+{layout_entries}
+}};
+"""
+
+
+def managed_type_name(struct: Struct) -> Optional[Tuple[str, str]]:
+    """Namespace and class name from the generation comment, None for nested types the dump doesn't qualify."""
+    full_name = struct.generation_comment.replace("// Generated from ", "").strip()
+    if not full_name or full_name.startswith("."):
+        return None
+    namespace, _, class_name = full_name.rpartition(".")
+    return namespace, class_name
+
+
+def managed_field_name(member_name: str) -> str:
+    """Undo MonoAPI's CleanupFieldName, which shortens <name>k__BackingField to name_backing."""
+    if member_name.endswith("_backing"):
+        return f"<{member_name[:-len('_backing')]}>k__BackingField"
+    return member_name
+
+
+def layout_fields(struct: Struct) -> List[str]:
+    fields = []
+    for member_type, member_name, comment in struct.members:
+        if "Padding" in comment or "padding" in member_name.lower() or "/*" in member_type:
+            continue
+        fields.append(member_name.split("[")[0])
+    return fields
+
+
+def generate(game_structs_path: Path, output_dir: Path):
+    structs = StructParser().parse_file(game_structs_path)
+
+    layouts = []
+    for struct_name, struct in structs.items():
+        managed = managed_type_name(struct) if struct.generation_comment else None
+        if managed is None:
+            continue
+        fields = layout_fields(struct)
+        if not fields:
+            continue
+        layouts.append((struct_name, managed, fields))
+
+    enum_entries = "\n".join(f"    {name}," for name, _, _ in layouts)
+
+    field_arrays = []
+    layout_entries = []
+    for struct_name, (namespace, class_name), fields in layouts:
+        lines = [f"static const GameStructField {struct_name}Fields[] = {{"]
+        for field in fields:
+            lines.append(f"    {{\"{managed_field_name(field)}\", offsetof({struct_name}, {field})}},")
+        lines.append("};")
+        field_arrays.append("\n".join(lines))
+
+        is_value_type = "true" if struct_name.endswith("_Value") else "false"
+        layout_entries.append(f"    {{\"{struct_name}\", \"{namespace}\", \"{class_name}\", {is_value_type}, {struct_name}Fields, "
+                              f"static_cast<uint32_t>(sizeof({struct_name}Fields) / sizeof(GameStructField))}},")
+
+    header_path = output_dir / "GameStructLayouts.hpp"
+    source_path = output_dir / "GameStructLayouts.cpp"
+    header_path.write_text(HEADER_TEMPLATE.format(enum_entries=enum_entries), encoding="utf-8")
+    source_path.write_text(SOURCE_TEMPLATE.format(field_arrays="\n\n".join(field_arrays), layout_entries="\n".join(layout_entries)), encoding="utf-8")
+
+    logger.info(f"Wrote {len(layouts)} struct layouts to {header_path} and {source_path}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate GameStructLayouts from GameStructs.hpp")
+    parser.add_argument(
+        "--game-structs-path",
+        type=Path,
+        default=Path(__file__).parent.parent / "src/game/GameStructs.hpp",
+        help="Path to GameStructs.hpp file"
+    )
+    args = parser.parse_args()
+
+    if not args.game_structs_path.exists():
+        logger.error(f"{args.game_structs_path} not found")
+        sys.exit(1)
+
+    generate(args.game_structs_path, args.game_structs_path.parent)
+
+
+if __name__ == "__main__":
+    main()
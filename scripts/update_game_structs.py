@@ -455,5 +455,10 @@ def main():
     updater = StructUpdater(game_dump_path, args.game_structs_path)
     updater.update_file(args.dry_run)
 
+    if not args.dry_run:
+        # Keep the startup layout check in sync with the structs it validates
+        from generate_struct_layouts import generate
+        generate(args.game_structs_path, args.game_structs_path.parent)
+
 if __name__ == "__main__":
     main()
@@ -0,0 +1,131 @@
+#pragma once
+#include "core/MonoRuntime.hpp"
+#include "utils/Logger.hpp"
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+// Typed access to one managed field through its raw location. The offset, and for static fields the class's static data block,
+// is resolved once and checked against sizeof(T); after that each Get or Set is a single load or store. Fields without a fixed
+// slot (thread statics, runtimes without mono_vtable_get_static_field_data) go through mono_field_*_value instead.
+// A field whose managed size doesn't match T is reported once and reads as T(). Object references are read directly but always
+// stored through mono_field_*_set_value: Unity's incremental Boehm collector relies on Mono's write barrier to see the new reference.
+template <typename T> class MonoFieldAccessor {
+    static_assert(std::is_trivially_copyable_v<T>, "MonoFieldAccessor copies fields as raw memory");
+
+  private:
+    enum class Mode : uint8_t { Unusable, Direct, Slow };
+
+    // Resolved location of the field. Layouts are immutable once published, a new field generation gets a new one
+    // and the old ones stay alive with the accessor, so a reader on another thread never sees one half-written.
+    struct Layout {
+        uint32_t generation; // Field generation the layout was resolved for
+        Mode mode;
+        int32_t offset;
+        uint8_t* staticData;
+        MonoClass* klass;
+    };
+
+    MonoFieldRef m_field;
+    bool m_isStatic;
+    std::atomic<const Layout*> m_layout{nullptr};
+    std::mutex m_layoutMutex; // Serializes building layouts
+    std::vector<std::unique_ptr<Layout>> m_layouts;
+
+    // Layout for the resolved field, nullptr if the field can't be found
+    const Layout* Prepare(MonoRuntime* runtime, MonoField*& field) {
+        field = runtime->Resolve(m_field);
+        if (!field)
+            return nullptr;
+
+        uint32_t generation = m_field.generation.load(std::memory_order_acquire);
+        const Layout* current = m_layout.load(std::memory_order_acquire);
+        if (current && current->generation == generation)
+            return current;
+
+        std::lock_guard<std::mutex> lock(m_layoutMutex);
+        current = m_layout.load(std::memory_order_relaxed);
+        if (current && current->generation == generation)
+            return current;
+
+        auto layout = std::make_unique<Layout>(Layout{generation, Mode::Unusable, 0, nullptr, nullptr});
+        layout->klass = runtime->GetClass(m_field.assemblyName, m_field.nameSpace, m_field.className);
+        if (layout->klass) {
+            MonoFieldLayout fieldLayout{};
+            bool direct = runtime->GetFieldLayout(layout->klass, field, m_isStatic, fieldLayout);
+            if (fieldLayout.size != static_cast<int32_t>(sizeof(T))) {
+                LOG_ERROR("%s.%s is %d bytes but its accessor reads %zu", m_field.className, m_field.memberName, fieldLayout.size, sizeof(T));
+            } else if (direct) {
+                layout->mode = Mode::Direct;
+                layout->offset = fieldLayout.offset;
+                layout->staticData = fieldLayout.staticData;
+            } else {
+                LOG_WARNING("%s.%s has no fixed slot, reading it through Mono", m_field.className, m_field.memberName);
+                layout->mode = Mode::Slow;
+            }
+        }
+
+        current = layout.get();
+        m_layouts.push_back(std::move(layout));
+        m_layout.store(current, std::memory_order_release);
+        return current;
+    }
+
+    uint8_t* Address(const Layout* layout, const void* obj) const {
+        if (m_isStatic)
+            return layout->staticData + layout->offset;
+        return static_cast<uint8_t*>(const_cast<void*>(obj)) + layout->offset;
+    }
+
+  public:
+    MonoFieldAccessor(const char* assemblyName, const char* nameSpace, const char* className, const char* fieldName, bool isStatic)
+        : m_field{assemblyName, nameSpace, className, fieldName}, m_isStatic(isStatic) {}
+
+    // obj is ignored for static fields
+    T Get(MonoRuntime* runtime, const void* obj = nullptr) {
+        MonoField* field;
+        const Layout* layout = Prepare(runtime, field);
+        if (!layout || layout->mode == Mode::Unusable || (!m_isStatic && !obj))
+            return T();
+
+        if (layout->mode == Mode::Slow) {
+            return m_isStatic ? runtime->GetStaticFieldValue<T>(layout->klass, field)
+                              : runtime->GetFieldValue<T>(static_cast<MonoObject*>(const_cast<void*>(obj)), field);
+        }
+
+        T value;
+        std::memcpy(&value, Address(layout, obj), sizeof(T));
+        return value;
+    }
+
+    void Set(MonoRuntime* runtime, const T& value, void* obj = nullptr) {
+        MonoField* field;
+        const Layout* layout = Prepare(runtime, field);
+        if (!layout || layout->mode == Mode::Unusable || (!m_isStatic && !obj))
+            return;
+
+        if constexpr (std::is_pointer_v<T>) {
+            // A raw store would skip the write barrier. mono_field_*_set_value take object references by value.
+            void* reference = const_cast<void*>(static_cast<const void*>(value));
+            if (m_isStatic) {
+                runtime->SetStaticFieldReference(layout->klass, field, static_cast<MonoObject*>(reference));
+            } else {
+                runtime->SetFieldValue(static_cast<MonoObject*>(obj), field, reference);
+            }
+            return;
+        } else if (layout->mode == Mode::Slow) {
+            if (m_isStatic) {
+                runtime->SetStaticFieldValue<T>(layout->klass, field, value);
+            } else {
+                T localValue = value;
+                runtime->SetFieldValue(static_cast<MonoObject*>(obj), field, &localValue);
+            }
+            return;
+        }
+
+        std::memcpy(Address(layout, obj), &value, sizeof(T));
+    }
+};
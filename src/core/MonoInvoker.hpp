@@ -0,0 +1,115 @@
+#pragma once
+#include "core/MonoRuntime.hpp"
+#include "utils/Logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <initializer_list>
+#include <type_traits>
+
+// Types passed to and from managed code unchanged by the unmanaged thunk: primitives, enums and object references
+template <typename T> constexpr bool IsMonoDirectType = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>;
+
+template <typename Signature> class MonoInvoker;
+
+// Typed call into a managed method through its unmanaged thunk (mono_method_get_unmanaged_thunk), which is a plain native
+// function taking the arguments followed by an exception out-pointer. Instance methods take the object as the first argument.
+// Signatures with non-direct types, or runtimes without thunk support, fall back to mono_runtime_invoke with the same arguments.
+template <typename Ret, typename... Args> class MonoInvoker<Ret(Args...)> {
+  private:
+    static constexpr bool DirectCallable = (IsMonoDirectType<Args> && ...) && (std::is_void_v<Ret> || IsMonoDirectType<Ret>);
+
+    using Thunk = Ret(__stdcall*)(Args..., MonoObject** exception);
+
+    MonoMethodRef m_method;
+    bool m_isInstance;
+    const char* m_paramTypes[sizeof...(Args) + 1] = {}; // Managed parameter type names, m_method.paramTypes points here
+    // Published like MonoRef: thunk first, then the method generation it was built for (release)
+    std::atomic<Thunk> m_thunk{nullptr};
+    std::atomic<uint32_t> m_thunkGeneration{0};
+
+    template <typename T> static void* ArgPointer(T& value) {
+        if constexpr (std::is_pointer_v<T>) {
+            return const_cast<void*>(static_cast<const void*>(value)); // Object references are passed as-is
+        } else {
+            return &value;
+        }
+    }
+
+    Ret InvokeReflective(MonoRuntime* runtime, MonoMethod* method, Args... args) {
+        void* params[sizeof...(Args) + 1] = {ArgPointer(args)..., nullptr};
+        void* self = m_isInstance ? params[0] : nullptr;
+        MonoObject* result = runtime->InvokeMethod(method, self, m_isInstance ? params + 1 : params);
+
+        if constexpr (std::is_void_v<Ret>) {
+            return;
+        } else if constexpr (std::is_pointer_v<Ret>) {
+            return reinterpret_cast<Ret>(result);
+        } else {
+            void* unboxed = result ? runtime->UnboxObject(result) : nullptr;
+            return unboxed ? *static_cast<Ret*>(unboxed) : Ret();
+        }
+    }
+
+  public:
+    MonoInvoker(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, bool isInstance)
+        : m_method{assemblyName, nameSpace, className, methodName, static_cast<int>(sizeof...(Args)) - (isInstance ? 1 : 0)}, m_isInstance(isInstance) {}
+
+    // Picks the overload with this managed signature, for methods whose overloads share a parameter count. Type names are spelled
+    // as mono_type_get_name reports them, like in the hook table: "System.Void", "System.Int32", "RoR2.ItemIndex".
+    MonoInvoker(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, bool isInstance, const char* returnType,
+                std::initializer_list<const char*> paramTypes)
+        : MonoInvoker(assemblyName, nameSpace, className, methodName, isInstance) {
+        if (paramTypes.size() != static_cast<size_t>(m_method.paramCount)) {
+            LOG_ERROR("%s.%s invoker lists %zu parameter types for %d parameters", className, methodName, paramTypes.size(), m_method.paramCount);
+            return;
+        }
+        std::copy(paramTypes.begin(), paramTypes.end(), m_paramTypes);
+        m_method.returnType = returnType;
+        m_method.paramTypes = m_paramTypes;
+    }
+
+    // Returns a default-constructed Ret if the method can't be found or throws
+    Ret Invoke(MonoRuntime* runtime, Args... args) {
+        // Resolve and the thunk skip the runtime's entry points once cached, so the calling thread is attached here
+        if (!runtime->AttachThread())
+            return Ret();
+
+        MonoMethod* method = runtime->Resolve(m_method);
+        if (!method) {
+            LOG_ERROR("Failed to find %s.%s method", m_method.className, m_method.memberName);
+            return Ret();
+        }
+
+        if constexpr (DirectCallable) {
+            uint32_t generation = m_method.generation.load(std::memory_order_acquire);
+            Thunk thunk;
+            if (m_thunkGeneration.load(std::memory_order_acquire) == generation) {
+                thunk = m_thunk.load(std::memory_order_relaxed);
+            } else {
+                thunk = reinterpret_cast<Thunk>(runtime->GetUnmanagedThunk(method));
+                m_thunk.store(thunk, std::memory_order_relaxed);
+                m_thunkGeneration.store(generation, std::memory_order_release);
+            }
+
+            if (thunk) {
+                MonoObject* exception = nullptr;
+                if constexpr (std::is_void_v<Ret>) {
+                    thunk(args..., &exception);
+                    if (exception) {
+                        LOG_ERROR("Exception occurred during %s.%s thunk call", m_method.className, m_method.memberName);
+                    }
+                    return;
+                } else {
+                    Ret result = thunk(args..., &exception);
+                    if (exception) {
+                        LOG_ERROR("Exception occurred during %s.%s thunk call", m_method.className, m_method.memberName);
+                        return Ret();
+                    }
+                    return result;
+                }
+            }
+        }
+
+        return InvokeReflective(runtime, method, args...);
+    }
+};
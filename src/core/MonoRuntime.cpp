@@ -1,14 +1,42 @@
 #include "MonoRuntime.hpp"
 #include "globals/globals.hpp"
+#include "utils/Utf16.hpp"
 #include <chrono>
 #include <stdio.h>
 #include <vector>
 
-MonoRuntime::MonoRuntime() : m_rootDomain(nullptr), m_thread(nullptr) {}
+// Runtime whose attachments are still valid, cleared on destruction so late thread exits don't touch a dead runtime
+static std::atomic<MonoRuntime*> s_liveRuntime{nullptr};
 
-MonoRuntime::~MonoRuntime() { DetachThread(); }
+// Per-thread attachment state, its destructor detaches the thread when it exits
+struct MonoThreadState {
+    MonoRuntime* runtime = nullptr; // Runtime the thread went through AttachThread for
 
-std::string MonoRuntime::MakeClassCacheKey(const char* nameSpace, const char* className) { return std::string(nameSpace) + "::" + className; }
+    ~MonoThreadState() {
+        if (runtime && runtime == s_liveRuntime.load(std::memory_order_acquire)) {
+            runtime->DetachThread();
+        }
+    }
+};
+static thread_local MonoThreadState t_threadState;
+
+MonoRuntime::MonoRuntime() : m_mono_method_get_unmanaged_thunk(nullptr), m_mono_vtable_get_static_field_data(nullptr), m_rootDomain(nullptr) {}
+
+MonoRuntime::~MonoRuntime() {
+    MonoRuntime* expected = this;
+    s_liveRuntime.compare_exchange_strong(expected, nullptr);
+
+    ReleaseConstantStrings();
+    DetachThread();
+
+    // Other threads can only be detached from themselves, Mono cleans up their attachment when they exit
+    std::lock_guard<std::mutex> lock(m_threadsMutex);
+    if (!m_attachedThreads.empty()) {
+        LOG_WARNING("MonoRuntime: %zu threads still attached at unload", m_attachedThreads.size());
+    }
+}
+
+const char* MonoRuntime::InternLocked(std::string_view name) { return m_internedNames.emplace(name).first->c_str(); }
 
 void __cdecl MonoRuntime::AssemblyIterationCallback(MonoAssembly* assembly, void* user_data) {
     auto* self = static_cast<MonoRuntime*>(user_data);
@@ -44,7 +72,10 @@ void __cdecl MonoRuntime::AssemblyIterationCallback(MonoAssembly* assembly, void
         return;
     }
 
-    self->m_imageCache[imageName] = image;
+    {
+        std::unique_lock<std::shared_mutex> lock(self->m_imageCacheMutex);
+        self->m_imageCache[imageName] = image;
+    }
 
     LOG_INFO("Found assembly: %s (assembly=%p, image=%p)", imageName, assembly, image);
 }
@@ -68,9 +99,11 @@ bool MonoRuntime::Initialize(const char* monoDllName) {
     }
 
     GET_MONO_FUNC(mono_get_root_domain);
+    GET_MONO_FUNC(mono_domain_get);
     GET_MONO_FUNC(mono_domain_assembly_foreach);
     GET_MONO_FUNC(mono_assembly_get_image);
     GET_MONO_FUNC(mono_image_get_name);
+    GET_MONO_FUNC(mono_image_get_filename);
     GET_MONO_FUNC(mono_class_from_name);
     GET_MONO_FUNC(mono_class_get_method_from_name);
     GET_MONO_FUNC(mono_runtime_invoke);
@@ -113,6 +146,21 @@ bool MonoRuntime::Initialize(const char* monoDllName) {
     GET_MONO_FUNC(mono_assembly_load_from_full);
     GET_MONO_FUNC(mono_image_close);
     GET_MONO_FUNC(mono_assembly_close);
+    GET_MONO_FUNC(mono_gchandle_new);
+    GET_MONO_FUNC(mono_gchandle_free);
+    GET_MONO_FUNC(mono_field_get_type);
+    GET_MONO_FUNC(mono_type_size);
+
+    m_mono_method_get_unmanaged_thunk =
+        reinterpret_cast<mono_method_get_unmanaged_thunk_t>(GetProcAddress(monoModule, "mono_method_get_unmanaged_thunk"));
+    m_mono_vtable_get_static_field_data =
+        reinterpret_cast<mono_vtable_get_static_field_data_t>(GetProcAddress(monoModule, "mono_vtable_get_static_field_data"));
+    if (!m_mono_vtable_get_static_field_data) {
+        LOG_WARNING("mono_vtable_get_static_field_data not exported, static field accessors will use mono_field_static_get_value");
+    }
+    if (!m_mono_method_get_unmanaged_thunk) {
+        LOG_WARNING("mono_method_get_unmanaged_thunk not exported, typed invokers will use mono_runtime_invoke");
+    }
 
     // Get the root domain
     m_rootDomain = m_mono_get_root_domain();
@@ -122,6 +170,7 @@ bool MonoRuntime::Initialize(const char* monoDllName) {
     }
 
     LOG_INFO("Root domain: 0x%p", m_rootDomain);
+    s_liveRuntime.store(this, std::memory_order_release);
 
     // Attach the current thread to the Mono runtime
     if (!AttachThread()) {
@@ -139,7 +188,7 @@ bool MonoRuntime::Initialize(const char* monoDllName) {
 
 bool MonoRuntime::AttachThread() {
     // Don't attach if already attached
-    if (m_thread) {
+    if (t_threadState.runtime == this) {
         return true;
     }
 
@@ -149,30 +198,64 @@ bool MonoRuntime::AttachThread() {
         return false;
     }
 
+    DWORD threadId = GetCurrentThreadId();
+
+    // Threads Mono already knows (the Unity main thread) are used as they are and left attached
+    if (m_mono_domain_get && m_mono_domain_get()) {
+        t_threadState.runtime = this;
+        LOG_INFO("Thread %lu already managed, using existing Mono attachment", threadId);
+        return true;
+    }
+
     // Attach the current thread to the Mono runtime
-    m_thread = m_mono_thread_attach(m_rootDomain);
-    if (!m_thread) {
-        LOG_INFO("Failed to attach thread to Mono runtime");
+    MonoThread* thread = m_mono_thread_attach(m_rootDomain);
+    if (!thread) {
+        LOG_ERROR("Failed to attach thread %lu to Mono runtime", threadId);
         return false;
     }
 
-    LOG_INFO("Thread attached to Mono runtime: %p", m_thread);
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        m_attachedThreads[threadId] = thread;
+    }
+    t_threadState.runtime = this;
+
+    LOG_INFO("Thread %lu attached to Mono runtime: %p", threadId, thread);
     return true;
 }
 
 void MonoRuntime::DetachThread() {
-    if (m_thread && m_mono_thread_detach) {
-        m_mono_thread_detach(m_thread);
-        m_thread = nullptr;
-        LOG_INFO("Thread detached from Mono runtime");
+    if (t_threadState.runtime != this) {
+        return;
+    }
+    t_threadState.runtime = nullptr;
+
+    DWORD threadId = GetCurrentThreadId();
+    MonoThread* thread = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_threadsMutex);
+        auto it = m_attachedThreads.find(threadId);
+        if (it != m_attachedThreads.end()) {
+            thread = it->second;
+            m_attachedThreads.erase(it);
+        }
+    }
+
+    if (thread && m_mono_thread_detach) {
+        m_mono_thread_detach(thread);
+        LOG_INFO("Thread %lu detached from Mono runtime", threadId);
     }
 }
 
+bool MonoRuntime::IsThreadAttached() const { return t_threadState.runtime == this; }
+
 MonoAssembly* MonoRuntime::LoadAssemblyFromMemory(const char* data, size_t size, const char* name) {
     if (!data || size == 0 || !name) {
         LOG_ERROR("LoadAssemblyFromMemory: Invalid parameters");
         return nullptr;
     }
+    if (!AttachThread())
+        return nullptr;
 
     MonoImageOpenStatus status;
     MonoImage* image = m_mono_image_open_from_data_with_name(const_cast<char*>(data), static_cast<uint32_t>(size), 1, &status, 0, name);
@@ -189,21 +272,24 @@ MonoAssembly* MonoRuntime::LoadAssemblyFromMemory(const char* data, size_t size,
         return nullptr;
     }
 
-    m_imageCache[name] = image;
+    {
+        std::unique_lock<std::shared_mutex> lock(m_imageCacheMutex);
+        m_imageCache[name] = image;
+    }
 
     LOG_INFO("LoadAssemblyFromMemory: Successfully loaded assembly '%s'", name);
     return assembly;
 }
 
 MonoImage* MonoRuntime::GetAssemblyImage(MonoAssembly* assembly) {
-    if (!assembly) {
+    if (!assembly || !AttachThread()) {
         return nullptr;
     }
     return m_mono_assembly_get_image(assembly);
 }
 
 void MonoRuntime::UnloadAssembly(MonoAssembly* assembly) {
-    if (!assembly) {
+    if (!assembly || !AttachThread()) {
         return;
     }
 
@@ -219,20 +305,22 @@ void MonoRuntime::UnloadAssembly(MonoAssembly* assembly) {
     }
 
     if (imageName) {
-        auto it = m_imageCache.find(imageName);
-        if (it != m_imageCache.end()) {
-            m_imageCache.erase(it);
-            LOG_INFO("MonoRuntime: Removed '%s' from image cache", imageName);
+        {
+            std::unique_lock<std::shared_mutex> lock(m_imageCacheMutex);
+            auto it = m_imageCache.find(imageName);
+            if (it != m_imageCache.end()) {
+                m_imageCache.erase(it);
+                LOG_INFO("MonoRuntime: Removed '%s' from image cache", imageName);
+            }
         }
 
-        for (auto it = m_classCache.begin(); it != m_classCache.end();) {
-            it = m_classCache.erase(it);
-        }
-        LOG_INFO("MonoRuntime: Cleared class cache after assembly unload");
+        InvalidateCaches();
+        LOG_INFO("MonoRuntime: Cleared class and member caches after assembly unload");
     }
 }
 
 MonoImage* MonoRuntime::GetImage(const char* assemblyName) {
+    std::shared_lock<std::shared_mutex> lock(m_imageCacheMutex);
     auto it = m_imageCache.find(assemblyName);
     if (it != m_imageCache.end()) {
         return it->second;
@@ -240,14 +328,33 @@ MonoImage* MonoRuntime::GetImage(const char* assemblyName) {
     return nullptr;
 }
 
+const char* MonoRuntime::GetImageFileName(const char* assemblyName) {
+    if (!AttachThread())
+        return nullptr;
+
+    MonoImage* image = GetImage(assemblyName);
+    if (!image)
+        return nullptr;
+    return m_mono_image_get_filename(image);
+}
+
 MonoClass* MonoRuntime::GetClass(const char* assemblyName, const char* nameSpace, const char* className) {
-    // Check cache first
-    std::string cacheKey = MakeClassCacheKey(nameSpace, className);
-    auto it = m_classCache.find(cacheKey);
-    if (it != m_classCache.end()) {
-        return it->second;
+    if (!AttachThread() || !assemblyName || !nameSpace || !className)
+        return nullptr;
+
+    // Check cache first, keyed by assembly too since class names are not unique across assemblies
+    MonoClassKey cacheKey;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        cacheKey = {InternLocked(assemblyName), InternLocked(nameSpace), InternLocked(className)};
+        auto it = m_classCache.find(cacheKey);
+        if (it != m_classCache.end()) {
+            return it->second;
+        }
     }
 
+    MonoClass* klass = nullptr;
+
     // Check if this is a nested class (contains +)
     std::string classNameStr(className);
     size_t plusPos = classNameStr.find('+');
@@ -263,38 +370,84 @@ MonoClass* MonoRuntime::GetClass(const char* assemblyName, const char* nameSpace
             void* iter = nullptr;
             MonoClass* nestedClass = nullptr;
             while ((nestedClass = m_mono_class_get_nested_types(parentClass, &iter))) {
-                if (nestedClass) {
-                    const char* nestedName = m_mono_class_get_name(nestedClass);
-                    if (nestedName && strcmp(nestedName, nestedClassName.c_str()) == 0) {
-                        // Add to cache and return
-                        m_classCache[cacheKey] = nestedClass;
-                        return nestedClass;
-                    }
+                const char* nestedName = m_mono_class_get_name(nestedClass);
+                if (nestedName && strcmp(nestedName, nestedClassName.c_str()) == 0) {
+                    klass = nestedClass;
+                    break;
                 }
             }
         }
-        return nullptr;
-    }
+    } else {
+        // Find the class normally
+        MonoImage* image = GetImage(assemblyName);
+        if (!image) {
+            LOG_ERROR("Failed to find assembly: %s", assemblyName);
+            return nullptr;
+        }
 
-    // Find the class normally
-    MonoImage* image = GetImage(assemblyName);
-    if (!image) {
-        LOG_ERROR("Failed to find assembly: %s", assemblyName);
-        return nullptr;
+        klass = m_mono_class_from_name(image, nameSpace, className);
     }
 
-    MonoClass* klass = m_mono_class_from_name(image, nameSpace, className);
     if (klass) {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
         m_classCache[cacheKey] = klass;
     }
 
     return klass;
 }
 
+void* MonoRuntime::GetMember(MonoClass* klass, const char* memberName, int paramCount, MonoMemberKind kind) {
+    if (!AttachThread() || !klass || !memberName)
+        return nullptr;
+
+    MonoMemberKey cacheKey;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        cacheKey = {klass, InternLocked(memberName), paramCount, kind};
+        auto it = m_memberCache.find(cacheKey);
+        if (it != m_memberCache.end()) {
+            return it->second;
+        }
+    }
+
+    void* member = nullptr;
+    switch (kind) {
+    case MonoMemberKind::Method:
+        member = m_mono_class_get_method_from_name(klass, memberName, paramCount);
+        break;
+    case MonoMemberKind::Field:
+        member = m_mono_class_get_field_from_name(klass, memberName);
+        break;
+    case MonoMemberKind::Property:
+        if (m_mono_class_get_property_from_name) {
+            member = m_mono_class_get_property_from_name(klass, memberName);
+        }
+        break;
+    }
+
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_memberCache.emplace(cacheKey, member);
+    return member;
+}
+
 MonoMethod* MonoRuntime::GetMethod(MonoClass* klass, const char* methodName, int paramCount) {
-    if (!AttachThread() || !klass)
+    return static_cast<MonoMethod*>(GetMember(klass, methodName, paramCount, MonoMemberKind::Method));
+}
+
+MonoMethod* MonoRuntime::GetMethod(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount) {
+    return GetMethod(GetClass(assemblyName, nameSpace, className), methodName, paramCount);
+}
+
+MonoMethod* MonoRuntime::GetMethod(MonoClass* klass, const char* methodName, int paramCount, const char* returnType, const char* const* paramTypes) {
+    if (!klass || !methodName)
         return nullptr;
-    return m_mono_class_get_method_from_name(klass, methodName, paramCount);
+
+    for (MonoMethod* method : GetMethods(klass)) {
+        if (strcmp(m_mono_method_get_name(method), methodName) == 0 && MethodMatchesSignature(method, paramCount, returnType, paramTypes)) {
+            return method;
+        }
+    }
+    return nullptr;
 }
 
 LPVOID MonoRuntime::GetMethodAddress(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount) {
@@ -307,50 +460,62 @@ LPVOID MonoRuntime::GetMethodAddress(const char* assemblyName, const char* nameS
 
 LPVOID MonoRuntime::GetMethodAddress(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount,
                                      const char* returnType, const char** paramTypes) {
-    void* targetAddress = nullptr;
-    void* iter = nullptr;
-    MonoMethod* method = nullptr;
-
     MonoClass* klass = GetClass(assemblyName, nameSpace, className);
     if (!klass) {
         return nullptr;
     }
 
+    MonoMethod* method = GetMethod(klass, methodName, paramCount, returnType, paramTypes);
+    return method ? CompileMethod(method) : nullptr;
+}
+
+std::vector<MonoMethod*> MonoRuntime::GetMethods(MonoClass* klass) {
+    std::vector<MonoMethod*> methods;
+    if (!AttachThread() || !klass)
+        return methods;
+
+    void* iter = nullptr;
+    MonoMethod* method = nullptr;
     while ((method = m_mono_class_get_methods(klass, &iter))) {
-        const char* name = m_mono_method_get_name(method);
+        methods.push_back(method);
+    }
+    return methods;
+}
 
-        if (strcmp(name, methodName) == 0) {
-            MonoMethodSignature* sig = m_mono_method_signature(method);
+const char* MonoRuntime::GetMethodName(MonoMethod* method) { return method ? m_mono_method_get_name(method) : nullptr; }
 
-            // Check parameter count
-            if (m_mono_signature_get_param_count(sig) == paramCount) {
-                bool match = true;
+bool MonoRuntime::MethodMatchesSignature(MonoMethod* method, int paramCount, const char* returnType, const char* const* paramTypes) {
+    if (!AttachThread() || !method)
+        return false;
 
-                // Check return type
-                MonoType* retType = m_mono_signature_get_return_type(sig);
-                if (strcmp(m_mono_type_get_name(retType), returnType) != 0) {
-                    match = false;
-                }
+    MonoMethodSignature* sig = m_mono_method_signature(method);
+    if (!sig || m_mono_signature_get_param_count(sig) != paramCount)
+        return false;
 
-                // Check parameter types
-                void* paramIter = nullptr;
-                for (int i = 0; i < paramCount; i++) {
-                    MonoType* paramType = m_mono_signature_get_params(sig, &paramIter);
-                    if (strcmp(m_mono_type_get_name(paramType), paramTypes[i]) != 0) {
-                        match = false;
-                        break;
-                    }
-                }
+    // mono_type_get_name allocates, so every name is freed once compared
+    auto typeNameIs = [this](MonoType* type, const char* expected) {
+        const char* name = m_mono_type_get_name(type);
+        bool equal = name && strcmp(name, expected) == 0;
+        if (name && m_mono_free)
+            m_mono_free(const_cast<char*>(name));
+        return equal;
+    };
 
-                // If we found the correct method
-                if (match) {
-                    targetAddress = m_mono_compile_method(method);
-                    break;
-                }
-            }
-        }
+    if (!typeNameIs(m_mono_signature_get_return_type(sig), returnType))
+        return false;
+
+    void* paramIter = nullptr;
+    for (int i = 0; i < paramCount; i++) {
+        if (!typeNameIs(m_mono_signature_get_params(sig, &paramIter), paramTypes[i]))
+            return false;
     }
-    return targetAddress;
+    return true;
+}
+
+LPVOID MonoRuntime::CompileMethod(MonoMethod* method) {
+    if (!AttachThread() || !method)
+        return nullptr;
+    return m_mono_compile_method(method);
 }
 
 MonoObject* MonoRuntime::InvokeMethod(MonoMethod* method, void* obj, void** params) {
@@ -370,35 +535,80 @@ MonoObject* MonoRuntime::InvokeMethod(MonoMethod* method, void* obj, void** para
     return result;
 }
 
+void* MonoRuntime::GetUnmanagedThunk(MonoMethod* method) {
+    if (!AttachThread() || !method || !m_mono_method_get_unmanaged_thunk)
+        return nullptr;
+    return m_mono_method_get_unmanaged_thunk(method);
+}
+
 MonoField* MonoRuntime::GetField(MonoClass* klass, const char* fieldName) {
-    if (!AttachThread() || !klass)
+    return static_cast<MonoField*>(GetMember(klass, fieldName, -1, MonoMemberKind::Field));
+}
+
+MonoField* MonoRuntime::GetField(const char* assemblyName, const char* nameSpace, const char* className, const char* fieldName) {
+    return GetField(GetClass(assemblyName, nameSpace, className), fieldName);
+}
+
+MonoString* MonoRuntime::CreateString(const char* text) {
+    if (!AttachThread())
         return nullptr;
-    return m_mono_class_get_field_from_name(klass, fieldName);
+    return m_mono_string_new(m_rootDomain, text);
 }
 
-MonoString* MonoRuntime::CreateString(const char* text) { return m_mono_string_new(m_rootDomain, text); }
+MonoString* MonoRuntime::GetConstantString(std::string_view text) {
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        auto it = m_constantStrings.find(text);
+        if (it != m_constantStrings.end()) {
+            return it->second.string;
+        }
+    }
 
-std::string MonoRuntime::StringToUtf8(MonoString* monoString) {
-    if (!AttachThread() || !monoString)
-        return "";
+    std::string terminated(text);
+    MonoString* string = CreateString(terminated.c_str());
+    if (!string)
+        return nullptr;
 
-    char* utf8 = m_mono_string_to_utf8(monoString);
-    if (!utf8)
-        return "";
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto it = m_constantStrings.find(text);
+    if (it != m_constantStrings.end()) {
+        return it->second.string; // Another thread created it meanwhile, ours is left to the GC
+    }
 
-    std::string result(utf8);
+    uint32_t gcHandle = m_mono_gchandle_new(static_cast<MonoObject*>(string), 1);
+    m_constantStrings.emplace(std::string_view(InternLocked(text), text.size()), PooledString{string, gcHandle});
+    return string;
+}
+
+void MonoRuntime::ReleaseConstantStrings() {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    if (m_constantStrings.empty() || !AttachThread())
+        return;
 
-    if (m_mono_free) {
-        m_mono_free(utf8);
+    for (const auto& [text, pooled] : m_constantStrings) {
+        m_mono_gchandle_free(pooled.gcHandle);
     }
+    LOG_INFO("MonoRuntime: Released %zu constant strings", m_constantStrings.size());
+    m_constantStrings.clear();
+}
 
+std::string MonoRuntime::StringToUtf8(MonoString* monoString) {
+    std::string result;
+    StringToUtf8(monoString, result);
     return result;
 }
 
+void MonoRuntime::StringToUtf8(MonoString* monoString, std::string& out) {
+    // Transcoded straight from the string object, no mono_string_to_utf8 allocation and copy
+    Utf16::ToUtf8(MonoStringChars(monoString), out);
+}
+
 MonoProperty* MonoRuntime::GetProperty(MonoClass* klass, const char* propertyName) {
-    if (!AttachThread() || !klass || !m_mono_class_get_property_from_name)
-        return nullptr;
-    return m_mono_class_get_property_from_name(klass, propertyName);
+    return static_cast<MonoProperty*>(GetMember(klass, propertyName, -1, MonoMemberKind::Property));
+}
+
+MonoProperty* MonoRuntime::GetProperty(const char* assemblyName, const char* nameSpace, const char* className, const char* propertyName) {
+    return GetProperty(GetClass(assemblyName, nameSpace, className), propertyName);
 }
 
 MonoMethod* MonoRuntime::GetPropertyGetMethod(MonoProperty* prop) {
@@ -445,6 +655,44 @@ void MonoRuntime::SetFieldValue(MonoObject* obj, MonoField* field, void* value)
     m_mono_field_set_value(obj, field, value);
 }
 
+void MonoRuntime::SetStaticFieldReference(MonoClass* klass, MonoField* field, MonoObject* value) {
+    if (!AttachThread() || !klass || !field)
+        return;
+
+    MonoVTable* vtable = m_mono_class_vtable(m_rootDomain, klass);
+    if (!vtable)
+        return;
+    m_mono_field_static_set_value(vtable, field, value);
+}
+
+bool MonoRuntime::GetFieldLayout(MonoClass* klass, MonoField* field, bool isStatic, MonoFieldLayout& layout) {
+    if (!AttachThread() || !klass || !field)
+        return false;
+
+    int alignment = 0;
+    layout.offset = m_mono_field_get_offset(field);
+    layout.size = m_mono_type_size(m_mono_field_get_type(field), &alignment);
+    layout.staticData = nullptr;
+
+    if (!isStatic)
+        return layout.offset >= static_cast<int32_t>(2 * sizeof(void*)); // Instance fields start after the object header
+
+    // Thread and context statics have no slot in the shared static data
+    if (!m_mono_vtable_get_static_field_data || layout.offset < 0)
+        return false;
+
+    MonoVTable* vtable = m_mono_class_vtable(m_rootDomain, klass);
+    if (!vtable)
+        return false;
+
+    // One read through Mono runs the class constructor if it hasn't run yet, raw reads of the static data would not
+    std::vector<uint8_t> scratch(layout.size > 0 ? layout.size : 1);
+    m_mono_field_static_get_value(vtable, field, scratch.data());
+
+    layout.staticData = static_cast<uint8_t*>(m_mono_vtable_get_static_field_data(vtable));
+    return layout.staticData != nullptr;
+}
+
 MonoObject* MonoRuntime::GetTypeObject(MonoClass* klass) {
     if (!AttachThread() || !klass || !m_mono_class_get_type || !m_mono_type_get_object)
         return nullptr;
@@ -461,3 +709,46 @@ void* MonoRuntime::UnboxObject(MonoObject* obj) {
         return nullptr;
     return m_mono_object_unbox(obj);
 }
+
+template <typename T, MonoRefKind Kind, typename Lookup> T* MonoRuntime::ResolveRef(MonoRef<T, Kind>& ref, Lookup lookup) {
+    uint32_t generation = m_cacheGeneration.load(std::memory_order_acquire);
+    if (ref.generation.load(std::memory_order_acquire) == generation)
+        return ref.handle.load(std::memory_order_relaxed);
+
+    // Misses are not stamped, so a reference to a class from a not yet loaded assembly is retried on the next call.
+    // Threads racing here all look up the same handle, whichever store lands last is as good as any other.
+    T* handle = lookup();
+    if (handle) {
+        ref.handle.store(handle, std::memory_order_relaxed);
+        ref.generation.store(generation, std::memory_order_release);
+    }
+    return handle;
+}
+
+MonoClass* MonoRuntime::Resolve(MonoClassRef& ref) {
+    return ResolveRef(ref, [&]() { return GetClass(ref.assemblyName, ref.nameSpace, ref.className); });
+}
+
+MonoMethod* MonoRuntime::Resolve(MonoMethodRef& ref) {
+    return ResolveRef(ref, [&]() {
+        if (ref.returnType && ref.paramTypes) {
+            return GetMethod(GetClass(ref.assemblyName, ref.nameSpace, ref.className), ref.memberName, ref.paramCount, ref.returnType, ref.paramTypes);
+        }
+        return GetMethod(ref.assemblyName, ref.nameSpace, ref.className, ref.memberName, ref.paramCount);
+    });
+}
+
+MonoField* MonoRuntime::Resolve(MonoFieldRef& ref) {
+    return ResolveRef(ref, [&]() { return GetField(ref.assemblyName, ref.nameSpace, ref.className, ref.memberName); });
+}
+
+MonoProperty* MonoRuntime::Resolve(MonoPropertyRef& ref) {
+    return ResolveRef(ref, [&]() { return GetProperty(ref.assemblyName, ref.nameSpace, ref.className, ref.memberName); });
+}
+
+void MonoRuntime::InvalidateCaches() {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    m_classCache.clear();
+    m_memberCache.clear();
+    m_cacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
@@ -1,19 +1,95 @@
 #pragma once
 
 #include "MonoTypes.hpp"
+#include <atomic>
 #include <cstdint>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include <windows.h>
 
 typedef enum { MONO_IMAGE_OK = 0, MONO_IMAGE_ERROR_ERRNO, MONO_IMAGE_MISSING_ASSEMBLYREF, MONO_IMAGE_IMAGE_INVALID } MonoImageOpenStatus;
 
+enum class MonoMemberKind : uint8_t { Method, Field, Property };
+
+// Lookup cache keys. All names are interned by MonoRuntime, so keys compare and hash by pointer.
+struct MonoClassKey {
+    const char* assemblyName;
+    const char* nameSpace;
+    const char* className;
+
+    bool operator==(const MonoClassKey& other) const {
+        return assemblyName == other.assemblyName && nameSpace == other.nameSpace && className == other.className;
+    }
+};
+
+struct MonoMemberKey {
+    MonoClass* klass;
+    const char* memberName;
+    int32_t paramCount; // -1 for fields and properties
+    MonoMemberKind kind;
+
+    bool operator==(const MonoMemberKey& other) const {
+        return klass == other.klass && memberName == other.memberName && paramCount == other.paramCount && kind == other.kind;
+    }
+};
+
+struct MonoLookupKeyHash {
+    static size_t Mix(size_t seed, const void* value) { return seed ^ (std::hash<const void*>()(value) + 0x9E3779B9 + (seed << 6) + (seed >> 2)); }
+
+    size_t operator()(const MonoClassKey& key) const { return Mix(Mix(Mix(0, key.assemblyName), key.nameSpace), key.className); }
+    size_t operator()(const MonoMemberKey& key) const {
+        size_t seed = Mix(Mix(0, key.klass), key.memberName);
+        return seed ^ (static_cast<size_t>(key.paramCount) << 8) ^ static_cast<size_t>(key.kind);
+    }
+};
+
+enum class MonoRefKind : uint8_t { Class, Method, Field, Property };
+
+// Member reference that call sites keep instead of name strings. MonoRuntime::Resolve looks it up once
+// and hands back the stored handle until InvalidateCaches bumps the cache generation.
+// The Mono handle types are all void*, Kind keeps the reference types (and Resolve overloads) distinct.
+// References are shared between threads: the handle is stored before the generation (release) and read after it (acquire),
+// so a thread that sees the current generation also sees a handle resolved for it.
+template <typename T, MonoRefKind Kind> struct MonoRef {
+    const char* assemblyName;
+    const char* nameSpace;
+    const char* className;
+    const char* memberName = nullptr; // Unused for class references
+    int paramCount = -1;              // Methods only
+    // Methods only: with both set the overload is picked by signature (see MethodMatchesSignature), otherwise by paramCount alone
+    const char* returnType = nullptr;
+    const char* const* paramTypes = nullptr;
+
+    std::atomic<T*> handle{nullptr};
+    std::atomic<uint32_t> generation{0};
+};
+
+using MonoClassRef = MonoRef<MonoClass, MonoRefKind::Class>;
+using MonoMethodRef = MonoRef<MonoMethod, MonoRefKind::Method>;
+using MonoFieldRef = MonoRef<MonoField, MonoRefKind::Field>;
+using MonoPropertyRef = MonoRef<MonoProperty, MonoRefKind::Property>;
+
+// Where a field lives in memory: offset from the object start (instance fields, header included) or from the class's
+// static data block (static fields), and the managed size of its type
+struct MonoFieldLayout {
+    int32_t offset;
+    int32_t size;
+    uint8_t* staticData; // nullptr for instance fields
+};
+
 class MonoRuntime {
   private:
     mono_get_root_domain_t m_mono_get_root_domain;
+    mono_domain_get_t m_mono_domain_get;
     mono_domain_assembly_foreach_t m_mono_domain_assembly_foreach;
     mono_assembly_get_image_t m_mono_assembly_get_image;
     mono_image_get_name_t m_mono_image_get_name;
+    mono_image_get_filename_t m_mono_image_get_filename;
     mono_class_from_name_t m_mono_class_from_name;
     mono_class_get_method_from_name_t m_mono_class_get_method_from_name;
     mono_runtime_invoke_t m_mono_runtime_invoke;
@@ -55,14 +131,44 @@ class MonoRuntime {
     mono_assembly_load_from_full_t m_mono_assembly_load_from_full;
     mono_image_close_t m_mono_image_close;
     mono_assembly_close_t m_mono_assembly_close;
+    mono_gchandle_new_t m_mono_gchandle_new;
+    mono_gchandle_free_t m_mono_gchandle_free;
+    mono_field_get_type_t m_mono_field_get_type;
+    mono_type_size_t m_mono_type_size;
+    mono_method_get_unmanaged_thunk_t m_mono_method_get_unmanaged_thunk; // Optional, direct calls fall back to mono_runtime_invoke without it
+    mono_vtable_get_static_field_data_t m_mono_vtable_get_static_field_data; // Optional, static field accessors use the slow path without it
 
     MonoDomain* m_rootDomain;
-    MonoThread* m_thread;
 
+    // Threads this runtime attached, keyed by OS thread id. Threads that were already managed (the Unity main thread) are not recorded
+    // and never detached. Whether the calling thread went through AttachThread is tracked thread-locally in MonoRuntime.cpp.
+    std::mutex m_threadsMutex;
+    std::unordered_map<DWORD, MonoThread*> m_attachedThreads;
+
+    // Loaded images by assembly name. Startup phases look images up while the helper assembly is being loaded, so lookups
+    // take m_imageCacheMutex shared and inserts take it exclusively.
+    std::shared_mutex m_imageCacheMutex;
     std::unordered_map<std::string, MonoImage*> m_imageCache;
-    std::unordered_map<std::string, MonoClass*> m_classCache;
 
-    std::string MakeClassCacheKey(const char* nameSpace, const char* className);
+    // Class and member lookups, guarded by m_cacheMutex. Member misses are cached too, class misses are not
+    // because the owning assembly may load later.
+    std::mutex m_cacheMutex;
+    std::unordered_set<std::string> m_internedNames;
+    std::unordered_map<MonoClassKey, MonoClass*, MonoLookupKeyHash> m_classCache;
+    std::unordered_map<MonoMemberKey, void*, MonoLookupKeyHash> m_memberCache;
+    std::atomic<uint32_t> m_cacheGeneration{1};
+
+    // Constant strings created once and kept alive by pinned GC handles, keyed by interned text. Guarded by m_cacheMutex.
+    struct PooledString {
+        MonoString* string;
+        uint32_t gcHandle;
+    };
+    std::unordered_map<std::string_view, PooledString> m_constantStrings;
+    void ReleaseConstantStrings();
+
+    const char* InternLocked(std::string_view name);
+    void* GetMember(MonoClass* klass, const char* memberName, int paramCount, MonoMemberKind kind);
+    template <typename T, MonoRefKind Kind, typename Lookup> T* ResolveRef(MonoRef<T, Kind>& ref, Lookup lookup);
     static void __cdecl AssemblyIterationCallback(MonoAssembly* assembly, void* user_data);
 
   public:
@@ -72,25 +178,48 @@ class MonoRuntime {
     ~MonoRuntime();
 
     bool Initialize(const char* monoDllName = "mono-2.0-bdwgc.dll");
+    // Attaches the calling thread on first use, later calls only check a thread-local flag
     bool AttachThread();
+    // Detaches the calling thread if this runtime attached it. Runs automatically when an attached thread exits.
     void DetachThread();
+    bool IsThreadAttached() const;
     MonoAssembly* LoadAssemblyFromMemory(const char* data, size_t size, const char* name);
     MonoImage* GetAssemblyImage(MonoAssembly* assembly);
     void UnloadAssembly(MonoAssembly* assembly);
     MonoImage* GetImage(const char* assemblyName);
+    // Path the assembly was loaded from, nullptr for unknown or in-memory assemblies
+    const char* GetImageFileName(const char* assemblyName);
     MonoClass* GetClass(const char* assemblyName, const char* nameSpace, const char* className);
     MonoMethod* GetMethod(MonoClass* klass, const char* methodName, int paramCount);
+    MonoMethod* GetMethod(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount);
+    // Overload with exactly this signature, for methods whose overloads share a parameter count. Not cached, keep a MonoMethodRef.
+    MonoMethod* GetMethod(MonoClass* klass, const char* methodName, int paramCount, const char* returnType, const char* const* paramTypes);
     LPVOID GetMethodAddress(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount);
     LPVOID GetMethodAddress(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount,
                             const char* returnType, const char** paramTypes);
+    // Every method declared on klass, for callers that index a class once instead of walking it per lookup
+    std::vector<MonoMethod*> GetMethods(MonoClass* klass);
+    const char* GetMethodName(MonoMethod* method);
+    // Exact overload match by parameter count, return type name and parameter type names
+    bool MethodMatchesSignature(MonoMethod* method, int paramCount, const char* returnType, const char* const* paramTypes);
+    LPVOID CompileMethod(MonoMethod* method);
     MonoObject* InvokeMethod(MonoMethod* method, void* obj, void** params);
+    // Native entry point for method (see MonoInvoker), nullptr if the runtime doesn't export thunk support
+    void* GetUnmanagedThunk(MonoMethod* method);
     MonoField* GetField(MonoClass* klass, const char* fieldName);
+    MonoField* GetField(const char* assemblyName, const char* nameSpace, const char* className, const char* fieldName);
     template <typename T> T GetFieldValue(MonoObject* obj, MonoField* field);
     template <typename T> T GetStaticFieldValue(MonoClass* klass, MonoField* field);
     template <typename T> void SetStaticFieldValue(MonoClass* klass, MonoField* field, T value);
     MonoString* CreateString(const char* text);
+    // Shared managed string for text that never changes (tokens, names passed to managed calls). Created on first use and
+    // reused until the runtime unloads, so callers must not mutate it or rely on a distinct instance.
+    MonoString* GetConstantString(std::string_view text);
     std::string StringToUtf8(MonoString* monoString);
+    // Replaces out, reusing its capacity
+    void StringToUtf8(MonoString* monoString, std::string& out);
     MonoProperty* GetProperty(MonoClass* klass, const char* propertyName);
+    MonoProperty* GetProperty(const char* assemblyName, const char* nameSpace, const char* className, const char* propertyName);
     MonoMethod* GetPropertyGetMethod(MonoProperty* prop);
     MonoMethod* GetPropertySetMethod(MonoProperty* prop);
     MonoDomain* GetRootDomain() const;
@@ -98,14 +227,28 @@ class MonoRuntime {
     MonoClass* GetObjectClass(MonoObject* obj);
     void* GetInternalCallPointer(MonoMethod* method);
     MonoObject* CreateObject(MonoClass* klass);
+    // value points at the new value, or is the object itself for reference-type fields (as mono_field_set_value expects)
     void SetFieldValue(MonoObject* obj, MonoField* field, void* value);
+    // Stores an object reference into a static reference-type field through mono_field_static_set_value
+    void SetStaticFieldReference(MonoClass* klass, MonoField* field, MonoObject* value);
     MonoObject* GetTypeObject(MonoClass* klass);
+    // Raw location of a field for MonoFieldAccessor, false when the field has no fixed slot to read directly
+    bool GetFieldLayout(MonoClass* klass, MonoField* field, bool isStatic, MonoFieldLayout& layout);
     void* UnboxObject(MonoObject* obj);
+
+    // Typed references, resolved on first use and again after an invalidation
+    MonoClass* Resolve(MonoClassRef& ref);
+    MonoMethod* Resolve(MonoMethodRef& ref);
+    MonoField* Resolve(MonoFieldRef& ref);
+    MonoProperty* Resolve(MonoPropertyRef& ref);
+
+    // Drops every cached class and member handle and stales all typed references, done when an assembly is unloaded
+    void InvalidateCaches();
 };
 
 // Template method implementations
 template <typename T> T MonoRuntime::GetFieldValue(MonoObject* obj, MonoField* field) {
-    if (!obj || !field) {
+    if (!obj || !field || !AttachThread()) {
         T defaultValue = T();
         return defaultValue;
     }
@@ -116,7 +259,7 @@ template <typename T> T MonoRuntime::GetFieldValue(MonoObject* obj, MonoField* f
 }
 
 template <typename T> T MonoRuntime::GetStaticFieldValue(MonoClass* klass, MonoField* field) {
-    if (!klass || !field) {
+    if (!klass || !field || !AttachThread()) {
         T defaultValue = T();
         return defaultValue;
     }
@@ -133,7 +276,7 @@ template <typename T> T MonoRuntime::GetStaticFieldValue(MonoClass* klass, MonoF
 }
 
 template <typename T> void MonoRuntime::SetStaticFieldValue(MonoClass* klass, MonoField* field, T value) {
-    if (!klass || !field) {
+    if (!klass || !field || !AttachThread()) {
         return;
     }
 
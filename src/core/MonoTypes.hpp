@@ -1,5 +1,7 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <string_view>
 
 typedef void* MonoDomain;
 typedef void* MonoAssembly;
@@ -19,10 +21,12 @@ typedef void* MonoType;
 typedef int32_t mono_bool;
 
 typedef MonoDomain*(__cdecl* mono_get_root_domain_t)();
+typedef MonoDomain*(__cdecl* mono_domain_get_t)();
 typedef MonoVTable*(__cdecl* mono_class_vtable_t)(MonoDomain* domain, MonoClass* klass);
 typedef void(__cdecl* mono_domain_assembly_foreach_t)(MonoDomain* domain, void (*func)(void* assembly, void* user_data), void* user_data);
 typedef MonoImage*(__cdecl* mono_assembly_get_image_t)(MonoAssembly* assembly);
 typedef const char*(__cdecl* mono_image_get_name_t)(MonoImage* image);
+typedef const char*(__cdecl* mono_image_get_filename_t)(MonoImage* image);
 typedef MonoClass*(__cdecl* mono_class_from_name_t)(MonoImage* image, const char* name_space, const char* name);
 typedef MonoMethod*(__cdecl* mono_class_get_method_from_name_t)(MonoClass* klass, const char* name, int param_count);
 typedef MonoObject*(__cdecl* mono_runtime_invoke_t)(MonoMethod* method, void* obj, void** params, MonoObject** exc);
@@ -64,3 +68,25 @@ typedef MonoImage* (*mono_image_open_from_data_t)(char* data, uint32_t data_len,
 typedef MonoAssembly* (*mono_assembly_load_from_full_t)(MonoImage* image, const char* fname, void* status, int refonly);
 typedef void (*mono_image_close_t)(MonoImage* image);
 typedef void (*mono_assembly_close_t)(MonoAssembly* assembly);
+typedef void*(__cdecl* mono_method_get_unmanaged_thunk_t)(MonoMethod* method);
+typedef uint32_t(__cdecl* mono_gchandle_new_t)(MonoObject* obj, mono_bool pinned);
+typedef void(__cdecl* mono_gchandle_free_t)(uint32_t gchandle);
+typedef void*(__cdecl* mono_vtable_get_static_field_data_t)(MonoVTable* vt);
+typedef MonoType*(__cdecl* mono_field_get_type_t)(MonoField* field);
+typedef int(__cdecl* mono_type_size_t)(MonoType* type, int* alignment);
+
+// Header of a managed string object (MonoString in Mono's object-internals.h), the UTF-16 characters follow the length
+struct MonoStringHeader {
+    void* vtable;
+    void* synchronisation;
+    int32_t length;
+    char16_t chars[1];
+};
+
+// UTF-16 contents of a managed string, read in place. Only valid while the string is reachable.
+inline std::u16string_view MonoStringChars(const void* string) {
+    if (!string)
+        return {};
+    const MonoStringHeader* header = static_cast<const MonoStringHeader*>(string);
+    return {header->chars, static_cast<size_t>(header->length > 0 ? header->length : 0)};
+}
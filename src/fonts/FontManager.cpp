@@ -1,10 +1,12 @@
 #include "FontManager.hpp"
 #include "globals/globals.hpp"
+#include <algorithm>
 #include <filesystem>
 
 static float BaseFontSize = 15.0f;
 
 ImFont* FontManager::JetBrainsMono = nullptr;
+ImFont* FontManager::JetBrainsMonoOutlined = nullptr;
 ImFont* FontManager::FontAwesomeSolid = nullptr;
 ImFont* FontManager::DefaultFont = nullptr;
 
@@ -17,6 +19,9 @@ static const ImWchar* UnicodeRanges = nullptr;
 void FontManager::InitializeFonts(ImFontAtlas* atlas) {
     atlas->Clear();
 
+    // Leave room around every glyph so outlined glyphs can grow into the padding without touching a neighbour
+    atlas->TexGlyphPadding = OutlineThickness * 2 + 1;
+
     const ImWchar* glyphRanges = GetGlyphRanges();
 
     ImFontConfig config;
@@ -44,9 +49,17 @@ void FontManager::InitializeFonts(ImFontAtlas* atlas) {
     FontInfo jetBrainsMonoInfo = {"JetBrains Mono", "", JetBrainsMono};
     AvailableFonts.push_back(jetBrainsMonoInfo);
 
+    // Rasterised 1:1 so a font pixel of outline is exactly one texel
+    ImFontConfig outlinedConfig = config;
+    outlinedConfig.OversampleH = 1;
+    outlinedConfig.OversampleV = 1;
+    JetBrainsMonoOutlined =
+        atlas->AddFontFromMemoryCompressedTTF(JetBrainsMonoReg_compressed_data, JetBrainsMonoReg_compressed_size, BaseFontSize, &outlinedConfig, glyphRanges);
+
     LoadCustomFonts(atlas);
 
     atlas->Build();
+    BakeOutlinedGlyphs(atlas, JetBrainsMonoOutlined);
 
     // Default to JetBrains Mono
     CurrentFontIndex = 1;
@@ -116,6 +129,78 @@ ImFont* FontManager::GetESPFont() {
     return DefaultFont;
 }
 
+ImFont* FontManager::GetESPOutlinedFont() { return GetESPFont() == JetBrainsMono ? JetBrainsMonoOutlined : nullptr; }
+
+void FontManager::BakeOutlinedGlyphs(ImFontAtlas* atlas, ImFont* font) {
+    if (!font) {
+        return;
+    }
+
+    unsigned char* pixels = nullptr;
+    int width = 0, height = 0;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    if (!pixels) {
+        LOG_ERROR("Failed to get font atlas pixels for outline baking");
+        JetBrainsMonoOutlined = nullptr;
+        return;
+    }
+
+    unsigned int* texels = reinterpret_cast<unsigned int*>(pixels);
+    const int t = OutlineThickness;
+    std::vector<unsigned char> source;
+
+    for (ImFontGlyph& glyph : font->Glyphs) {
+        if (!glyph.Visible)
+            continue;
+
+        int x0 = static_cast<int>(glyph.U0 * width + 0.5f);
+        int y0 = static_cast<int>(glyph.V0 * height + 0.5f);
+        int x1 = static_cast<int>(glyph.U1 * width + 0.5f);
+        int y1 = static_cast<int>(glyph.V1 * height + 0.5f);
+        if (x0 - t < 0 || y0 - t < 0 || x1 + t > width || y1 + t > height)
+            continue;
+
+        // Copy the glyph coverage with a t texel border so reads stay inside the grown rect
+        int w = x1 - x0 + 2 * t;
+        int h = y1 - y0 + 2 * t;
+        source.assign(static_cast<size_t>(w) * h, 0);
+        for (int y = y0; y < y1; y++) {
+            for (int x = x0; x < x1; x++) {
+                source[(y - y0 + t) * w + (x - x0 + t)] = static_cast<unsigned char>(texels[y * width + x] >> IM_COL32_A_SHIFT);
+            }
+        }
+
+        // White fill composited over a black dilation of itself, the vertex colour then only tints the fill
+        for (int y = 0; y < h; y++) {
+            for (int x = 0; x < w; x++) {
+                int fill = source[y * w + x];
+                int outline = 0;
+                for (int dy = -t; dy <= t; dy++) {
+                    for (int dx = -t; dx <= t; dx++) {
+                        int sx = x + dx, sy = y + dy;
+                        if (sx >= 0 && sy >= 0 && sx < w && sy < h) {
+                            outline = std::max(outline, static_cast<int>(source[sy * w + sx]));
+                        }
+                    }
+                }
+
+                int alpha = fill + outline * (255 - fill) / 255;
+                int value = alpha > 0 ? fill * 255 / alpha : 0;
+                texels[(y0 - t + y) * width + (x0 - t + x)] = IM_COL32(value, value, value, alpha);
+            }
+        }
+
+        glyph.X0 -= t;
+        glyph.Y0 -= t;
+        glyph.X1 += t;
+        glyph.Y1 += t;
+        glyph.U0 = static_cast<float>(x0 - t) / width;
+        glyph.V0 = static_cast<float>(y0 - t) / height;
+        glyph.U1 = static_cast<float>(x1 + t) / width;
+        glyph.V1 = static_cast<float>(y1 + t) / height;
+    }
+}
+
 const ImWchar* FontManager::GetGlyphRanges() {
     if (UnicodeRanges == nullptr) {
         static ImFontGlyphRangesBuilder builder;
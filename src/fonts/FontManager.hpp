@@ -16,9 +16,12 @@ class FontManager {
     };
 
     static ImFont* JetBrainsMono;
+    static ImFont* JetBrainsMonoOutlined; // Same glyphs with a black outline baked into the atlas
     static ImFont* FontAwesomeSolid;
     static ImFont* DefaultFont;
 
+    static constexpr int OutlineThickness = 1; // In font pixels at the base size
+
     static float ESPFontSize;
     static int CurrentFontIndex;
 
@@ -27,6 +30,9 @@ class FontManager {
     static void InitializeFonts(ImFontAtlas* atlas);
     static void LoadCustomFonts(ImFontAtlas* atlas);
     static ImFont* GetESPFont();
+    // Outlined twin of the current ESP font, nullptr if it has none
+    static ImFont* GetESPOutlinedFont();
+    static void BakeOutlinedGlyphs(ImFontAtlas* atlas, ImFont* font);
     static const ImWchar* GetGlyphRanges();
     static void SetupUnicodeRanges(ImFontGlyphRangesBuilder& builder);
 };
@@ -1,6 +1,56 @@
 #include "GameFunctions.hpp"
 #include "globals/globals.hpp"
 #include "hooks/hooks.hpp"
+#include <filesystem>
+#include <fstream>
+
+static const char* catalogCacheDirectory = "ror2mod/cache";
+static const char* catalogCachePath = "ror2mod/cache/catalogs.bin";
+
+namespace {
+// Read-only mapping of a whole file, Data() is nullptr if it couldn't be opened or is empty
+class MappedFile {
+  private:
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+
+  public:
+    explicit MappedFile(const char* path) {
+        m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0)
+            return;
+
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping)
+            return;
+
+        m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (m_data)
+            m_size = static_cast<size_t>(size.QuadPart);
+    }
+
+    ~MappedFile() {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* Data() const { return m_data; }
+    size_t Size() const { return m_size; }
+};
+} // namespace
 
 GameFunctions::GameFunctions(MonoRuntime* runtime) {
     m_runtime = runtime;
@@ -76,98 +126,142 @@ void GameFunctions::Cursor_SetVisible(bool visible) {
     G::queuedActions.push(task);
 }
 
-std::string GameFunctions::Language_GetString(MonoString* token) {
-    if (!m_languageClass)
-        return "";
+std::string_view GameFunctions::Language_GetString(MonoString* token) {
+    if (!m_languageClass || !token)
+        return {};
 
-    MonoMethod* method = m_runtime->GetMethod(m_languageClass, "GetString", 1);
-    if (!method) {
-        LOG_ERROR("Failed to find GetString method");
-        return "";
+    std::u16string_view tokenChars = MonoStringChars(token);
+    {
+        std::lock_guard<std::mutex> lock(m_languageCacheMutex);
+        auto it = m_languageCache.find(tokenChars);
+        if (it != m_languageCache.end()) {
+            return it->second;
+        }
     }
 
-    void* args[1];
-    args[0] = token;
-
-    MonoObject* result = m_runtime->InvokeMethod(method, nullptr, args);
+    MonoString* result = m_languageGetString.Invoke(m_runtime, token);
     if (!result) {
         LOG_ERROR("Failed to get string from token");
-        return "";
+        return {};
     }
-    return m_runtime->StringToUtf8(static_cast<MonoString*>(result));
+    std::string text = m_runtime->StringToUtf8(result);
+
+    std::lock_guard<std::mutex> lock(m_languageCacheMutex);
+    auto it = m_languageCache.find(tokenChars);
+    if (it != m_languageCache.end()) {
+        return it->second; // Another thread translated it meanwhile
+    }
+    std::string_view cached = m_languageArena.Store(std::string_view(text));
+    m_languageCache.emplace(m_languageArena.Store(tokenChars), cached);
+    return cached;
+}
+
+void GameFunctions::ClearLanguageCache() {
+    std::lock_guard<std::mutex> lock(m_languageCacheMutex);
+    LOG_INFO("Language changed, flushing %zu cached translations", m_languageCache.size());
+    m_languageCache.clear();
 }
 
 PickupDef* GameFunctions::GetPickupDef(int pickupIndex) {
     if (!m_pickupCatalogClass)
         return nullptr;
 
-    MonoField* entriesField = m_runtime->GetField(m_pickupCatalogClass, "entries");
-    if (!entriesField) {
-        LOG_ERROR("Failed to find PickupCatalog.entries field");
-        return nullptr;
-    }
-
-    MonoArray* entriesArray = m_runtime->GetStaticFieldValue<MonoArray*>(m_pickupCatalogClass, entriesField);
+    MonoArray* entriesArray = m_pickupCatalogEntries.Get(m_runtime);
     if (!entriesArray) {
         LOG_ERROR("Failed to get PickupCatalog.entries array");
         return nullptr;
     }
 
-    int arrayLength = m_runtime->GetArrayLength(entriesArray);
-    if (pickupIndex < 0 || pickupIndex >= arrayLength) {
-        LOG_ERROR("PickupIndex %d out of bounds (array length: %d)", pickupIndex, arrayLength);
-        return nullptr;
-    }
-
-    MonoClass* arrayClass = m_runtime->GetObjectClass(static_cast<MonoObject*>(entriesArray));
-    MonoMethod* getItemMethod = m_runtime->GetMethod(arrayClass, "Get", 1);
-    if (!getItemMethod) {
-        LOG_ERROR("Failed to get array access method");
+    MonoArrayView<PickupDef*> entries(entriesArray);
+    if (!entries.InBounds(pickupIndex)) {
+        LOG_ERROR("PickupIndex %d out of bounds (array length: %zu)", pickupIndex, entries.Size());
         return nullptr;
     }
 
-    void* params[1] = {&pickupIndex};
-    MonoObject* pickupDefObj = m_runtime->InvokeMethod(getItemMethod, entriesArray, params);
-    if (!pickupDefObj) {
+    PickupDef* pickupDef = entries.Get(pickupIndex);
+    if (!pickupDef) {
         LOG_ERROR("Failed to get PickupDef at index %d", pickupIndex);
         return nullptr;
     }
 
-    return reinterpret_cast<PickupDef*>(pickupDefObj);
+    return pickupDef;
 }
 
 int GameFunctions::LoadPickupNames() {
     if (!m_pickupCatalogClass)
         return -1;
 
-    MonoField* entriesField = m_runtime->GetField(m_pickupCatalogClass, "entries");
-    if (!entriesField) {
-        LOG_ERROR("Failed to find PickupCatalog.entries field");
-        return -1;
-    }
-
-    MonoArray* entriesArray = m_runtime->GetStaticFieldValue<MonoArray*>(m_pickupCatalogClass, entriesField);
+    MonoArray* entriesArray = m_pickupCatalogEntries.Get(m_runtime);
     if (!entriesArray) {
         LOG_ERROR("Failed to get PickupCatalog.entries array");
         return -1;
     }
 
-    int arrayLength = m_runtime->GetArrayLength(entriesArray);
+    MonoArrayView<PickupDef*> entries(entriesArray);
+    int arrayLength = static_cast<int>(entries.Size());
+
+    if (m_cachedCatalogs && m_cachedCatalogs->pickupCount == arrayLength) {
+        for (const auto& [pickupIndex, name] : m_cachedCatalogs->pickupNames) {
+            G::espModule->CachePickupName(pickupIndex, name);
+        }
+        LOG_INFO("Loaded %zu pickup names from the catalog cache", m_cachedCatalogs->pickupNames.size());
+        return arrayLength;
+    }
 
+    bool layoutMatches = G::structLayouts->Matches(GameStructId::PickupDef);
+    std::vector<std::pair<int32_t, std::string>> pickupNames;
     for (int i = 0; i < arrayLength; i++) {
-        PickupDef* pickupDef = GetPickupDef(i);
-        if (pickupDef && pickupDef->nameToken) {
-            std::string name = Language_GetString(static_cast<MonoString*>(pickupDef->nameToken));
+        PickupDef* pickupDef = entries.Get(i);
+        if (!pickupDef)
+            continue;
+
+        void* nameToken = layoutMatches ? pickupDef->nameToken : m_pickupDefNameToken.Get(m_runtime, pickupDef);
+        if (nameToken) {
+            std::string name(Language_GetString(static_cast<MonoString*>(nameToken)));
             if (!name.empty()) {
                 G::espModule->CachePickupName(i, name);
+                pickupNames.emplace_back(i, name);
             }
             LOG_INFO("Loaded pickup %d: %s", i, name.c_str());
         }
     }
 
+    m_liveCatalogs.pickupNames = std::move(pickupNames);
+    m_liveCatalogs.pickupCount = arrayLength;
     return arrayLength;
 }
 
+ItemDef GameFunctions::ReadItemDef(ItemDef* itemDef) {
+    if (G::structLayouts->Matches(GameStructId::ItemDef))
+        return *itemDef;
+
+    ItemDef copy{};
+    copy._itemTierDef = m_itemDefTierDef.Get(m_runtime, itemDef);
+    copy.nameToken = m_itemDefNameToken.Get(m_runtime, itemDef);
+    copy.pickupToken = m_itemDefPickupToken.Get(m_runtime, itemDef);
+    copy.descriptionToken = m_itemDefDescriptionToken.Get(m_runtime, itemDef);
+    copy.loreToken = m_itemDefLoreToken.Get(m_runtime, itemDef);
+    copy.tags = m_itemDefTags.Get(m_runtime, itemDef);
+    copy._itemIndex = m_itemDefIndex.Get(m_runtime, itemDef);
+    copy.deprecatedTier = m_itemDefDeprecatedTier.Get(m_runtime, itemDef);
+    copy.isConsumed = m_itemDefIsConsumed.Get(m_runtime, itemDef);
+    copy.hidden = m_itemDefHidden.Get(m_runtime, itemDef);
+    copy.canRemove = m_itemDefCanRemove.Get(m_runtime, itemDef);
+    return copy;
+}
+
+ItemTierDef GameFunctions::ReadItemTierDef(ItemTierDef* tierDef) {
+    if (G::structLayouts->Matches(GameStructId::ItemTierDef))
+        return *tierDef;
+
+    ItemTierDef copy{};
+    copy._tier = m_itemTierDefTier.Get(m_runtime, tierDef);
+    copy.isDroppable = m_itemTierDefIsDroppable.Get(m_runtime, tierDef);
+    copy.canScrap = m_itemTierDefCanScrap.Get(m_runtime, tierDef);
+    copy.canRestack = m_itemTierDefCanRestack.Get(m_runtime, tierDef);
+    return copy;
+}
+
 // Function should only be called from safe threads so queue is not needed
 int GameFunctions::LoadItems() {
     if (!m_contentManagerClass || !m_itemDefClass) {
@@ -187,57 +281,73 @@ int GameFunctions::LoadItems() {
         return -1;
     }
 
-    uint32_t itemDefsLen = static_cast<uint32_t>((reinterpret_cast<MonoArray_Internal*>(itemDefsArray))->max_length);
+    MonoArrayView<ItemDef*> itemDefs(itemDefsArray);
+    uint32_t itemDefsLen = static_cast<uint32_t>(itemDefs.Size());
     if (itemDefsLen <= 0) {
         LOG_ERROR("Item count is zero or negative");
         return -1;
     }
     LOG_INFO("Found %u items", itemDefsLen);
 
-    ItemDef** itemDefsData = mono_array_addr<ItemDef*>(reinterpret_cast<MonoArray_Internal*>(itemDefsArray));
+    if (m_cachedCatalogs && m_cachedCatalogs->itemDefCount == static_cast<int32_t>(itemDefsLen)) {
+        std::unique_lock<std::shared_mutex> lock(G::itemsMutex);
+        G::items = m_cachedCatalogs->items;
+        for (const auto& [name, index] : m_cachedCatalogs->specialItems) {
+            G::specialItems[name] = index;
+        }
+        LOG_INFO("Loaded %zu items from the catalog cache", G::items.size());
+        return itemDefsLen;
+    }
+
+    std::vector<std::pair<std::string, int32_t>> specialItems;
     std::unique_lock<std::shared_mutex> lock(G::itemsMutex);
     G::items.clear();
     for (uint32_t i = 0; i < itemDefsLen; i++) {
+        ItemDef* itemDefObject = itemDefs.Get(i);
+        if (!itemDefObject)
+            continue;
+        const ItemDef itemDef = ReadItemDef(itemDefObject);
+
         RoR2Item item;
-        ItemDef* itemDef = itemDefsData[i];
-        item.index = itemDef->_itemIndex.value__;
+        item.index = itemDef._itemIndex.value__;
         if (item.index < 0) {
             LOG_ERROR("Item index is negative, failing");
             return -1;
         }
-        item.nameToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef->nameToken));
-        item.displayName = Language_GetString(static_cast<MonoString*>(itemDef->nameToken));
-        item.pickupToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef->pickupToken));
-        item.descriptionToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef->descriptionToken));
-        item.loreToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef->loreToken));
-        if (itemDef->_itemTierDef) {
-            item.tier = itemDef->_itemTierDef->_tier;
-            item.isDroppable = itemDef->_itemTierDef->isDroppable;
-            item.canScrap = itemDef->_itemTierDef->canScrap;
-            item.canRestack = itemDef->_itemTierDef->canRestack;
+        item.nameToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef.nameToken));
+        item.displayName = Language_GetString(static_cast<MonoString*>(itemDef.nameToken));
+        item.pickupToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef.pickupToken));
+        item.descriptionToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef.descriptionToken));
+        item.loreToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(itemDef.loreToken));
+        if (itemDef._itemTierDef) {
+            ItemTierDef tierDef = ReadItemTierDef(itemDef._itemTierDef);
+            item.tier = tierDef._tier;
+            item.isDroppable = tierDef.isDroppable;
+            item.canScrap = tierDef.canScrap;
+            item.canRestack = tierDef.canRestack;
         } else {
-            item.tier = itemDef->deprecatedTier;
-            LOG_INFO("Item %s has no ItemTierDef, using deprecated tier %i", item.displayName.c_str(), itemDef->deprecatedTier);
+            item.tier = itemDef.deprecatedTier;
+            LOG_INFO("Item %s has no ItemTierDef, using deprecated tier %i", item.displayName.c_str(), itemDef.deprecatedTier);
         }
 
-        item.canRemove = itemDef->canRemove;
-        item.isConsumed = itemDef->isConsumed;
-        item.hidden = itemDef->hidden;
+        item.canRemove = itemDef.canRemove;
+        item.isConsumed = itemDef.isConsumed;
+        item.hidden = itemDef.hidden;
 
-        uint32_t tagsLen = static_cast<uint32_t>((reinterpret_cast<MonoArray_Internal*>(itemDef->tags))->max_length);
-        ItemTag_Value* tagsData = mono_array_addr<ItemTag_Value>(reinterpret_cast<MonoArray_Internal*>(itemDef->tags));
-        for (uint32_t iTag = 0; iTag < tagsLen; iTag++) {
-            ItemTag_Value tag = tagsData[iTag];
+        MonoArrayView<ItemTag_Value> tags(itemDef.tags);
+        item.tags.reserve(tags.Size());
+        for (ItemTag_Value tag : tags) {
             item.tags.push_back(static_cast<int>(tag));
         }
 
-        item.name = GetUnityObjectName(itemDef);
+        item.name = GetUnityObjectName(itemDefObject);
 
         if (item.displayName == item.nameToken && !item.nameToken.empty()) {
             LOG_ERROR("Item displayName '%s' is the same as nameToken '%s', skipping", item.displayName.c_str(), item.nameToken.c_str());
         } else if (item.displayName.empty()) {
             // Store special items with empty display names in separate map
             G::specialItems[item.name] = item.index;
+            specialItems.emplace_back(item.name, item.index);
             LOG_INFO("Stored special item '%s' at index %d", item.name.c_str(), item.index);
         } else if (item.displayName.find("(Consumed)") != std::string::npos) {
             LOG_ERROR("Item displayName '%s' contains '(Consumed)', skipping", item.displayName.c_str());
@@ -246,6 +356,9 @@ int GameFunctions::LoadItems() {
         }
     }
 
+    m_liveCatalogs.items = G::items;
+    m_liveCatalogs.specialItems = std::move(specialItems);
+    m_liveCatalogs.itemDefCount = static_cast<int32_t>(itemDefsLen);
     return itemDefsLen;
 }
 
@@ -267,7 +380,8 @@ int GameFunctions::LoadEnemies() {
         return -1;
     }
 
-    int masterCount = m_runtime->GetArrayLength(masterPrefabsArray);
+    MonoArrayView<MonoObject*> masterPrefabs(masterPrefabsArray);
+    int masterCount = static_cast<int>(masterPrefabs.Size());
     if (masterCount <= 0) {
         LOG_ERROR("Master count is zero or negative");
         return -1;
@@ -275,19 +389,17 @@ int GameFunctions::LoadEnemies() {
 
     LOG_INFO("Found %d masters", masterCount);
 
-    MonoClass* arrayClass = m_runtime->GetObjectClass(static_cast<MonoObject*>(masterPrefabsArray));
-    MonoMethod* getItemMethod = m_runtime->GetMethod(arrayClass, "Get", 1);
-    if (!getItemMethod) {
-        LOG_ERROR("Failed to get array access method");
-        return -1;
+    std::unique_lock<std::shared_mutex> lock(G::enemiesMutex);
+    if (m_cachedCatalogs && m_cachedCatalogs->masterCount == masterCount) {
+        G::enemies = m_cachedCatalogs->enemies;
+        LOG_INFO("Loaded %zu enemies from the catalog cache", G::enemies.size());
+        return static_cast<int>(G::enemies.size());
     }
 
-    std::unique_lock<std::shared_mutex> lock(G::enemiesMutex);
     G::enemies.clear();
 
     for (int i = 0; i < masterCount; i++) {
-        void* params[1] = {&i};
-        MonoObject* masterPrefab = m_runtime->InvokeMethod(getItemMethod, masterPrefabsArray, params);
+        MonoObject* masterPrefab = masterPrefabs.Get(i);
         if (!masterPrefab)
             continue;
 
@@ -323,6 +435,9 @@ int GameFunctions::LoadEnemies() {
         G::enemies.push_back(enemy);
     }
 
+    m_liveCatalogs.enemies = G::enemies;
+    m_liveCatalogs.masterCount = masterCount;
+
     int enemyCount = static_cast<int>(G::enemies.size());
     LOG_INFO("Loaded %d enemies", enemyCount);
     return enemyCount;
@@ -353,7 +468,8 @@ int GameFunctions::LoadElites() {
         return -1;
     }
 
-    int buffCount = m_runtime->GetArrayLength(buffDefsArray);
+    MonoArrayView<MonoObject*> buffDefs(buffDefsArray);
+    int buffCount = static_cast<int>(buffDefs.Size());
     LOG_INFO("Found %d buffs in BuffCatalog", buffCount);
 
     if (!m_buffDefClass) {
@@ -361,28 +477,25 @@ int GameFunctions::LoadElites() {
         return -1;
     }
 
-    MonoField* eliteDefField = m_runtime->GetField(m_buffDefClass, "eliteDef");
-    if (!eliteDefField) {
-        LOG_ERROR("Failed to find BuffDef.eliteDef field");
-        return -1;
+    if (m_cachedCatalogs && m_cachedCatalogs->buffCount == buffCount) {
+        for (const auto& [eliteName, buffIndex] : m_cachedCatalogs->elites) {
+            G::eliteNames.push_back(eliteName);
+            G::eliteBuffIndices[eliteName] = buffIndex;
+        }
+        LOG_INFO("Loaded %zu elite types from the catalog cache", m_cachedCatalogs->elites.size());
+        return static_cast<int>(m_cachedCatalogs->elites.size());
     }
 
-    MonoClass* arrayClass = m_runtime->GetObjectClass(static_cast<MonoObject*>(buffDefsArray));
-    MonoMethod* getItemMethod = m_runtime->GetMethod(arrayClass, "Get", 1);
-    if (!getItemMethod) {
-        LOG_ERROR("Failed to get array access method");
-        return -1;
-    }
+    std::vector<std::pair<std::string, int32_t>> elites;
 
     // Iterate through all buffs to find elite ones
     for (int i = 0; i < buffCount; i++) {
-        void* params[1] = {&i};
-        MonoObject* buffDefObj = m_runtime->InvokeMethod(getItemMethod, buffDefsArray, params);
+        MonoObject* buffDefObj = buffDefs.Get(i);
         if (!buffDefObj)
             continue;
 
         // Check if this buff is an elite buff (eliteDef != null)
-        MonoObject* eliteDefObj = m_runtime->GetFieldValue<MonoObject*>(buffDefObj, eliteDefField);
+        MonoObject* eliteDefObj = m_buffDefEliteDef.Get(m_runtime, buffDefObj);
         if (!eliteDefObj)
             continue;
 
@@ -406,14 +519,126 @@ int GameFunctions::LoadElites() {
 
         G::eliteNames.push_back(eliteName);
         G::eliteBuffIndices[eliteName] = i;
+        elites.emplace_back(eliteName, i);
 
         LOG_INFO("Found elite buff: %s at index %d", eliteName.c_str(), i);
     }
 
+    m_liveCatalogs.elites = std::move(elites);
+    m_liveCatalogs.buffCount = buffCount;
+
     LOG_INFO("Loaded %zu elite types", G::eliteNames.size() - 1); // -1 for "None"
     return static_cast<int>(G::eliteNames.size() - 1);
 }
 
+bool GameFunctions::ComputeCatalogKey(uint64_t& key) {
+    const char* assemblyPath = m_runtime->GetImageFileName("Assembly-CSharp");
+    if (!assemblyPath || !*assemblyPath) {
+        LOG_WARNING("Assembly-CSharp has no file path, catalog cache disabled");
+        return false;
+    }
+
+    MappedFile assembly(assemblyPath);
+    if (!assembly.Data()) {
+        LOG_WARNING("Failed to map %s, catalog cache disabled", assemblyPath);
+        return false;
+    }
+
+    // Display names are translated, so the language is part of the key
+    MonoMethod* getLanguageName = m_languageClass ? m_runtime->GetMethod(m_languageClass, "get_currentLanguageName", 0) : nullptr;
+    MonoObject* languageNameObj = getLanguageName ? m_runtime->InvokeMethod(getLanguageName, nullptr, nullptr) : nullptr;
+    if (!languageNameObj) {
+        LOG_WARNING("Failed to get the current language, catalog cache disabled");
+        return false;
+    }
+    std::string languageName = m_runtime->StringToUtf8(static_cast<MonoString*>(languageNameObj));
+
+    key = CatalogCache::Hash(assembly.Data(), assembly.Size());
+    key = CatalogCache::Hash(languageName.data(), languageName.size(), key);
+    return true;
+}
+
+bool GameFunctions::LoadCatalogCache() {
+    if (!ComputeCatalogKey(m_catalogKey)) {
+        m_catalogKey = 0;
+        return false;
+    }
+
+    MappedFile file(catalogCachePath);
+    if (!file.Data()) {
+        LOG_INFO("No catalog cache at %s, walking catalogs", catalogCachePath);
+        return false;
+    }
+
+    auto snapshot = std::make_unique<CatalogSnapshot>();
+    if (!CatalogCache::Deserialize(file.Data(), file.Size(), m_catalogKey, *snapshot)) {
+        LOG_INFO("Catalog cache is from another game build or language, walking catalogs");
+        return false;
+    }
+
+    LOG_INFO("Loaded catalog cache: %zu items, %zu enemies, %zu elites, %zu pickup names", snapshot->items.size(), snapshot->enemies.size(),
+             snapshot->elites.size(), snapshot->pickupNames.size());
+    m_cachedCatalogs = std::move(snapshot);
+    return true;
+}
+
+void GameFunctions::SaveCatalogCache() {
+    if (m_catalogKey == 0)
+        return;
+
+    if (m_liveCatalogs.itemDefCount == -1 && m_liveCatalogs.masterCount == -1 && m_liveCatalogs.buffCount == -1 && m_liveCatalogs.pickupCount == -1)
+        return; // Everything came from the cache
+
+    // Sections that were served from the cache are carried over unchanged
+    CatalogSnapshot snapshot = m_liveCatalogs;
+    if (const CatalogSnapshot* cached = m_cachedCatalogs.get()) {
+        if (snapshot.itemDefCount == -1) {
+            snapshot.itemDefCount = cached->itemDefCount;
+            snapshot.items = cached->items;
+            snapshot.specialItems = cached->specialItems;
+        }
+        if (snapshot.masterCount == -1) {
+            snapshot.masterCount = cached->masterCount;
+            snapshot.enemies = cached->enemies;
+        }
+        if (snapshot.buffCount == -1) {
+            snapshot.buffCount = cached->buffCount;
+            snapshot.elites = cached->elites;
+        }
+        if (snapshot.pickupCount == -1) {
+            snapshot.pickupCount = cached->pickupCount;
+            snapshot.pickupNames = cached->pickupNames;
+        }
+    }
+
+    std::vector<uint8_t> data = CatalogCache::Serialize(snapshot, m_catalogKey);
+
+    std::error_code error;
+    std::filesystem::create_directories(catalogCacheDirectory, error);
+    if (error) {
+        LOG_ERROR("Failed to create %s: %s", catalogCacheDirectory, error.message().c_str());
+        return;
+    }
+
+    // Written next to the old cache and swapped in, so an interrupted write never leaves a partial file in its place
+    std::string tempPath = std::string(catalogCachePath) + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!out) {
+            LOG_ERROR("Failed to write %s", tempPath.c_str());
+            return;
+        }
+    }
+
+    if (!MoveFileExA(tempPath.c_str(), catalogCachePath, MOVEFILE_REPLACE_EXISTING)) {
+        LOG_ERROR("Failed to replace %s: %lu", catalogCachePath, GetLastError());
+        return;
+    }
+
+    LOG_INFO("Saved catalog cache to %s (%zu bytes)", catalogCachePath, data.size());
+}
+
 bool GameFunctions::ApplyEliteToMaster(void* characterMaster, int eliteBuffIndex) {
     if (!characterMaster || eliteBuffIndex <= 0) {
         return false;
@@ -452,14 +677,7 @@ bool GameFunctions::ApplyEliteToMaster(void* characterMaster, int eliteBuffIndex
         return false;
     }
 
-    // Get the eliteDef from the BuffDef using cached class
-    MonoField* eliteDefField = m_runtime->GetField(m_buffDefClass, "eliteDef");
-    if (!eliteDefField) {
-        LOG_ERROR("Failed to find BuffDef.eliteDef field");
-        return false;
-    }
-
-    MonoObject* eliteDef = m_runtime->GetFieldValue<MonoObject*>(buffDef, eliteDefField);
+    MonoObject* eliteDef = m_buffDefEliteDef.Get(m_runtime, buffDef);
     if (!eliteDef) {
         LOG_ERROR("BuffDef at index %d does not have an eliteDef", eliteBuffIndex);
         return false;
@@ -520,16 +738,7 @@ void GameFunctions::Inventory_GiveItem(void* m_inventory, int itemIndex, int cou
         if (!m_inventoryClass)
             return;
 
-        MonoMethod* method = m_runtime->GetMethod(m_inventoryClass, "GiveItem", 2);
-        if (!method) {
-            LOG_ERROR("Failed to find GiveItem method");
-            return;
-        }
-
-        int localItemIndex = itemIndex;
-        int localCount = count;
-        void* params[2] = {&localItemIndex, &localCount};
-        m_runtime->InvokeMethod(method, m_inventory, params);
+        m_inventoryGiveItem.Invoke(m_runtime, m_inventory, itemIndex, count);
     };
     std::unique_lock<std::mutex> lock(G::queuedActionsMutex);
     G::queuedActions.push(task);
@@ -539,7 +748,7 @@ bool GameFunctions::RoR2Application_IsLoading() {
     if (!m_RoR2ApplicationClass)
         return false;
 
-    MonoMethod* method = m_runtime->GetMethod(m_RoR2ApplicationClass, "get_isLoading", 0);
+    MonoMethod* method = m_runtime->Resolve(m_applicationGetIsLoading);
     if (!method) {
         LOG_ERROR("Failed to find get_isLoading method");
         return false;
@@ -558,7 +767,7 @@ bool GameFunctions::RoR2Application_IsLoadFinished() {
     if (!m_RoR2ApplicationClass)
         return false;
 
-    MonoMethod* method = m_runtime->GetMethod(m_RoR2ApplicationClass, "get_loadFinished", 0);
+    MonoMethod* method = m_runtime->Resolve(m_applicationGetLoadFinished);
     if (!method) {
         LOG_ERROR("Failed to find get_loadFinished method");
         return false;
@@ -577,25 +786,14 @@ bool GameFunctions::RoR2Application_IsModded() {
     if (!m_RoR2ApplicationClass)
         return false;
 
-    MonoField* field = m_runtime->GetField(m_RoR2ApplicationClass, "isModded");
-    if (!field) {
-        LOG_ERROR("Failed to find isModded field");
-        return false;
-    }
-    bool isModded = m_runtime->GetStaticFieldValue<bool>(m_RoR2ApplicationClass, field);
-    return isModded;
+    return m_applicationIsModded.Get(m_runtime);
 }
 
 void GameFunctions::RoR2Application_SetModded(bool modded) {
     if (!m_RoR2ApplicationClass)
         return;
 
-    MonoField* field = m_runtime->GetField(m_RoR2ApplicationClass, "isModded");
-    if (!field) {
-        LOG_ERROR("Failed to find isModded field");
-        return;
-    }
-    m_runtime->SetStaticFieldValue<bool>(m_RoR2ApplicationClass, field, modded);
+    m_applicationIsModded.Set(m_runtime, modded);
 }
 
 int GameFunctions::RoR2Application_GetLoadGameContentPercentage() {
@@ -620,13 +818,7 @@ int GameFunctions::RoR2Application_GetLoadGameContentPercentage() {
         return 0;
     }
 
-    MonoField* percentageField = m_runtime->GetField(m_RoR2ApplicationClass, "loadGameContentPercentage");
-    if (!percentageField) {
-        LOG_ERROR("Failed to find loadGameContentPercentage field");
-        return 0;
-    }
-
-    return m_runtime->GetFieldValue<int>(instance, percentageField);
+    return m_applicationLoadPercentage.Get(m_runtime, instance);
 }
 
 void GameFunctions::TeleportHelper_TeleportBody(void* m_characterBody, Vector3 position) {
@@ -662,6 +854,24 @@ float GameFunctions::GetRunStopwatch() {
     }
 }
 
+bool GameFunctions::GetCrosshairWorldPosition(LocalUser* localUser, Vector3& position) {
+    if (!localUser)
+        return false;
+
+    if (G::structLayouts->Matches(GameStructId::LocalUser) && G::structLayouts->Matches(GameStructId::CameraRigController)) {
+        if (!localUser->_cameraRigController)
+            return false;
+        position = localUser->_cameraRigController->crosshairWorldPosition_backing;
+        return true;
+    }
+
+    MonoObject* cameraRig = m_localUserCameraRig.Get(m_runtime, localUser);
+    if (!cameraRig)
+        return false;
+    position = m_cameraRigCrosshairPosition.Get(m_runtime, cameraRig);
+    return true;
+}
+
 bool GameFunctions::SpawnEnemyAtPosition(int masterIndex, Vector3 position, int teamIndex, bool matchDifficulty, int eliteIndex,
                                          const std::vector<std::pair<int, int>>& items) {
     std::function<bool()> task = [this, masterIndex, position, teamIndex, matchDifficulty, eliteIndex, items]() -> bool {
@@ -677,18 +887,7 @@ bool GameFunctions::SpawnEnemyAtPosition(int masterIndex, Vector3 position, int
         if (!masterPrefabsArray)
             return false;
 
-        int masterCount = m_runtime->GetArrayLength(masterPrefabsArray);
-        if (masterIndex < 0 || masterIndex >= masterCount)
-            return false;
-
-        MonoClass* arrayClass = m_runtime->GetObjectClass(static_cast<MonoObject*>(masterPrefabsArray));
-        MonoMethod* getItemMethod = m_runtime->GetMethod(arrayClass, "Get", 1);
-        if (!getItemMethod)
-            return false;
-
-        int localMasterIndex = masterIndex;
-        void* params[1] = {&localMasterIndex};
-        MonoObject* masterPrefab = m_runtime->InvokeMethod(getItemMethod, masterPrefabsArray, params);
+        MonoObject* masterPrefab = MonoArrayView<MonoObject*>(masterPrefabsArray).Get(masterIndex);
         if (!masterPrefab)
             return false;
 
@@ -818,8 +1017,9 @@ void GameFunctions::CacheTeamManagerInstance(TeamManager* instance) { m_cachedTe
 void GameFunctions::ClearTeamManagerInstance() { m_cachedTeamManager = nullptr; }
 
 uint32_t GameFunctions::GetTeamLevel(TeamIndex_Value teamIndex) {
+    // EnemyModule and PlayerModule, which show team levels, are switched off when the TeamManager layout no longer matches
     TeamManager* teamManager = GetTeamManagerInstance();
-    if (!teamManager || !teamManager->teamLevels) {
+    if (!teamManager || !G::structLayouts->Matches(GameStructId::TeamManager) || !teamManager->teamLevels) {
         return 0;
     }
 
@@ -828,8 +1028,7 @@ uint32_t GameFunctions::GetTeamLevel(TeamIndex_Value teamIndex) {
         return 0;
     }
 
-    uint32_t* data = mono_array_addr<uint32_t>(reinterpret_cast<MonoArray_Internal*>(teamManager->teamLevels));
-    return data[index];
+    return MonoArrayView<uint32_t>(teamManager->teamLevels).Get(index);
 }
 
 void GameFunctions::SetTeamLevel(TeamIndex_Value teamIndex, uint32_t level) {
@@ -840,16 +1039,7 @@ void GameFunctions::SetTeamLevel(TeamIndex_Value teamIndex, uint32_t level) {
             return;
         }
 
-        MonoMethod* method = m_runtime->GetMethod(m_teamManagerClass, "SetTeamLevel", 2);
-        if (!method) {
-            LOG_ERROR("SetTeamLevel: Failed to find SetTeamLevel method");
-            return;
-        }
-
-        TeamIndex_Value localTeamIndex = teamIndex;
-        uint32_t localLevel = level;
-        void* params[2] = {&localTeamIndex, &localLevel};
-        m_runtime->InvokeMethod(method, teamManager, params);
+        m_teamManagerSetTeamLevel.Invoke(m_runtime, teamManager, teamIndex, level);
 
         LOG_INFO("SetTeamLevel: Called method for team %d level %u", static_cast<int>(teamIndex), level);
     };
@@ -1015,17 +1205,19 @@ std::vector<std::pair<std::string, GameObject*>> GameFunctions::GetAllBodyPrefab
         return bodyPrefabsWithNames;
     }
 
-    uint32_t arrayLength = static_cast<uint32_t>((reinterpret_cast<MonoArray_Internal*>(bodyPrefabsArray))->max_length);
+    MonoArrayView<GameObject*> prefabs(bodyPrefabsArray);
+    MonoArrayView<CharacterBody*> bodyComponents(bodyComponentsArray);
+    uint32_t arrayLength = static_cast<uint32_t>(prefabs.Size());
     LOG_INFO("GetAllBodyPrefabsWithNames: Found %d body prefabs", arrayLength);
+    bool layoutMatches = G::structLayouts->Matches(GameStructId::CharacterBody);
 
-    GameObject** prefabData = mono_array_addr<GameObject*>(reinterpret_cast<MonoArray_Internal*>(bodyPrefabsArray));
-    CharacterBody** componentData = mono_array_addr<CharacterBody*>(reinterpret_cast<MonoArray_Internal*>(bodyComponentsArray));
+    // Components are looked up by prefab index, prefabs past the end of a shorter components array are skipped
     for (uint32_t i = 0; i < arrayLength; i++) {
-        GameObject* prefab = prefabData[i];
-        CharacterBody* body = componentData[i];
+        GameObject* prefab = prefabs.Get(i);
+        CharacterBody* body = bodyComponents.Get(i);
 
         if (prefab && body) {
-            void* token = body->baseNameToken;
+            void* token = layoutMatches ? body->baseNameToken : m_characterBodyBaseNameToken.Get(m_runtime, body);
             std::string tokenStr;
 
             if (token) {
@@ -1,8 +1,16 @@
 #pragma once
 
+#include "core/MonoFieldAccessor.hpp"
+#include "core/MonoInvoker.hpp"
 #include "core/MonoRuntime.hpp"
 #include "game/GameStructs.hpp"
+#include "utils/CatalogCache.hpp"
 #include "utils/Math.hpp"
+#include "utils/StringArena.hpp"
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
 
 // Nullable<TeamIndex> structure for Mono interop
 #pragma pack(push, 1)
@@ -42,20 +50,82 @@ class GameFunctions {
     MonoClass* expansionReqClass;
     MonoClass* entitlementAbstractionsClass;
 
+    // Hot calls made as direct native calls through unmanaged thunks
+    MonoInvoker<MonoString*(MonoString*)> m_languageGetString{"Assembly-CSharp", "RoR2", "Language", "GetString", false, "System.String", {"System.String"}};
+    // Typed by ItemIndex so the GiveItem(ItemDef, int) overload with the same parameter count isn't picked
+    MonoInvoker<void(void*, int32_t, int32_t)> m_inventoryGiveItem{"Assembly-CSharp", "RoR2", "Inventory", "GiveItem", true, "System.Void",
+                                                                   {"RoR2.ItemIndex", "System.Int32"}};
+    MonoInvoker<void(TeamManager*, TeamIndex_Value, uint32_t)> m_teamManagerSetTeamLevel{"Assembly-CSharp", "RoR2", "TeamManager", "SetTeamLevel", true,
+                                                                                         "System.Void", {"RoR2.TeamIndex", "System.UInt32"}};
+
+    // Members used on hot paths, resolved once through MonoRuntime::Resolve
+    MonoMethodRef m_applicationGetIsLoading{"Assembly-CSharp", "RoR2", "RoR2Application", "get_isLoading", 0};
+    MonoMethodRef m_applicationGetLoadFinished{"Assembly-CSharp", "RoR2", "RoR2Application", "get_loadFinished", 0};
+
+    // Fields read by raw offset, see MonoFieldAccessor
+    MonoFieldAccessor<MonoArray*> m_pickupCatalogEntries{"Assembly-CSharp", "RoR2", "PickupCatalog", "entries", true};
+    MonoFieldAccessor<MonoObject*> m_buffDefEliteDef{"Assembly-CSharp", "RoR2", "BuffDef", "eliteDef", false};
+    MonoFieldAccessor<bool> m_applicationIsModded{"Assembly-CSharp", "RoR2", "RoR2Application", "isModded", true};
+    MonoFieldAccessor<int32_t> m_applicationLoadPercentage{"Assembly-CSharp", "RoR2", "RoR2Application", "loadGameContentPercentage", false};
+    // Used instead of the GameStructs.hpp layouts when StructLayoutValidator finds they no longer match
+    MonoFieldAccessor<MonoObject*> m_localUserCameraRig{"Assembly-CSharp", "RoR2", "LocalUser", "_cameraRigController", false};
+    MonoFieldAccessor<Vector3> m_cameraRigCrosshairPosition{"Assembly-CSharp", "RoR2", "CameraRigController", "<crosshairWorldPosition>k__BackingField", false};
+    MonoFieldAccessor<ItemTierDef*> m_itemDefTierDef{"Assembly-CSharp", "RoR2", "ItemDef", "_itemTierDef", false};
+    MonoFieldAccessor<void*> m_itemDefNameToken{"Assembly-CSharp", "RoR2", "ItemDef", "nameToken", false};
+    MonoFieldAccessor<void*> m_itemDefPickupToken{"Assembly-CSharp", "RoR2", "ItemDef", "pickupToken", false};
+    MonoFieldAccessor<void*> m_itemDefDescriptionToken{"Assembly-CSharp", "RoR2", "ItemDef", "descriptionToken", false};
+    MonoFieldAccessor<void*> m_itemDefLoreToken{"Assembly-CSharp", "RoR2", "ItemDef", "loreToken", false};
+    MonoFieldAccessor<ItemTag*> m_itemDefTags{"Assembly-CSharp", "RoR2", "ItemDef", "tags", false};
+    MonoFieldAccessor<ItemIndex_Value> m_itemDefIndex{"Assembly-CSharp", "RoR2", "ItemDef", "_itemIndex", false};
+    MonoFieldAccessor<ItemTier_Value> m_itemDefDeprecatedTier{"Assembly-CSharp", "RoR2", "ItemDef", "deprecatedTier", false};
+    MonoFieldAccessor<bool> m_itemDefIsConsumed{"Assembly-CSharp", "RoR2", "ItemDef", "isConsumed", false};
+    MonoFieldAccessor<bool> m_itemDefHidden{"Assembly-CSharp", "RoR2", "ItemDef", "hidden", false};
+    MonoFieldAccessor<bool> m_itemDefCanRemove{"Assembly-CSharp", "RoR2", "ItemDef", "canRemove", false};
+    MonoFieldAccessor<ItemTier_Value> m_itemTierDefTier{"Assembly-CSharp", "RoR2", "ItemTierDef", "_tier", false};
+    MonoFieldAccessor<bool> m_itemTierDefIsDroppable{"Assembly-CSharp", "RoR2", "ItemTierDef", "isDroppable", false};
+    MonoFieldAccessor<bool> m_itemTierDefCanScrap{"Assembly-CSharp", "RoR2", "ItemTierDef", "canScrap", false};
+    MonoFieldAccessor<bool> m_itemTierDefCanRestack{"Assembly-CSharp", "RoR2", "ItemTierDef", "canRestack", false};
+    MonoFieldAccessor<void*> m_pickupDefNameToken{"Assembly-CSharp", "RoR2", "PickupDef", "nameToken", false};
+    MonoFieldAccessor<void*> m_characterBodyBaseNameToken{"Assembly-CSharp", "RoR2", "CharacterBody", "baseNameToken", false};
+
     TeamManager* m_cachedTeamManager;
 
+    // Token -> translated text. Keys and values live in m_languageArena, which is never cleared, so views handed out by
+    // Language_GetString stay valid after a language change flushes the map.
+    std::mutex m_languageCacheMutex;
+    std::unordered_map<std::u16string_view, std::string_view> m_languageCache;
+    StringArena m_languageArena;
+
+    // Catalogs from ror2mod/cache written for this game build and language, see LoadCatalogCache. Read-only once loaded.
+    std::unique_ptr<CatalogSnapshot> m_cachedCatalogs;
+    // Sections recorded by this session's live catalog walks, each written by its own loader
+    CatalogSnapshot m_liveCatalogs;
+    uint64_t m_catalogKey = 0;
+
+    bool ComputeCatalogKey(uint64_t& key);
+    // Copies of the defs LoadItems reads, straight from the GameStructs.hpp layout while it matches and field by field otherwise
+    ItemDef ReadItemDef(ItemDef* itemDef);
+    ItemTierDef ReadItemTierDef(ItemTierDef* tierDef);
+
   public:
     GameFunctions(MonoRuntime* runtime);
     ~GameFunctions() = default;
 
     void Cursor_SetLockState(int lockState);
     void Cursor_SetVisible(bool visible);
-    std::string Language_GetString(MonoString* token);
+    // Cached per token until the game's language changes, the view stays valid for the lifetime of GameFunctions
+    std::string_view Language_GetString(MonoString* token);
+    void ClearLanguageCache();
     PickupDef* GetPickupDef(int pickupIndex);
     int LoadPickupNames();
     int LoadItems();
     int LoadEnemies();
     int LoadElites();
+    // Maps the catalog cache if it matches the loaded Assembly-CSharp and the current language. The loaders then skip their
+    // live walk for every catalog whose length is unchanged. Call before them, false means they all walk live.
+    bool LoadCatalogCache();
+    // Writes back the catalogs after any loader had to walk live, run once all loaders have finished
+    void SaveCatalogCache();
     bool ApplyEliteToMaster(void* characterMaster, int eliteIndex);
     void Inventory_GiveItem(void* m_inventory, int itemIndex, int count);
     bool RoR2Application_IsLoading();
@@ -65,6 +135,8 @@ class GameFunctions {
     int RoR2Application_GetLoadGameContentPercentage();
     void TeleportHelper_TeleportBody(void* m_characterBody, Vector3 position);
     float GetRunStopwatch();
+    // False if the local user has no camera rig yet
+    bool GetCrosshairWorldPosition(LocalUser* localUser, Vector3& position);
     bool SpawnEnemyAtPosition(int masterIndex, Vector3 position, int teamIndex = 2, bool matchDifficulty = false, int eliteIndex = 0,
                               const std::vector<std::pair<int, int>>& items = {});
 
@@ -0,0 +1,2213 @@
+// Generated by scripts/generate_struct_layouts.py from GameStructs.hpp, do not edit
+#include "GameStructLayouts.hpp"
+#include "GameStructs.hpp"
+
+static const GameStructField CameraState_ValueFields[] = {
+    {"position", offsetof(CameraState_Value, position)},
+    {"rotation", offsetof(CameraState_Value, rotation)},
+    {"fov", offsetof(CameraState_Value, fov)},
+};
+
+static const GameStructField CharacterCameraParamsData_ValueFields[] = {
+    {"minPitch", offsetof(CharacterCameraParamsData_Value, minPitch)},
+    {"maxPitch", offsetof(CharacterCameraParamsData_Value, maxPitch)},
+    {"wallCushion", offsetof(CharacterCameraParamsData_Value, wallCushion)},
+    {"pivotVerticalOffset", offsetof(CharacterCameraParamsData_Value, pivotVerticalOffset)},
+    {"idealLocalCameraPos", offsetof(CharacterCameraParamsData_Value, idealLocalCameraPos)},
+    {"fov", offsetof(CharacterCameraParamsData_Value, fov)},
+    {"isFirstPerson", offsetof(CharacterCameraParamsData_Value, isFirstPerson)},
+    {"overrideFirstPersonFadeDuration", offsetof(CharacterCameraParamsData_Value, overrideFirstPersonFadeDuration)},
+};
+
+static const GameStructField RtpcSetter_ValueFields[] = {
+    {"name", offsetof(RtpcSetter_Value, name)},
+    {"id", offsetof(RtpcSetter_Value, id)},
+    {"gameObject", offsetof(RtpcSetter_Value, gameObject)},
+    {"expectedEngineValue", offsetof(RtpcSetter_Value, expectedEngineValue)},
+    {"value", offsetof(RtpcSetter_Value, value)},
+    {"gameObjectIsNull", offsetof(RtpcSetter_Value, gameObjectIsNull)},
+};
+
+static const GameStructField Ray_ValueFields[] = {
+    {"m_Origin", offsetof(Ray_Value, m_Origin)},
+    {"m_Direction", offsetof(Ray_Value, m_Direction)},
+};
+
+static const GameStructField RaycastHit_ValueFields[] = {
+    {"m_Point", offsetof(RaycastHit_Value, m_Point)},
+    {"m_Normal", offsetof(RaycastHit_Value, m_Normal)},
+    {"m_FaceID", offsetof(RaycastHit_Value, m_FaceID)},
+    {"m_Distance", offsetof(RaycastHit_Value, m_Distance)},
+    {"m_UV", offsetof(RaycastHit_Value, m_UV)},
+    {"m_Collider", offsetof(RaycastHit_Value, m_Collider)},
+};
+
+static const GameStructField NetworkUserId_ValueFields[] = {
+    {"value", offsetof(NetworkUserId_Value, value)},
+    {"strValue", offsetof(NetworkUserId_Value, strValue)},
+    {"subId", offsetof(NetworkUserId_Value, subId)},
+};
+
+static const GameStructField PassiveSkill_ValueFields[] = {
+    {"enabled", offsetof(PassiveSkill_Value, enabled)},
+    {"skillNameToken", offsetof(PassiveSkill_Value, skillNameToken)},
+    {"skillDescriptionToken", offsetof(PassiveSkill_Value, skillDescriptionToken)},
+    {"keywordToken", offsetof(PassiveSkill_Value, keywordToken)},
+    {"icon", offsetof(PassiveSkill_Value, icon)},
+};
+
+static const GameStructField UniquePickup_ValueFields[] = {
+    {"pickupIndex", offsetof(UniquePickup_Value, pickupIndex)},
+    {"decayValue", offsetof(UniquePickup_Value, decayValue)},
+    {"upgradeValue", offsetof(UniquePickup_Value, upgradeValue)},
+};
+
+static const GameStructField RangeFloat_ValueFields[] = {
+    {"min", offsetof(RangeFloat_Value, min)},
+    {"max", offsetof(RangeFloat_Value, max)},
+};
+
+static const GameStructField ItemCollection_ValueFields[] = {
+    {"inner", offsetof(ItemCollection_Value, inner)},
+};
+
+static const GameStructField Wave_ValueFields[] = {
+    {"amplitude", offsetof(Wave_Value, amplitude)},
+    {"frequency", offsetof(Wave_Value, frequency)},
+    {"cycleOffset", offsetof(Wave_Value, cycleOffset)},
+};
+
+static const GameStructField NetworkGuid_ValueFields[] = {
+    {"_a", offsetof(NetworkGuid_Value, _a)},
+    {"_b", offsetof(NetworkGuid_Value, _b)},
+};
+
+static const GameStructField NetworkDateTime_ValueFields[] = {
+    {"_binaryValue", offsetof(NetworkDateTime_Value, _binaryValue)},
+};
+
+static const GameStructField CharacterGravityParameters_ValueFields[] = {
+    {"environmentalAntiGravityGranterCount", offsetof(CharacterGravityParameters_Value, environmentalAntiGravityGranterCount)},
+    {"antiGravityNeutralizerCount", offsetof(CharacterGravityParameters_Value, antiGravityNeutralizerCount)},
+    {"channeledAntiGravityGranterCount", offsetof(CharacterGravityParameters_Value, channeledAntiGravityGranterCount)},
+};
+
+static const GameStructField CharacterFlightParameters_ValueFields[] = {
+    {"channeledFlightGranterCount", offsetof(CharacterFlightParameters_Value, channeledFlightGranterCount)},
+};
+
+static const GameStructField HealthComponentFields[] = {
+    {"body", offsetof(HealthComponent, body)},
+    {"modelLocator", offsetof(HealthComponent, modelLocator)},
+    {"painAnimationHandler", offsetof(HealthComponent, painAnimationHandler)},
+    {"onIncomingDamageReceivers", offsetof(HealthComponent, onIncomingDamageReceivers)},
+    {"onTakeDamageReceivers", offsetof(HealthComponent, onTakeDamageReceivers)},
+    {"screenDamageCalculator", offsetof(HealthComponent, screenDamageCalculator)},
+    {"<lastHitAttacker>k__BackingField", offsetof(HealthComponent, lastHitAttacker_backing)},
+    {"repeatHealComponent", offsetof(HealthComponent, repeatHealComponent)},
+    {"health", offsetof(HealthComponent, health)},
+    {"shield", offsetof(HealthComponent, shield)},
+    {"echoDamage", offsetof(HealthComponent, echoDamage)},
+    {"_killingDamageTypeExt", offsetof(HealthComponent, _killingDamageTypeExt)},
+    {"barrier", offsetof(HealthComponent, barrier)},
+    {"magnetiCharge", offsetof(HealthComponent, magnetiCharge)},
+    {"dontShowHealthbar", offsetof(HealthComponent, dontShowHealthbar)},
+    {"isDefaultGodMode", offsetof(HealthComponent, isDefaultGodMode)},
+    {"recentlyTookDamageCoyoteTimer", offsetof(HealthComponent, recentlyTookDamageCoyoteTimer)},
+    {"globalDeathEventChanceCoefficient", offsetof(HealthComponent, globalDeathEventChanceCoefficient)},
+    {"_killingDamageType", offsetof(HealthComponent, _killingDamageType)},
+    {"destroyModelOnDeath", offsetof(HealthComponent, destroyModelOnDeath)},
+    {"<lastHitTime>k__BackingField", offsetof(HealthComponent, lastHitTime_backing)},
+    {"<lastHealTime>k__BackingField", offsetof(HealthComponent, lastHealTime_backing)},
+    {"<godMode>k__BackingField", offsetof(HealthComponent, godMode_backing)},
+    {"<potionReserve>k__BackingField", offsetof(HealthComponent, potionReserve_backing)},
+    {"<isInFrozenState>k__BackingField", offsetof(HealthComponent, isInFrozenState_backing)},
+    {"<distributeDamage>k__BackingField", offsetof(HealthComponent, distributeDamage_backing)},
+    {"isRepairing", offsetof(HealthComponent, isRepairing)},
+    {"devilOrbHealPool", offsetof(HealthComponent, devilOrbHealPool)},
+    {"devilOrbTimer", offsetof(HealthComponent, devilOrbTimer)},
+    {"regenAccumulator", offsetof(HealthComponent, regenAccumulator)},
+    {"wasAlive", offsetof(HealthComponent, wasAlive)},
+    {"adaptiveArmorValue", offsetof(HealthComponent, adaptiveArmorValue)},
+    {"isShieldRegenForced", offsetof(HealthComponent, isShieldRegenForced)},
+    {"forceCulled", offsetof(HealthComponent, forceCulled)},
+    {"forceHideBody", offsetof(HealthComponent, forceHideBody)},
+    {"hadBarrier", offsetof(HealthComponent, hadBarrier)},
+    {"ospTimer", offsetof(HealthComponent, ospTimer)},
+    {"serverDamageTakenThisUpdate", offsetof(HealthComponent, serverDamageTakenThisUpdate)},
+    {"itemCounts", offsetof(HealthComponent, itemCounts)},
+    {"currentEquipmentIndex", offsetof(HealthComponent, currentEquipmentIndex)},
+};
+
+static const GameStructField EquipmentStateFields[] = {
+    {"equipmentIndex", offsetof(EquipmentState, equipmentIndex)},
+    {"chargeFinishTime", offsetof(EquipmentState, chargeFinishTime)},
+    {"charges", offsetof(EquipmentState, charges)},
+    {"isDisabled", offsetof(EquipmentState, isDisabled)},
+    {"dirty", offsetof(EquipmentState, dirty)},
+    {"equipmentDef", offsetof(EquipmentState, equipmentDef)},
+};
+
+static const GameStructField InventoryFields[] = {
+    {"permanentItemStacks", offsetof(Inventory, permanentItemStacks)},
+    {"channeledItemStacks", offsetof(Inventory, channeledItemStacks)},
+    {"tempItemsStorage", offsetof(Inventory, tempItemsStorage)},
+    {"effectiveItemStacks", offsetof(Inventory, effectiveItemStacks)},
+    {"itemAcquisitionOrder", offsetof(Inventory, itemAcquisitionOrder)},
+    {"itemAcquisitionSet", offsetof(Inventory, itemAcquisitionSet)},
+    {"onInventoryChanged", offsetof(Inventory, onInventoryChanged)},
+    {"onEquipmentExternalRestockServer", offsetof(Inventory, onEquipmentExternalRestockServer)},
+    {"_activeEquipmentSet", offsetof(Inventory, _activeEquipmentSet)},
+    {"_equipmentStateSlots", offsetof(Inventory, _equipmentStateSlots)},
+    {"onItemAddedClient", offsetof(Inventory, onItemAddedClient)},
+    {"onEquipmentChangedClient", offsetof(Inventory, onEquipmentChangedClient)},
+    {"_lastExtraEquipmentCount", offsetof(Inventory, _lastExtraEquipmentCount)},
+    {"<activeEquipmentSlot>k__BackingField", offsetof(Inventory, activeEquipmentSlot_backing)},
+    {"_activeEquipmentDirty", offsetof(Inventory, _activeEquipmentDirty)},
+    {"wasRecentlyExtraEquipmentSwapped", offsetof(Inventory, wasRecentlyExtraEquipmentSwapped)},
+    {"wasRecentlyCreated", offsetof(Inventory, wasRecentlyCreated)},
+    {"equipmentDisabled", offsetof(Inventory, equipmentDisabled)},
+    {"inventoryDisablerCountServer", offsetof(Inventory, inventoryDisablerCountServer)},
+    {"_inventoryDisabled", offsetof(Inventory, _inventoryDisabled)},
+    {"inventoryChangeScopeCounter", offsetof(Inventory, inventoryChangeScopeCounter)},
+    {"beadAppliedHealth", offsetof(Inventory, beadAppliedHealth)},
+    {"beadAppliedShield", offsetof(Inventory, beadAppliedShield)},
+    {"beadAppliedRegen", offsetof(Inventory, beadAppliedRegen)},
+    {"beadAppliedDamage", offsetof(Inventory, beadAppliedDamage)},
+    {"<infusionBonus>k__BackingField", offsetof(Inventory, infusionBonus_backing)},
+};
+
+static const GameStructField TeamComponentFields[] = {
+    {"<body>k__BackingField", offsetof(TeamComponent, body_backing)},
+    {"defaultIndicatorPrefab", offsetof(TeamComponent, defaultIndicatorPrefab)},
+    {"indicator", offsetof(TeamComponent, indicator)},
+    {"hideAllyCardDisplay", offsetof(TeamComponent, hideAllyCardDisplay)},
+    {"_teamIndex", offsetof(TeamComponent, _teamIndex)},
+    {"oldTeamIndex", offsetof(TeamComponent, oldTeamIndex)},
+};
+
+static const GameStructField CharacterMotorFields[] = {
+    {"characterDirection", offsetof(CharacterMotor, characterDirection)},
+    {"ignoredRigidbodies", offsetof(CharacterMotor, ignoredRigidbodies)},
+    {"networkIdentity", offsetof(CharacterMotor, networkIdentity)},
+    {"body", offsetof(CharacterMotor, body)},
+    {"capsuleCollider", offsetof(CharacterMotor, capsuleCollider)},
+    {"<currentGround>k__BackingField", offsetof(CharacterMotor, currentGround_backing)},
+    {"onHitGroundAuthority", offsetof(CharacterMotor, onHitGroundAuthority)},
+    {"onMotorStart", offsetof(CharacterMotor, onMotorStart)},
+    {"onMovementHit", offsetof(CharacterMotor, onMovementHit)},
+    {"walkSpeedPenaltyModifiers", offsetof(CharacterMotor, walkSpeedPenaltyModifiers)},
+    {"walkSpeedPenaltyCoefficient", offsetof(CharacterMotor, walkSpeedPenaltyCoefficient)},
+    {"gravityScale", offsetof(CharacterMotor, gravityScale)},
+    {"muteWalkMotion", offsetof(CharacterMotor, muteWalkMotion)},
+    {"mass", offsetof(CharacterMotor, mass)},
+    {"airControl", offsetof(CharacterMotor, airControl)},
+    {"disableAirControlUntilCollision", offsetof(CharacterMotor, disableAirControlUntilCollision)},
+    {"generateParametersOnAwake", offsetof(CharacterMotor, generateParametersOnAwake)},
+    {"doNotTriggerJumpVolumes", offsetof(CharacterMotor, doNotTriggerJumpVolumes)},
+    {"alive", offsetof(CharacterMotor, alive)},
+    {"restStopwatch", offsetof(CharacterMotor, restStopwatch)},
+    {"previousPosition", offsetof(CharacterMotor, previousPosition)},
+    {"<hasEffectiveAuthority>k__BackingField", offsetof(CharacterMotor, hasEffectiveAuthority_backing)},
+    {"isAirControlForced", offsetof(CharacterMotor, isAirControlForced)},
+    {"jumpCount", offsetof(CharacterMotor, jumpCount)},
+    {"netIsGrounded", offsetof(CharacterMotor, netIsGrounded)},
+    {"netGroundNormal", offsetof(CharacterMotor, netGroundNormal)},
+    {"velocity", offsetof(CharacterMotor, velocity)},
+    {"lastVelocity", offsetof(CharacterMotor, lastVelocity)},
+    {"rootMotion", offsetof(CharacterMotor, rootMotion)},
+    {"_moveDirection", offsetof(CharacterMotor, _moveDirection)},
+    {"<initialCapsuleHeight>k__BackingField", offsetof(CharacterMotor, initialCapsuleHeight_backing)},
+    {"<initialCapsuleRadius>k__BackingField", offsetof(CharacterMotor, initialCapsuleRadius_backing)},
+    {"<lastGroundedTime>k__BackingField", offsetof(CharacterMotor, lastGroundedTime_backing)},
+    {"_safeCollisionEnableCount", offsetof(CharacterMotor, _safeCollisionEnableCount)},
+    {"minWalkSpeedPenaltyCoefficient", offsetof(CharacterMotor, minWalkSpeedPenaltyCoefficient)},
+    {"_gravityParameters", offsetof(CharacterMotor, _gravityParameters)},
+    {"<useGravity>k__BackingField", offsetof(CharacterMotor, useGravity_backing)},
+    {"useHangtimeGravity", offsetof(CharacterMotor, useHangtimeGravity)},
+    {"useCustomGravity", offsetof(CharacterMotor, useCustomGravity)},
+    {"CustomGravity", offsetof(CharacterMotor, CustomGravity)},
+    {"_flightParameters", offsetof(CharacterMotor, _flightParameters)},
+    {"<isFlying>k__BackingField", offsetof(CharacterMotor, isFlying_backing)},
+};
+
+static const GameStructField ModelLocatorFields[] = {
+    {"_modelTransform", offsetof(ModelLocator, _modelTransform)},
+    {"modelVisibility", offsetof(ModelLocator, modelVisibility)},
+    {"modelDestructionNotifier", offsetof(ModelLocator, modelDestructionNotifier)},
+    {"modelBaseTransform", offsetof(ModelLocator, modelBaseTransform)},
+    {"onModelChanged", offsetof(ModelLocator, onModelChanged)},
+    {"modelParentTransform", offsetof(ModelLocator, modelParentTransform)},
+    {"logbookOverrideBodyName", offsetof(ModelLocator, logbookOverrideBodyName)},
+    {"cachedModelChildLocator", offsetof(ModelLocator, cachedModelChildLocator)},
+    {"characterMotor", offsetof(ModelLocator, characterMotor)},
+    {"modelScaleCompensation", offsetof(ModelLocator, modelScaleCompensation)},
+    {"initialScale", offsetof(ModelLocator, initialScale)},
+    {"initialPosition", offsetof(ModelLocator, initialPosition)},
+    {"initialRotation", offsetof(ModelLocator, initialRotation)},
+    {"autoUpdateModelTransform", offsetof(ModelLocator, autoUpdateModelTransform)},
+    {"dontDetatchFromParent", offsetof(ModelLocator, dontDetatchFromParent)},
+    {"noCorpse", offsetof(ModelLocator, noCorpse)},
+    {"dontReleaseModelOnDeath", offsetof(ModelLocator, dontReleaseModelOnDeath)},
+    {"preserveModel", offsetof(ModelLocator, preserveModel)},
+    {"forceCulled", offsetof(ModelLocator, forceCulled)},
+    {"normalizeToFloor", offsetof(ModelLocator, normalizeToFloor)},
+    {"normalSmoothdampTime", offsetof(ModelLocator, normalSmoothdampTime)},
+    {"normalMaxAngleDelta", offsetof(ModelLocator, normalMaxAngleDelta)},
+    {"shouldOverrideLogbookModel", offsetof(ModelLocator, shouldOverrideLogbookModel)},
+    {"normalSmoothdampVelocity", offsetof(ModelLocator, normalSmoothdampVelocity)},
+    {"targetNormal", offsetof(ModelLocator, targetNormal)},
+    {"currentNormal", offsetof(ModelLocator, currentNormal)},
+};
+
+static const GameStructField CharacterBodyFields[] = {
+    {"onRecalculateStats", offsetof(CharacterBody, onRecalculateStats)},
+    {"baseNameToken", offsetof(CharacterBody, baseNameToken)},
+    {"subtitleNameToken", offsetof(CharacterBody, subtitleNameToken)},
+    {"onJump", offsetof(CharacterBody, onJump)},
+    {"activeBuffsList", offsetof(CharacterBody, activeBuffsList)},
+    {"buffs", offsetof(CharacterBody, buffs)},
+    {"timedBuffs", offsetof(CharacterBody, timedBuffs)},
+    {"warCryEffectInstance", offsetof(CharacterBody, warCryEffectInstance)},
+    {"_masterObject", offsetof(CharacterBody, _masterObject)},
+    {"_master", offsetof(CharacterBody, _master)},
+    {"<inventory>k__BackingField", offsetof(CharacterBody, inventory_backing)},
+    {"onInventoryChanged", offsetof(CharacterBody, onInventoryChanged)},
+    {"transform", offsetof(CharacterBody, transform)},
+    {"<rigidbody>k__BackingField", offsetof(CharacterBody, rigidbody_backing)},
+    {"<networkIdentity>k__BackingField", offsetof(CharacterBody, networkIdentity_backing)},
+    {"<characterMotor>k__BackingField", offsetof(CharacterBody, characterMotor_backing)},
+    {"<characterDirection>k__BackingField", offsetof(CharacterBody, characterDirection_backing)},
+    {"<teamComponent>k__BackingField", offsetof(CharacterBody, teamComponent_backing)},
+    {"<healthComponent>k__BackingField", offsetof(CharacterBody, healthComponent_backing)},
+    {"<equipmentSlot>k__BackingField", offsetof(CharacterBody, equipmentSlot_backing)},
+    {"<inputBank>k__BackingField", offsetof(CharacterBody, inputBank_backing)},
+    {"<skillLocator>k__BackingField", offsetof(CharacterBody, skillLocator_backing)},
+    {"<sfxLocator>k__BackingField", offsetof(CharacterBody, sfxLocator_backing)},
+    {"<modelLocator>k__BackingField", offsetof(CharacterBody, modelLocator_backing)},
+    {"<hurtBoxGroup>k__BackingField", offsetof(CharacterBody, hurtBoxGroup_backing)},
+    {"<mainHurtBox>k__BackingField", offsetof(CharacterBody, mainHurtBox_backing)},
+    {"<coreTransform>k__BackingField", offsetof(CharacterBody, coreTransform_backing)},
+    {"onSkillActivatedServer", offsetof(CharacterBody, onSkillActivatedServer)},
+    {"onSkillActivatedAuthority", offsetof(CharacterBody, onSkillActivatedAuthority)},
+    {"onReleaseBodyTriggeredServer", offsetof(CharacterBody, onReleaseBodyTriggeredServer)},
+    {"speedOnPickupEvents", offsetof(CharacterBody, speedOnPickupEvents)},
+    {"extraStatsOnLevelUpScrapEffectInstance", offsetof(CharacterBody, extraStatsOnLevelUpScrapEffectInstance)},
+    {"increaseDamageOnMultiKillItemDisplayUpdater", offsetof(CharacterBody, increaseDamageOnMultiKillItemDisplayUpdater)},
+    {"screenDamageSkillsDisabled", offsetof(CharacterBody, screenDamageSkillsDisabled)},
+    {"boostAllStatsDisplay", offsetof(CharacterBody, boostAllStatsDisplay)},
+    {"OnNetworkItemBehaviorUpdate", offsetof(CharacterBody, OnNetworkItemBehaviorUpdate)},
+    {"helfireController", offsetof(CharacterBody, helfireController)},
+    {"fireTrail", offsetof(CharacterBody, fireTrail)},
+    {"lunarMissilePrefab", offsetof(CharacterBody, lunarMissilePrefab)},
+    {"timeBubbleWardInstance", offsetof(CharacterBody, timeBubbleWardInstance)},
+    {"engiShieldTempEffectInstance", offsetof(CharacterBody, engiShieldTempEffectInstance)},
+    {"bucklerShieldTempEffectInstance", offsetof(CharacterBody, bucklerShieldTempEffectInstance)},
+    {"slowDownTimeTempEffectInstance", offsetof(CharacterBody, slowDownTimeTempEffectInstance)},
+    {"crippleEffectInstance", offsetof(CharacterBody, crippleEffectInstance)},
+    {"tonicBuffEffectInstance", offsetof(CharacterBody, tonicBuffEffectInstance)},
+    {"weakTempEffectInstance", offsetof(CharacterBody, weakTempEffectInstance)},
+    {"energizedTempEffectInstance", offsetof(CharacterBody, energizedTempEffectInstance)},
+    {"barrierTempEffectInstance", offsetof(CharacterBody, barrierTempEffectInstance)},
+    {"nullifyStack1EffectInstance", offsetof(CharacterBody, nullifyStack1EffectInstance)},
+    {"nullifyStack2EffectInstance", offsetof(CharacterBody, nullifyStack2EffectInstance)},
+    {"nullifyStack3EffectInstance", offsetof(CharacterBody, nullifyStack3EffectInstance)},
+    {"regenBoostEffectInstance", offsetof(CharacterBody, regenBoostEffectInstance)},
+    {"elephantDefenseEffectInstance", offsetof(CharacterBody, elephantDefenseEffectInstance)},
+    {"healingDisabledEffectInstance", offsetof(CharacterBody, healingDisabledEffectInstance)},
+    {"noCooldownEffectInstance", offsetof(CharacterBody, noCooldownEffectInstance)},
+    {"doppelgangerEffectInstance", offsetof(CharacterBody, doppelgangerEffectInstance)},
+    {"deathmarkEffectInstance", offsetof(CharacterBody, deathmarkEffectInstance)},
+    {"crocoRegenEffectInstance", offsetof(CharacterBody, crocoRegenEffectInstance)},
+    {"mercExposeEffectInstance", offsetof(CharacterBody, mercExposeEffectInstance)},
+    {"lifestealOnHitEffectInstance", offsetof(CharacterBody, lifestealOnHitEffectInstance)},
+    {"teamWarCryEffectInstance", offsetof(CharacterBody, teamWarCryEffectInstance)},
+    {"randomDamageEffectInstance", offsetof(CharacterBody, randomDamageEffectInstance)},
+    {"lunarGolemShieldEffectInstance", offsetof(CharacterBody, lunarGolemShieldEffectInstance)},
+    {"warbannerEffectInstance", offsetof(CharacterBody, warbannerEffectInstance)},
+    {"teslaFieldEffectInstance", offsetof(CharacterBody, teslaFieldEffectInstance)},
+    {"lunarSecondaryRootEffectInstance", offsetof(CharacterBody, lunarSecondaryRootEffectInstance)},
+    {"lunarDetonatorEffectInstance", offsetof(CharacterBody, lunarDetonatorEffectInstance)},
+    {"fruitingEffectInstance", offsetof(CharacterBody, fruitingEffectInstance)},
+    {"overheatEffectInstance", offsetof(CharacterBody, overheatEffectInstance)},
+    {"mushroomVoidTempEffectInstance", offsetof(CharacterBody, mushroomVoidTempEffectInstance)},
+    {"bearVoidTempEffectInstance", offsetof(CharacterBody, bearVoidTempEffectInstance)},
+    {"outOfCombatArmorEffectInstance", offsetof(CharacterBody, outOfCombatArmorEffectInstance)},
+    {"voidFogMildEffectInstance", offsetof(CharacterBody, voidFogMildEffectInstance)},
+    {"voidFogStrongEffectInstance", offsetof(CharacterBody, voidFogStrongEffectInstance)},
+    {"voidJailerSlowEffectInstance", offsetof(CharacterBody, voidJailerSlowEffectInstance)},
+    {"voidRaidcrabWardWipeFogEffectInstance", offsetof(CharacterBody, voidRaidcrabWardWipeFogEffectInstance)},
+    {"aurelioniteBlessingEffectInstance", offsetof(CharacterBody, aurelioniteBlessingEffectInstance)},
+    {"growthNectarMaxGlowInstance", offsetof(CharacterBody, growthNectarMaxGlowInstance)},
+    {"delayedDamageBuffUpInstance", offsetof(CharacterBody, delayedDamageBuffUpInstance)},
+    {"knockbackHitEnemiesVulnerableInstance", offsetof(CharacterBody, knockbackHitEnemiesVulnerableInstance)},
+    {"falseSonMeridianWillCoreBuffInstance", offsetof(CharacterBody, falseSonMeridianWillCoreBuffInstance)},
+    {"nanoBugEffectInstance", offsetof(CharacterBody, nanoBugEffectInstance)},
+    {"shieldTankDamageEffectInstance", offsetof(CharacterBody, shieldTankDamageEffectInstance)},
+    {"DroneShockDamageActivateInstance", offsetof(CharacterBody, DroneShockDamageActivateInstance)},
+    {"DroneShockDamageActivateOnDroneInstance", offsetof(CharacterBody, DroneShockDamageActivateOnDroneInstance)},
+    {"DroneShockDamageSpreadInstance", offsetof(CharacterBody, DroneShockDamageSpreadInstance)},
+    {"nullify2Stack1EffectInstance", offsetof(CharacterBody, nullify2Stack1EffectInstance)},
+    {"nullify2Stack2EffectInstance", offsetof(CharacterBody, nullify2Stack2EffectInstance)},
+    {"nullify2Stack3EffectInstance", offsetof(CharacterBody, nullify2Stack3EffectInstance)},
+    {"AccelerantGooedInstance", offsetof(CharacterBody, AccelerantGooedInstance)},
+    {"sharedSufferingInstance", offsetof(CharacterBody, sharedSufferingInstance)},
+    {"TransferDebuffInstance", offsetof(CharacterBody, TransferDebuffInstance)},
+    {"SureProcInstance", offsetof(CharacterBody, SureProcInstance)},
+    {"jailerDroneCagedEffectInstance", offsetof(CharacterBody, jailerDroneCagedEffectInstance)},
+    {"spreadBloomCurve", offsetof(CharacterBody, spreadBloomCurve)},
+    {"_defaultCrosshairPrefab", offsetof(CharacterBody, _defaultCrosshairPrefab)},
+    {"sprintCrosshairPrefabOverride", offsetof(CharacterBody, sprintCrosshairPrefabOverride)},
+    {"secondHalfOfDamage", offsetof(CharacterBody, secondHalfOfDamage)},
+    {"incomingDamageList", offsetof(CharacterBody, incomingDamageList)},
+    {"runicLensDamageInfo", offsetof(CharacterBody, runicLensDamageInfo)},
+    {"meteorVictimBody", offsetof(CharacterBody, meteorVictimBody)},
+    {"onShardSpawnedEvent", offsetof(CharacterBody, onShardSpawnedEvent)},
+    {"aimOriginTransform", offsetof(CharacterBody, aimOriginTransform)},
+    {"scanOverrideTransform", offsetof(CharacterBody, scanOverrideTransform)},
+    {"portraitIcon", offsetof(CharacterBody, portraitIcon)},
+    {"altDeathBodyName", offsetof(CharacterBody, altDeathBodyName)},
+    {"vehicleIdleStateMachine", offsetof(CharacterBody, vehicleIdleStateMachine)},
+    {"currentVehicle", offsetof(CharacterBody, currentVehicle)},
+    {"preferredPodPrefab", offsetof(CharacterBody, preferredPodPrefab)},
+    {"preferredInitialStateType", offsetof(CharacterBody, preferredInitialStateType)},
+    {"customKillTotalStatName", offsetof(CharacterBody, customKillTotalStatName)},
+    {"overrideCoreTransform", offsetof(CharacterBody, overrideCoreTransform)},
+    {"bodyIndex", offsetof(CharacterBody, bodyIndex)},
+    {"altDeathEventBodyIndex", offsetof(CharacterBody, altDeathEventBodyIndex)},
+    {"CharacterIsVisible", offsetof(CharacterBody, CharacterIsVisible)},
+    {"cost", offsetof(CharacterBody, cost)},
+    {"dontCull", offsetof(CharacterBody, dontCull)},
+    {"BaseImportance", offsetof(CharacterBody, BaseImportance)},
+    {"Importance", offsetof(CharacterBody, Importance)},
+    {"inLava", offsetof(CharacterBody, inLava)},
+    {"activeBuffsListCount", offsetof(CharacterBody, activeBuffsListCount)},
+    {"eliteBuffCount", offsetof(CharacterBody, eliteBuffCount)},
+    {"pendingTonicAfflictionCount", offsetof(CharacterBody, pendingTonicAfflictionCount)},
+    {"previousMultiKillBuffCount", offsetof(CharacterBody, previousMultiKillBuffCount)},
+    {"bodyFlags", offsetof(CharacterBody, bodyFlags)},
+    {"masterObjectId", offsetof(CharacterBody, masterObjectId)},
+    {"linkedToMaster", offsetof(CharacterBody, linkedToMaster)},
+    {"<isPlayerControlled>k__BackingField", offsetof(CharacterBody, isPlayerControlled_backing)},
+    {"disablingHurtBoxes", offsetof(CharacterBody, disablingHurtBoxes)},
+    {"previousEquipmentIndex", offsetof(CharacterBody, previousEquipmentIndex)},
+    {"<executeEliteHealthFraction>k__BackingField", offsetof(CharacterBody, executeEliteHealthFraction_backing)},
+    {"<isRemoteOp>k__BackingField", offsetof(CharacterBody, isRemoteOp_backing)},
+    {"lavaCooldown", offsetof(CharacterBody, lavaCooldown)},
+    {"lavaTimer", offsetof(CharacterBody, lavaTimer)},
+    {"itemAvailability", offsetof(CharacterBody, itemAvailability)},
+    {"<hasEffectiveAuthority>k__BackingField", offsetof(CharacterBody, hasEffectiveAuthority_backing)},
+    {"_isSprinting", offsetof(CharacterBody, _isSprinting)},
+    {"outOfCombatStopwatch", offsetof(CharacterBody, outOfCombatStopwatch)},
+    {"outOfDangerStopwatch", offsetof(CharacterBody, outOfDangerStopwatch)},
+    {"<outOfCombat>k__BackingField", offsetof(CharacterBody, outOfCombat_backing)},
+    {"_outOfDanger", offsetof(CharacterBody, _outOfDanger)},
+    {"shieldBrokeSinceDangerCheck", offsetof(CharacterBody, shieldBrokeSinceDangerCheck)},
+    {"previousPosition", offsetof(CharacterBody, previousPosition)},
+    {"notMovingStopwatch", offsetof(CharacterBody, notMovingStopwatch)},
+    {"rootMotionInMainState", offsetof(CharacterBody, rootMotionInMainState)},
+    {"mainRootSpeed", offsetof(CharacterBody, mainRootSpeed)},
+    {"baseMaxHealth", offsetof(CharacterBody, baseMaxHealth)},
+    {"baseRegen", offsetof(CharacterBody, baseRegen)},
+    {"baseMaxShield", offsetof(CharacterBody, baseMaxShield)},
+    {"baseMoveSpeed", offsetof(CharacterBody, baseMoveSpeed)},
+    {"baseAcceleration", offsetof(CharacterBody, baseAcceleration)},
+    {"baseJumpPower", offsetof(CharacterBody, baseJumpPower)},
+    {"baseDamage", offsetof(CharacterBody, baseDamage)},
+    {"baseAttackSpeed", offsetof(CharacterBody, baseAttackSpeed)},
+    {"baseCrit", offsetof(CharacterBody, baseCrit)},
+    {"baseArmor", offsetof(CharacterBody, baseArmor)},
+    {"baseVisionDistance", offsetof(CharacterBody, baseVisionDistance)},
+    {"baseJumpCount", offsetof(CharacterBody, baseJumpCount)},
+    {"sprintingSpeedMultiplier", offsetof(CharacterBody, sprintingSpeedMultiplier)},
+    {"autoCalculateLevelStats", offsetof(CharacterBody, autoCalculateLevelStats)},
+    {"levelMaxHealth", offsetof(CharacterBody, levelMaxHealth)},
+    {"levelRegen", offsetof(CharacterBody, levelRegen)},
+    {"levelMaxShield", offsetof(CharacterBody, levelMaxShield)},
+    {"levelMoveSpeed", offsetof(CharacterBody, levelMoveSpeed)},
+    {"levelJumpPower", offsetof(CharacterBody, levelJumpPower)},
+    {"levelDamage", offsetof(CharacterBody, levelDamage)},
+    {"levelAttackSpeed", offsetof(CharacterBody, levelAttackSpeed)},
+    {"levelCrit", offsetof(CharacterBody, levelCrit)},
+    {"levelArmor", offsetof(CharacterBody, levelArmor)},
+    {"<experience>k__BackingField", offsetof(CharacterBody, experience_backing)},
+    {"<level>k__BackingField", offsetof(CharacterBody, level_backing)},
+    {"<maxHealth>k__BackingField", offsetof(CharacterBody, maxHealth_backing)},
+    {"<maxBarrier>k__BackingField", offsetof(CharacterBody, maxBarrier_backing)},
+    {"<barrierDecayRate>k__BackingField", offsetof(CharacterBody, barrierDecayRate_backing)},
+    {"<regen>k__BackingField", offsetof(CharacterBody, regen_backing)},
+    {"<maxShield>k__BackingField", offsetof(CharacterBody, maxShield_backing)},
+    {"<moveSpeed>k__BackingField", offsetof(CharacterBody, moveSpeed_backing)},
+    {"<acceleration>k__BackingField", offsetof(CharacterBody, acceleration_backing)},
+    {"m_surfaceSpeedBoost", offsetof(CharacterBody, m_surfaceSpeedBoost)},
+    {"<jumpPower>k__BackingField", offsetof(CharacterBody, jumpPower_backing)},
+    {"<maxJumpCount>k__BackingField", offsetof(CharacterBody, maxJumpCount_backing)},
+    {"<maxJumpHeight>k__BackingField", offsetof(CharacterBody, maxJumpHeight_backing)},
+    {"<damage>k__BackingField", offsetof(CharacterBody, damage_backing)},
+    {"<attackSpeed>k__BackingField", offsetof(CharacterBody, attackSpeed_backing)},
+    {"<crit>k__BackingField", offsetof(CharacterBody, crit_backing)},
+    {"<critMultiplier>k__BackingField", offsetof(CharacterBody, critMultiplier_backing)},
+    {"<bleedChance>k__BackingField", offsetof(CharacterBody, bleedChance_backing)},
+    {"<armor>k__BackingField", offsetof(CharacterBody, armor_backing)},
+    {"<visionDistance>k__BackingField", offsetof(CharacterBody, visionDistance_backing)},
+    {"<critHeal>k__BackingField", offsetof(CharacterBody, critHeal_backing)},
+    {"<cursePenalty>k__BackingField", offsetof(CharacterBody, cursePenalty_backing)},
+    {"<hasOneShotProtection>k__BackingField", offsetof(CharacterBody, hasOneShotProtection_backing)},
+    {"<isGlass>k__BackingField", offsetof(CharacterBody, isGlass_backing)},
+    {"<oneShotProtectionFraction>k__BackingField", offsetof(CharacterBody, oneShotProtectionFraction_backing)},
+    {"<canPerformBackstab>k__BackingField", offsetof(CharacterBody, canPerformBackstab_backing)},
+    {"<canReceiveBackstab>k__BackingField", offsetof(CharacterBody, canReceiveBackstab_backing)},
+    {"statsDirty", offsetof(CharacterBody, statsDirty)},
+    {"currentHealthLevel", offsetof(CharacterBody, currentHealthLevel)},
+    {"oldHealthLevel", offsetof(CharacterBody, oldHealthLevel)},
+    {"damageFromRecalculateStats", offsetof(CharacterBody, damageFromRecalculateStats)},
+    {"numberOfKills", offsetof(CharacterBody, numberOfKills)},
+    {"canCleanInventory", offsetof(CharacterBody, canCleanInventory)},
+    {"extraSecondaryFromSkill", offsetof(CharacterBody, extraSecondaryFromSkill)},
+    {"extraSpecialFromSkill", offsetof(CharacterBody, extraSpecialFromSkill)},
+    {"<maxBonusHealth>k__BackingField", offsetof(CharacterBody, maxBonusHealth_backing)},
+    {"extraStatsOnLevelUpCount_CachedLastApplied", offsetof(CharacterBody, extraStatsOnLevelUpCount_CachedLastApplied)},
+    {"lowerPricedChestsActive", offsetof(CharacterBody, lowerPricedChestsActive)},
+    {"canPurchaseLoweredPricedChests", offsetof(CharacterBody, canPurchaseLoweredPricedChests)},
+    {"allSkillsDisabled", offsetof(CharacterBody, allSkillsDisabled)},
+    {"isTeleporting", offsetof(CharacterBody, isTeleporting)},
+    {"currentGrowthNectarBuffCount", offsetof(CharacterBody, currentGrowthNectarBuffCount)},
+    {"prevGrowthNectarBuffCount", offsetof(CharacterBody, prevGrowthNectarBuffCount)},
+    {"maxGrowthNectarBuffCount", offsetof(CharacterBody, maxGrowthNectarBuffCount)},
+    {"growthNectarRemovalTimer", offsetof(CharacterBody, growthNectarRemovalTimer)},
+    {"alwaysAim", offsetof(CharacterBody, alwaysAim)},
+    {"aimTimer", offsetof(CharacterBody, aimTimer)},
+    {"<originalLayer>k__BackingField", offsetof(CharacterBody, originalLayer_backing)},
+    {"_fakeActorCounter", offsetof(CharacterBody, _fakeActorCounter)},
+    {"<killCountServer>k__BackingField", offsetof(CharacterBody, killCountServer_backing)},
+    {"helfireLifetime", offsetof(CharacterBody, helfireLifetime)},
+    {"wasLucky", offsetof(CharacterBody, wasLucky)},
+    {"poisonballTimer", offsetof(CharacterBody, poisonballTimer)},
+    {"lunarMissileRechargeTimer", offsetof(CharacterBody, lunarMissileRechargeTimer)},
+    {"lunarMissileTimerBetweenShots", offsetof(CharacterBody, lunarMissileTimerBetweenShots)},
+    {"remainingMissilesToFire", offsetof(CharacterBody, remainingMissilesToFire)},
+    {"spreadBloomDecayTime", offsetof(CharacterBody, spreadBloomDecayTime)},
+    {"spreadBloomInternal", offsetof(CharacterBody, spreadBloomInternal)},
+    {"hideCrosshair", offsetof(CharacterBody, hideCrosshair)},
+    {"useSprintCrosshair", offsetof(CharacterBody, useSprintCrosshair)},
+    {"multiKillTimer", offsetof(CharacterBody, multiKillTimer)},
+    {"<multiKillCount>k__BackingField", offsetof(CharacterBody, multiKillCount_backing)},
+    {"increasedDamageKillTimer", offsetof(CharacterBody, increasedDamageKillTimer)},
+    {"increasedDamageKillCountDirty", offsetof(CharacterBody, increasedDamageKillCountDirty)},
+    {"_increasedDamageKillCount", offsetof(CharacterBody, _increasedDamageKillCount)},
+    {"<increasedDamageKillCountBuff>k__BackingField", offsetof(CharacterBody, increasedDamageKillCountBuff_backing)},
+    {"canAddIncrasePrimaryDamage", offsetof(CharacterBody, canAddIncrasePrimaryDamage)},
+    {"delayedDamageRefreshTime", offsetof(CharacterBody, delayedDamageRefreshTime)},
+    {"delayedDamageRefreshTimer", offsetof(CharacterBody, delayedDamageRefreshTimer)},
+    {"secondHalfOfDamageTime", offsetof(CharacterBody, secondHalfOfDamageTime)},
+    {"oldDelayedDamageCount", offsetof(CharacterBody, oldDelayedDamageCount)},
+    {"halfDamageReady", offsetof(CharacterBody, halfDamageReady)},
+    {"halfDamageTimer", offsetof(CharacterBody, halfDamageTimer)},
+    {"knockBackFinGroundedTimer", offsetof(CharacterBody, knockBackFinGroundedTimer)},
+    {"runicLensPosition", offsetof(CharacterBody, runicLensPosition)},
+    {"runicLensStartTime", offsetof(CharacterBody, runicLensStartTime)},
+    {"runicLensImpactTime", offsetof(CharacterBody, runicLensImpactTime)},
+    {"runicLensMeteorReady", offsetof(CharacterBody, runicLensMeteorReady)},
+    {"spawnedPickupCount", offsetof(CharacterBody, spawnedPickupCount)},
+    {"useTemporaryPathfindingFootposition", offsetof(CharacterBody, useTemporaryPathfindingFootposition)},
+    {"<radius>k__BackingField", offsetof(CharacterBody, radius_backing)},
+    {"limitCooldown", offsetof(CharacterBody, limitCooldown)},
+    {"minCooldownCoefficient", offsetof(CharacterBody, minCooldownCoefficient)},
+    {"hullClassification", offsetof(CharacterBody, hullClassification)},
+    {"bodyColor", offsetof(CharacterBody, bodyColor)},
+    {"doNotReassignToTeamBasedCollisionLayer", offsetof(CharacterBody, doNotReassignToTeamBasedCollisionLayer)},
+    {"isChampion", offsetof(CharacterBody, isChampion)},
+    {"<isElite>k__BackingField", offsetof(CharacterBody, isElite_backing)},
+    {"skinIndex", offsetof(CharacterBody, skinIndex)},
+    {"<localStartTime>k__BackingField", offsetof(CharacterBody, localStartTime_backing)},
+    {"requestEquipmentFire", offsetof(CharacterBody, requestEquipmentFire)},
+    {"increaseDamageOnMultiKillItemCount", offsetof(CharacterBody, increaseDamageOnMultiKillItemCount)},
+};
+
+static const GameStructField NetworkUserFields[] = {
+    {"<networkLoadout>k__BackingField", offsetof(NetworkUser, networkLoadout_backing)},
+    {"_id", offsetof(NetworkUser, _id)},
+    {"localUser", offsetof(NetworkUser, localUser)},
+    {"cameraRigController", offsetof(NetworkUser, cameraRigController)},
+    {"userName", offsetof(NetworkUser, userName)},
+    {"cachedMaster", offsetof(NetworkUser, cachedMaster)},
+    {"cachedPlayerCharacterMasterController", offsetof(NetworkUser, cachedPlayerCharacterMasterController)},
+    {"cachedPlayerStatsComponent", offsetof(NetworkUser, cachedPlayerStatsComponent)},
+    {"_masterObject", offsetof(NetworkUser, _masterObject)},
+    {"unlockables", offsetof(NetworkUser, unlockables)},
+    {"debugUnlockablesList", offsetof(NetworkUser, debugUnlockablesList)},
+    {"rewiredPlayerId", offsetof(NetworkUser, rewiredPlayerId)},
+    {"_masterObjectId", offsetof(NetworkUser, _masterObjectId)},
+    {"userColor", offsetof(NetworkUser, userColor)},
+    {"netLunarCoins", offsetof(NetworkUser, netLunarCoins)},
+    {"rebirthItem", offsetof(NetworkUser, rebirthItem)},
+    {"bodyIndexPreference", offsetof(NetworkUser, bodyIndexPreference)},
+    {"secondAccumulator", offsetof(NetworkUser, secondAccumulator)},
+    {"<serverIsClientLoaded>k__BackingField", offsetof(NetworkUser, serverIsClientLoaded_backing)},
+    {"_serverLastStageAcknowledgedByClient", offsetof(NetworkUser, _serverLastStageAcknowledgedByClient)},
+};
+
+static const GameStructField PlayerCharacterMasterControllerFields[] = {
+    {"body", offsetof(PlayerCharacterMasterController, body)},
+    {"bodyInputs", offsetof(PlayerCharacterMasterController, bodyInputs)},
+    {"bodyMotor", offsetof(PlayerCharacterMasterController, bodyMotor)},
+    {"previousBodyObject", offsetof(PlayerCharacterMasterController, previousBodyObject)},
+    {"<master>k__BackingField", offsetof(PlayerCharacterMasterController, master_backing)},
+    {"<finalMessageTokenServer>k__BackingField", offsetof(PlayerCharacterMasterController, finalMessageTokenServer_backing)},
+    {"pingerController", offsetof(PlayerCharacterMasterController, pingerController)},
+    {"resolvedNetworkUserGameObjectInstance", offsetof(PlayerCharacterMasterController, resolvedNetworkUserGameObjectInstance)},
+    {"resolvedNetworkUserInstance", offsetof(PlayerCharacterMasterController, resolvedNetworkUserInstance)},
+    {"crosshair", offsetof(PlayerCharacterMasterController, crosshair)},
+    {"netid", offsetof(PlayerCharacterMasterController, netid)},
+    {"onLinkedToNetworkUserServer", offsetof(PlayerCharacterMasterController, onLinkedToNetworkUserServer)},
+    {"networkUserInstanceId", offsetof(PlayerCharacterMasterController, networkUserInstanceId)},
+    {"networkUserResolved", offsetof(PlayerCharacterMasterController, networkUserResolved)},
+    {"alreadyLinkedToNetworkUserOnce", offsetof(PlayerCharacterMasterController, alreadyLinkedToNetworkUserOnce)},
+    {"cameraMinPitch", offsetof(PlayerCharacterMasterController, cameraMinPitch)},
+    {"cameraMaxPitch", offsetof(PlayerCharacterMasterController, cameraMaxPitch)},
+    {"crosshairPosition", offsetof(PlayerCharacterMasterController, crosshairPosition)},
+    {"sprintInputPressReceived", offsetof(PlayerCharacterMasterController, sprintInputPressReceived)},
+    {"jumpWasClaimed", offsetof(PlayerCharacterMasterController, jumpWasClaimed)},
+    {"claimNextJump", offsetof(PlayerCharacterMasterController, claimNextJump)},
+    {"lunarCoinChanceMultiplier", offsetof(PlayerCharacterMasterController, lunarCoinChanceMultiplier)},
+};
+
+static const GameStructField CharacterMasterFields[] = {
+    {"bodyPrefab", offsetof(CharacterMaster, bodyPrefab)},
+    {"originalBodyPrefab", offsetof(CharacterMaster, originalBodyPrefab)},
+    {"<networkIdentity>k__BackingField", offsetof(CharacterMaster, networkIdentity_backing)},
+    {"onBodyStart", offsetof(CharacterMaster, onBodyStart)},
+    {"onBodyDestroyed", offsetof(CharacterMaster, onBodyDestroyed)},
+    {"onPlayerBodyDamaged", offsetof(CharacterMaster, onPlayerBodyDamaged)},
+    {"onBodyDeath", offsetof(CharacterMaster, onBodyDeath)},
+    {"<inventory>k__BackingField", offsetof(CharacterMaster, inventory_backing)},
+    {"aiComponents", offsetof(CharacterMaster, aiComponents)},
+    {"<playerCharacterMasterController>k__BackingField", offsetof(CharacterMaster, playerCharacterMasterController_backing)},
+    {"<playerStatsComponent>k__BackingField", offsetof(CharacterMaster, playerStatsComponent_backing)},
+    {"<minionOwnership>k__BackingField", offsetof(CharacterMaster, minionOwnership_backing)},
+    {"loadout", offsetof(CharacterMaster, loadout)},
+    {"resolvedBodyInstance", offsetof(CharacterMaster, resolvedBodyInstance)},
+    {"_persistentInventory", offsetof(CharacterMaster, _persistentInventory)},
+    {"resolvedCombatSquadInstance", offsetof(CharacterMaster, resolvedCombatSquadInstance)},
+    {"OnGoldCollected", offsetof(CharacterMaster, OnGoldCollected)},
+    {"cloverVoidRng", offsetof(CharacterMaster, cloverVoidRng)},
+    {"deployablesList", offsetof(CharacterMaster, deployablesList)},
+    {"devotionInventoryPrefab", offsetof(CharacterMaster, devotionInventoryPrefab)},
+    {"devotionInventoryUpdaterRef", offsetof(CharacterMaster, devotionInventoryUpdaterRef)},
+    {"summonerRef", offsetof(CharacterMaster, summonerRef)},
+    {"_masterIndex", offsetof(CharacterMaster, _masterIndex)},
+    {"hideAllyCard", offsetof(CharacterMaster, hideAllyCard)},
+    {"spawnOnStart", offsetof(CharacterMaster, spawnOnStart)},
+    {"_teamIndex", offsetof(CharacterMaster, _teamIndex)},
+    {"<hasEffectiveAuthority>k__BackingField", offsetof(CharacterMaster, hasEffectiveAuthority_backing)},
+    {"destroyOnBodyDeath", offsetof(CharacterMaster, destroyOnBodyDeath)},
+    {"_bodyInstanceId", offsetof(CharacterMaster, _bodyInstanceId)},
+    {"bodyResolved", offsetof(CharacterMaster, bodyResolved)},
+    {"<backupBodyIndex>k__BackingField", offsetof(CharacterMaster, backupBodyIndex_backing)},
+    {"<enablePrintController>k__BackingField", offsetof(CharacterMaster, enablePrintController_backing)},
+    {"_combatSquadInstanceId", offsetof(CharacterMaster, _combatSquadInstanceId)},
+    {"numberOfBeadStatsGained_XPGainNerf", offsetof(CharacterMaster, numberOfBeadStatsGained_XPGainNerf)},
+    {"beadExperience", offsetof(CharacterMaster, beadExperience)},
+    {"oldBeadLevel", offsetof(CharacterMaster, oldBeadLevel)},
+    {"newBeadLevel", offsetof(CharacterMaster, newBeadLevel)},
+    {"beadXPNeededForCurrentLevel", offsetof(CharacterMaster, beadXPNeededForCurrentLevel)},
+    {"_money", offsetof(CharacterMaster, _money)},
+    {"ExtraBossMissileMoneyRemainder", offsetof(CharacterMaster, ExtraBossMissileMoneyRemainder)},
+    {"trackedFreeUnlocks", offsetof(CharacterMaster, trackedFreeUnlocks)},
+    {"trackedMissileCount", offsetof(CharacterMaster, trackedMissileCount)},
+    {"moneyEarnedSoFar", offsetof(CharacterMaster, moneyEarnedSoFar)},
+    {"_voidCoins", offsetof(CharacterMaster, _voidCoins)},
+    {"<luck>k__BackingField", offsetof(CharacterMaster, luck_backing)},
+    {"isBoss", offsetof(CharacterMaster, isBoss)},
+    {"preventGameOver", offsetof(CharacterMaster, preventGameOver)},
+    {"<deathFootPosition>k__BackingField", offsetof(CharacterMaster, deathFootPosition_backing)},
+    {"deathAimVector", offsetof(CharacterMaster, deathAimVector)},
+    {"killedByUnsafeArea", offsetof(CharacterMaster, killedByUnsafeArea)},
+    {"_internalSurvivalTime", offsetof(CharacterMaster, _internalSurvivalTime)},
+    {"killerBodyIndex", offsetof(CharacterMaster, killerBodyIndex)},
+    {"preventRespawnUntilNextStageServer", offsetof(CharacterMaster, preventRespawnUntilNextStageServer)},
+    {"_seekerChakraGate", offsetof(CharacterMaster, _seekerChakraGate)},
+    {"_seekerRevivedOnce", offsetof(CharacterMaster, _seekerRevivedOnce)},
+    {"_seekerRevitalize", offsetof(CharacterMaster, _seekerRevitalize)},
+    {"seekerSelfRevive", offsetof(CharacterMaster, seekerSelfRevive)},
+    {"devotionItem", offsetof(CharacterMaster, devotionItem)},
+    {"devotedEvolutionTracker", offsetof(CharacterMaster, devotedEvolutionTracker)},
+    {"isDevotedMinion", offsetof(CharacterMaster, isDevotedMinion)},
+    {"godMode", offsetof(CharacterMaster, godMode)},
+    {"lostBodyToDeathFlag", offsetof(CharacterMaster, lostBodyToDeathFlag)},
+    {"_miscFlags", offsetof(CharacterMaster, _miscFlags)},
+};
+
+static const GameStructField CameraTargetParamsFields[] = {
+    {"cameraParams", offsetof(CameraTargetParams, cameraParams)},
+    {"cameraPivotTransform", offsetof(CameraTargetParams, cameraPivotTransform)},
+    {"cameraLerpRequests", offsetof(CameraTargetParams, cameraLerpRequests)},
+    {"cameraParamsOverrides", offsetof(CameraTargetParams, cameraParamsOverrides)},
+    {"fovOverride", offsetof(CameraTargetParams, fovOverride)},
+    {"recoil", offsetof(CameraTargetParams, recoil)},
+    {"dontRaycastToPivot", offsetof(CameraTargetParams, dontRaycastToPivot)},
+    {"targetRecoil", offsetof(CameraTargetParams, targetRecoil)},
+    {"recoilVelocity", offsetof(CameraTargetParams, recoilVelocity)},
+    {"targetRecoilVelocity", offsetof(CameraTargetParams, targetRecoilVelocity)},
+    {"_currentCameraParamsData", offsetof(CameraTargetParams, _currentCameraParamsData)},
+};
+
+static const GameStructField CameraRigControllerFields[] = {
+    {"sceneCam", offsetof(CameraRigController, sceneCam)},
+    {"uiCam", offsetof(CameraRigController, uiCam)},
+    {"skyboxCam", offsetof(CameraRigController, skyboxCam)},
+    {"sprintingParticleSystem", offsetof(CameraRigController, sprintingParticleSystem)},
+    {"disabledSkillsParticleSystem", offsetof(CameraRigController, disabledSkillsParticleSystem)},
+    {"secondaryElectrictyParticleSystem", offsetof(CameraRigController, secondaryElectrictyParticleSystem)},
+    {"nextTarget", offsetof(CameraRigController, nextTarget)},
+    {"_cameraMode", offsetof(CameraRigController, _cameraMode)},
+    {"<hud>k__BackingField", offsetof(CameraRigController, hud_backing)},
+    {"<firstPersonTarget>k__BackingField", offsetof(CameraRigController, firstPersonTarget_backing)},
+    {"<targetBody>k__BackingField", offsetof(CameraRigController, targetBody_backing)},
+    {"_target", offsetof(CameraRigController, _target)},
+    {"overrideCam", offsetof(CameraRigController, overrideCam)},
+    {"cameraModeContext", offsetof(CameraRigController, cameraModeContext)},
+    {"_viewer", offsetof(CameraRigController, _viewer)},
+    {"_localUserViewer", offsetof(CameraRigController, _localUserViewer)},
+    {"targetParams", offsetof(CameraRigController, targetParams)},
+    {"lastAimAssist", offsetof(CameraRigController, lastAimAssist)},
+    {"aimAssist", offsetof(CameraRigController, aimAssist)},
+    {"<lastCrosshairHurtBox>k__BackingField", offsetof(CameraRigController, lastCrosshairHurtBox_backing)},
+    {"baseFov", offsetof(CameraRigController, baseFov)},
+    {"viewport", offsetof(CameraRigController, viewport)},
+    {"maxAimRaycastDistance", offsetof(CameraRigController, maxAimRaycastDistance)},
+    {"isCutscene", offsetof(CameraRigController, isCutscene)},
+    {"enableFading", offsetof(CameraRigController, enableFading)},
+    {"fadeStartDistance", offsetof(CameraRigController, fadeStartDistance)},
+    {"fadeEndDistance", offsetof(CameraRigController, fadeEndDistance)},
+    {"createHud", offsetof(CameraRigController, createHud)},
+    {"suppressPlayerCameras", offsetof(CameraRigController, suppressPlayerCameras)},
+    {"enableMusic", offsetof(CameraRigController, enableMusic)},
+    {"<disableSpectating>k__BackingField", offsetof(CameraRigController, disableSpectating_backing)},
+    {"<targetTeamIndex>k__BackingField", offsetof(CameraRigController, targetTeamIndex_backing)},
+    {"<rawScreenShakeDisplacement>k__BackingField", offsetof(CameraRigController, rawScreenShakeDisplacement_backing)},
+    {"<crosshairWorldPosition>k__BackingField", offsetof(CameraRigController, crosshairWorldPosition_backing)},
+    {"desiredCameraState", offsetof(CameraRigController, desiredCameraState)},
+    {"currentCameraState", offsetof(CameraRigController, currentCameraState)},
+    {"doNotOverrideCameraState", offsetof(CameraRigController, doNotOverrideCameraState)},
+    {"lerpCameraState", offsetof(CameraRigController, lerpCameraState)},
+    {"lerpCameraTime", offsetof(CameraRigController, lerpCameraTime)},
+    {"lerpCameraTimeScale", offsetof(CameraRigController, lerpCameraTimeScale)},
+    {"hitmarkerAlpha", offsetof(CameraRigController, hitmarkerAlpha)},
+    {"hitmarkerTimer", offsetof(CameraRigController, hitmarkerTimer)},
+};
+
+static const GameStructField PlayerStatsComponentFields[] = {
+    {"<characterMaster>k__BackingField", offsetof(PlayerStatsComponent, characterMaster_backing)},
+    {"<playerCharacterMasterController>k__BackingField", offsetof(PlayerStatsComponent, playerCharacterMasterController_backing)},
+    {"cachedBodyObject", offsetof(PlayerStatsComponent, cachedBodyObject)},
+    {"cachedCharacterBody", offsetof(PlayerStatsComponent, cachedCharacterBody)},
+    {"cachedBodyCharacterMotor", offsetof(PlayerStatsComponent, cachedBodyCharacterMotor)},
+    {"cachedBodyTransform", offsetof(PlayerStatsComponent, cachedBodyTransform)},
+    {"currentStats", offsetof(PlayerStatsComponent, currentStats)},
+    {"clientDeltaStatsBuffer", offsetof(PlayerStatsComponent, clientDeltaStatsBuffer)},
+    {"recordedStats", offsetof(PlayerStatsComponent, recordedStats)},
+    {"ClientSynced", offsetof(PlayerStatsComponent, ClientSynced)},
+    {"serverTransmitTimer", offsetof(PlayerStatsComponent, serverTransmitTimer)},
+    {"serverTransmitInterval", offsetof(PlayerStatsComponent, serverTransmitInterval)},
+    {"previousBodyPosition", offsetof(PlayerStatsComponent, previousBodyPosition)},
+};
+
+static const GameStructField LocalUserFields[] = {
+    {"_inputPlayer", offsetof(LocalUser, _inputPlayer)},
+    {"<eventSystem>k__BackingField", offsetof(LocalUser, eventSystem_backing)},
+    {"_userProfile", offsetof(LocalUser, _userProfile)},
+    {"<currentNetworkUser>k__BackingField", offsetof(LocalUser, currentNetworkUser_backing)},
+    {"<cachedMasterController>k__BackingField", offsetof(LocalUser, cachedMasterController_backing)},
+    {"pauseScreenController", offsetof(LocalUser, pauseScreenController)},
+    {"<cachedMaster>k__BackingField", offsetof(LocalUser, cachedMaster_backing)},
+    {"<cachedMasterObject>k__BackingField", offsetof(LocalUser, cachedMasterObject_backing)},
+    {"<cachedBody>k__BackingField", offsetof(LocalUser, cachedBody_backing)},
+    {"<cachedBodyObject>k__BackingField", offsetof(LocalUser, cachedBodyObject_backing)},
+    {"<cachedStatsComponent>k__BackingField", offsetof(LocalUser, cachedStatsComponent_backing)},
+    {"_cameraRigController", offsetof(LocalUser, _cameraRigController)},
+    {"onBodyChanged", offsetof(LocalUser, onBodyChanged)},
+    {"onMasterChanged", offsetof(LocalUser, onMasterChanged)},
+    {"onCameraDiscovered", offsetof(LocalUser, onCameraDiscovered)},
+    {"onCameraLost", offsetof(LocalUser, onCameraLost)},
+    {"onNetworkUserFound", offsetof(LocalUser, onNetworkUserFound)},
+    {"onNetworkUserLost", offsetof(LocalUser, onNetworkUserLost)},
+    {"id", offsetof(LocalUser, id)},
+};
+
+static const GameStructField RuleBookFields[] = {
+    {"ruleValues", offsetof(RuleBook, ruleValues)},
+};
+
+static const GameStructField ServerManagerBaseFields[] = {
+    {"collectAdditionalTags", offsetof(ServerManagerBase, collectAdditionalTags)},
+    {"tags", offsetof(ServerManagerBase, tags)},
+    {"currentRuleBook", offsetof(ServerManagerBase, currentRuleBook)},
+    {"ruleBookKvHelper", offsetof(ServerManagerBase, ruleBookKvHelper)},
+    {"modListKvHelper", offsetof(ServerManagerBase, modListKvHelper)},
+    {"disposed", offsetof(ServerManagerBase, disposed)},
+    {"playerUpdateTimer", offsetof(ServerManagerBase, playerUpdateTimer)},
+    {"playerUpdateInterval", offsetof(ServerManagerBase, playerUpdateInterval)},
+};
+
+static const GameStructField RangeFloatFields[] = {
+    {"min", offsetof(RangeFloat, min)},
+    {"max", offsetof(RangeFloat, max)},
+};
+
+static const GameStructField CombatSquadFields[] = {
+    {"membersList", offsetof(CombatSquad, membersList)},
+    {"memberHistory", offsetof(CombatSquad, memberHistory)},
+    {"<readOnlyMembersList>k__BackingField", offsetof(CombatSquad, readOnlyMembersList_backing)},
+    {"onDestroyCallbacksServer", offsetof(CombatSquad, onDestroyCallbacksServer)},
+    {"onDefeatedServer", offsetof(CombatSquad, onDefeatedServer)},
+    {"onDefeatedClientLogicEvent", offsetof(CombatSquad, onDefeatedClientLogicEvent)},
+    {"onDefeatedServerLogicEvent", offsetof(CombatSquad, onDefeatedServerLogicEvent)},
+    {"onMemberDeathServer", offsetof(CombatSquad, onMemberDeathServer)},
+    {"onMemberDefeatedServer", offsetof(CombatSquad, onMemberDefeatedServer)},
+    {"onMemberAddedServer", offsetof(CombatSquad, onMemberAddedServer)},
+    {"onMemberDiscovered", offsetof(CombatSquad, onMemberDiscovered)},
+    {"onMemberLost", offsetof(CombatSquad, onMemberLost)},
+    {"propagateMembershipToSummons", offsetof(CombatSquad, propagateMembershipToSummons)},
+    {"grantBonusHealthInMultiplayer", offsetof(CombatSquad, grantBonusHealthInMultiplayer)},
+    {"defeatedServer", offsetof(CombatSquad, defeatedServer)},
+    {"<delayDefeat>k__BackingField", offsetof(CombatSquad, delayDefeat_backing)},
+    {"awakeTime", offsetof(CombatSquad, awakeTime)},
+    {"invalidDataUpdateRequestCounter", offsetof(CombatSquad, invalidDataUpdateRequestCounter)},
+};
+
+static const GameStructField SpawnCardFields[] = {
+    {"prefab", offsetof(SpawnCard, prefab)},
+    {"sendOverNetwork", offsetof(SpawnCard, sendOverNetwork)},
+    {"hullSize", offsetof(SpawnCard, hullSize)},
+    {"nodeGraphType", offsetof(SpawnCard, nodeGraphType)},
+    {"requiredFlags", offsetof(SpawnCard, requiredFlags)},
+    {"forbiddenFlags", offsetof(SpawnCard, forbiddenFlags)},
+    {"directorCreditCost", offsetof(SpawnCard, directorCreditCost)},
+    {"occupyPosition", offsetof(SpawnCard, occupyPosition)},
+    {"eliteRules", offsetof(SpawnCard, eliteRules)},
+};
+
+static const GameStructField RuleCategoryDefFields[] = {
+    {"displayToken", offsetof(RuleCategoryDef, displayToken)},
+    {"subtitleToken", offsetof(RuleCategoryDef, subtitleToken)},
+    {"emptyTipToken", offsetof(RuleCategoryDef, emptyTipToken)},
+    {"editToken", offsetof(RuleCategoryDef, editToken)},
+    {"children", offsetof(RuleCategoryDef, children)},
+    {"hiddenTest", offsetof(RuleCategoryDef, hiddenTest)},
+    {"position", offsetof(RuleCategoryDef, position)},
+    {"color", offsetof(RuleCategoryDef, color)},
+    {"ruleCategoryType", offsetof(RuleCategoryDef, ruleCategoryType)},
+};
+
+static const GameStructField RuleDefFields[] = {
+    {"globalName", offsetof(RuleDef, globalName)},
+    {"displayToken", offsetof(RuleDef, displayToken)},
+    {"choices", offsetof(RuleDef, choices)},
+    {"category", offsetof(RuleDef, category)},
+    {"globalIndex", offsetof(RuleDef, globalIndex)},
+    {"defaultChoiceIndex", offsetof(RuleDef, defaultChoiceIndex)},
+    {"forceLobbyDisplay", offsetof(RuleDef, forceLobbyDisplay)},
+    {"hideLobbyDisplay", offsetof(RuleDef, hideLobbyDisplay)},
+};
+
+static const GameStructField EntitlementDefFields[] = {
+    {"nameToken", offsetof(EntitlementDef, nameToken)},
+    {"eosItemId", offsetof(EntitlementDef, eosItemId)},
+    {"egsItemName", offsetof(EntitlementDef, egsItemName)},
+    {"GamecoreID", offsetof(EntitlementDef, GamecoreID)},
+    {"SonyID", offsetof(EntitlementDef, SonyID)},
+    {"entitlementIndex", offsetof(EntitlementDef, entitlementIndex)},
+    {"steamAppId", offsetof(EntitlementDef, steamAppId)},
+    {"switchNsUid", offsetof(EntitlementDef, switchNsUid)},
+    {"switchDLCIndex", offsetof(EntitlementDef, switchDLCIndex)},
+};
+
+static const GameStructField RuleChoiceDefFields[] = {
+    {"ruleDef", offsetof(RuleChoiceDef, ruleDef)},
+    {"sprite", offsetof(RuleChoiceDef, sprite)},
+    {"tooltipNameToken", offsetof(RuleChoiceDef, tooltipNameToken)},
+    {"getTooltipName", offsetof(RuleChoiceDef, getTooltipName)},
+    {"tooltipBodyToken", offsetof(RuleChoiceDef, tooltipBodyToken)},
+    {"localName", offsetof(RuleChoiceDef, localName)},
+    {"globalName", offsetof(RuleChoiceDef, globalName)},
+    {"requiredUnlockable", offsetof(RuleChoiceDef, requiredUnlockable)},
+    {"requiredChoiceDef", offsetof(RuleChoiceDef, requiredChoiceDef)},
+    {"requiredEntitlementDef", offsetof(RuleChoiceDef, requiredEntitlementDef)},
+    {"requiredExpansionDef", offsetof(RuleChoiceDef, requiredExpansionDef)},
+    {"extraData", offsetof(RuleChoiceDef, extraData)},
+    {"selectionUISound", offsetof(RuleChoiceDef, selectionUISound)},
+    {"serverTag", offsetof(RuleChoiceDef, serverTag)},
+    {"tooltipNameColor", offsetof(RuleChoiceDef, tooltipNameColor)},
+    {"tooltipBodyColor", offsetof(RuleChoiceDef, tooltipBodyColor)},
+    {"localIndex", offsetof(RuleChoiceDef, localIndex)},
+    {"globalIndex", offsetof(RuleChoiceDef, globalIndex)},
+    {"availableInSinglePlayer", offsetof(RuleChoiceDef, availableInSinglePlayer)},
+    {"availableInMultiPlayer", offsetof(RuleChoiceDef, availableInMultiPlayer)},
+    {"difficultyIndex", offsetof(RuleChoiceDef, difficultyIndex)},
+    {"artifactIndex", offsetof(RuleChoiceDef, artifactIndex)},
+    {"itemIndex", offsetof(RuleChoiceDef, itemIndex)},
+    {"equipmentIndex", offsetof(RuleChoiceDef, equipmentIndex)},
+    {"droneIndex", offsetof(RuleChoiceDef, droneIndex)},
+    {"excludeByDefault", offsetof(RuleChoiceDef, excludeByDefault)},
+    {"onlyShowInGameBrowserIfNonDefault", offsetof(RuleChoiceDef, onlyShowInGameBrowserIfNonDefault)},
+};
+
+static const GameStructField ExpansionDefFields[] = {
+    {"requiredEntitlement", offsetof(ExpansionDef, requiredEntitlement)},
+    {"nameToken", offsetof(ExpansionDef, nameToken)},
+    {"descriptionToken", offsetof(ExpansionDef, descriptionToken)},
+    {"iconSprite", offsetof(ExpansionDef, iconSprite)},
+    {"disabledIconSprite", offsetof(ExpansionDef, disabledIconSprite)},
+    {"enabledChoice", offsetof(ExpansionDef, enabledChoice)},
+    {"runBehaviorPrefab", offsetof(ExpansionDef, runBehaviorPrefab)},
+    {"expansionIndex", offsetof(ExpansionDef, expansionIndex)},
+};
+
+static const GameStructField ExpansionRequirementComponentFields[] = {
+    {"requiredExpansion", offsetof(ExpansionRequirementComponent, requiredExpansion)},
+    {"requireEntitlementIfPlayerControlled", offsetof(ExpansionRequirementComponent, requireEntitlementIfPlayerControlled)},
+};
+
+static const GameStructField UnlockableDefFields[] = {
+    {"_cachedName", offsetof(UnlockableDef, _cachedName)},
+    {"nameToken", offsetof(UnlockableDef, nameToken)},
+    {"displayModelPath", offsetof(UnlockableDef, displayModelPath)},
+    {"displayModelPrefab", offsetof(UnlockableDef, displayModelPrefab)},
+    {"achievementIcon", offsetof(UnlockableDef, achievementIcon)},
+    {"requiredExpansion", offsetof(UnlockableDef, requiredExpansion)},
+    {"<getHowToUnlockString>k__BackingField", offsetof(UnlockableDef, getHowToUnlockString_backing)},
+    {"<getUnlockedString>k__BackingField", offsetof(UnlockableDef, getUnlockedString_backing)},
+    {"<index>k__BackingField", offsetof(UnlockableDef, index_backing)},
+    {"hidden", offsetof(UnlockableDef, hidden)},
+    {"<sortScore>k__BackingField", offsetof(UnlockableDef, sortScore_backing)},
+};
+
+static const GameStructField DirectorCardFields[] = {
+    {"spawnCardReference", offsetof(DirectorCard, spawnCardReference)},
+    {"spawnCard", offsetof(DirectorCard, spawnCard)},
+    {"requiredUnlockable", offsetof(DirectorCard, requiredUnlockable)},
+    {"forbiddenUnlockable", offsetof(DirectorCard, forbiddenUnlockable)},
+    {"requiredUnlockableDef", offsetof(DirectorCard, requiredUnlockableDef)},
+    {"forbiddenUnlockableDef", offsetof(DirectorCard, forbiddenUnlockableDef)},
+    {"selectionWeight", offsetof(DirectorCard, selectionWeight)},
+    {"spawnDistance", offsetof(DirectorCard, spawnDistance)},
+    {"preventOverhead", offsetof(DirectorCard, preventOverhead)},
+    {"minimumStageCompletions", offsetof(DirectorCard, minimumStageCompletions)},
+};
+
+static const GameStructField DirectorCardCategorySelectionFields[] = {
+    {"expansionsInEffect", offsetof(DirectorCardCategorySelection, expansionsInEffect)},
+    {"categories", offsetof(DirectorCardCategorySelection, categories)},
+};
+
+static const GameStructField EliteDefFields[] = {
+    {"modifierToken", offsetof(EliteDef, modifierToken)},
+    {"eliteEquipmentDef", offsetof(EliteDef, eliteEquipmentDef)},
+    {"<eliteIndex>k__BackingField", offsetof(EliteDef, eliteIndex_backing)},
+    {"color", offsetof(EliteDef, color)},
+    {"shaderEliteRampIndex", offsetof(EliteDef, shaderEliteRampIndex)},
+    {"healthBoostCoefficient", offsetof(EliteDef, healthBoostCoefficient)},
+    {"damageBoostCoefficient", offsetof(EliteDef, damageBoostCoefficient)},
+    {"devotionLevel", offsetof(EliteDef, devotionLevel)},
+};
+
+static const GameStructField CombatDirectorFields[] = {
+    {"customName", offsetof(CombatDirector, customName)},
+    {"moneyWaveIntervals", offsetof(CombatDirector, moneyWaveIntervals)},
+    {"onSpawnedServer", offsetof(CombatDirector, onSpawnedServer)},
+    {"onSpawnedWithDirectorServer", offsetof(CombatDirector, onSpawnedWithDirectorServer)},
+    {"combatSquad", offsetof(CombatDirector, combatSquad)},
+    {"spawnEffectPrefab", offsetof(CombatDirector, spawnEffectPrefab)},
+    {"_monsterCards", offsetof(CombatDirector, _monsterCards)},
+    {"_backupMonsterCards", offsetof(CombatDirector, _backupMonsterCards)},
+    {"<lastAttemptedMonsterCard>k__BackingField", offsetof(CombatDirector, lastAttemptedMonsterCard_backing)},
+    {"rng", offsetof(CombatDirector, rng)},
+    {"currentMonsterCard", offsetof(CombatDirector, currentMonsterCard)},
+    {"currentActiveEliteTier", offsetof(CombatDirector, currentActiveEliteTier)},
+    {"currentActiveEliteDef", offsetof(CombatDirector, currentActiveEliteDef)},
+    {"ActiveEliteDefOverride", offsetof(CombatDirector, ActiveEliteDefOverride)},
+    {"monsterCardsSelection", offsetof(CombatDirector, monsterCardsSelection)},
+    {"_bossOverride", offsetof(CombatDirector, _bossOverride)},
+    {"currentSpawnTarget", offsetof(CombatDirector, currentSpawnTarget)},
+    {"_customPlacementBase", offsetof(CombatDirector, _customPlacementBase)},
+    {"moneyWaves", offsetof(CombatDirector, moneyWaves)},
+    {"monsterCredit", offsetof(CombatDirector, monsterCredit)},
+    {"refundedMonsterCredit", offsetof(CombatDirector, refundedMonsterCredit)},
+    {"expRewardCoefficient", offsetof(CombatDirector, expRewardCoefficient)},
+    {"goldRewardCoefficient", offsetof(CombatDirector, goldRewardCoefficient)},
+    {"minSeriesSpawnInterval", offsetof(CombatDirector, minSeriesSpawnInterval)},
+    {"maxSeriesSpawnInterval", offsetof(CombatDirector, maxSeriesSpawnInterval)},
+    {"minRerollSpawnInterval", offsetof(CombatDirector, minRerollSpawnInterval)},
+    {"maxRerollSpawnInterval", offsetof(CombatDirector, maxRerollSpawnInterval)},
+    {"teamIndex", offsetof(CombatDirector, teamIndex)},
+    {"creditMultiplier", offsetof(CombatDirector, creditMultiplier)},
+    {"spawnDistanceMultiplier", offsetof(CombatDirector, spawnDistanceMultiplier)},
+    {"maxSpawnDistance", offsetof(CombatDirector, maxSpawnDistance)},
+    {"minSpawnRange", offsetof(CombatDirector, minSpawnRange)},
+    {"shouldSpawnOneWave", offsetof(CombatDirector, shouldSpawnOneWave)},
+    {"targetPlayers", offsetof(CombatDirector, targetPlayers)},
+    {"skipSpawnIfTooCheap", offsetof(CombatDirector, skipSpawnIfTooCheap)},
+    {"maxConsecutiveCheapSkips", offsetof(CombatDirector, maxConsecutiveCheapSkips)},
+    {"resetMonsterCardIfFailed", offsetof(CombatDirector, resetMonsterCardIfFailed)},
+    {"maximumNumberToSpawnBeforeSkipping", offsetof(CombatDirector, maximumNumberToSpawnBeforeSkipping)},
+    {"eliteBias", offsetof(CombatDirector, eliteBias)},
+    {"increaseSpawnDistanceOnFailure", offsetof(CombatDirector, increaseSpawnDistanceOnFailure)},
+    {"maxSquadCount", offsetof(CombatDirector, maxSquadCount)},
+    {"ignoreTeamSizeLimit", offsetof(CombatDirector, ignoreTeamSizeLimit)},
+    {"fallBackToStageMonsterCards", offsetof(CombatDirector, fallBackToStageMonsterCards)},
+    {"<monsterSpawnTimer>k__BackingField", offsetof(CombatDirector, monsterSpawnTimer_backing)},
+    {"<totalCreditsSpent>k__BackingField", offsetof(CombatDirector, totalCreditsSpent_backing)},
+    {"hasStartedWave", offsetof(CombatDirector, hasStartedWave)},
+    {"currentMonsterCardCost", offsetof(CombatDirector, currentMonsterCardCost)},
+    {"consecutiveCheapSkips", offsetof(CombatDirector, consecutiveCheapSkips)},
+    {"_bossOverrideSpawnSingleBoss", offsetof(CombatDirector, _bossOverrideSpawnSingleBoss)},
+    {"ignoreCostOfNextMonster", offsetof(CombatDirector, ignoreCostOfNextMonster)},
+    {"playerRetargetTimer", offsetof(CombatDirector, playerRetargetTimer)},
+    {"spawnCountInCurrentWave", offsetof(CombatDirector, spawnCountInCurrentWave)},
+    {"isHalcyonShrineSpawn", offsetof(CombatDirector, isHalcyonShrineSpawn)},
+    {"shrineHalcyoniteDifficultyLevel", offsetof(CombatDirector, shrineHalcyoniteDifficultyLevel)},
+};
+
+static const GameStructField EntityStateFields[] = {
+    {"outer", offsetof(EntityState, outer)},
+    {"<age>k__BackingField", offsetof(EntityState, age_backing)},
+    {"<fixedAge>k__BackingField", offsetof(EntityState, fixedAge_backing)},
+};
+
+static const GameStructField NetworkStateMachineFields[] = {
+    {"stateMachines", offsetof(NetworkStateMachine, stateMachines)},
+    {"networkIdentity", offsetof(NetworkStateMachine, networkIdentity)},
+};
+
+static const GameStructField EntityStateMachineFields[] = {
+    {"<state>k__BackingField", offsetof(EntityStateMachine, state_backing)},
+    {"nextState", offsetof(EntityStateMachine, nextState)},
+    {"customName", offsetof(EntityStateMachine, customName)},
+    {"initialStateType", offsetof(EntityStateMachine, initialStateType)},
+    {"mainStateType", offsetof(EntityStateMachine, mainStateType)},
+    {"<networker>k__BackingField", offsetof(EntityStateMachine, networker_backing)},
+    {"<networkIdentity>k__BackingField", offsetof(EntityStateMachine, networkIdentity_backing)},
+    {"commonComponents", offsetof(EntityStateMachine, commonComponents)},
+    {"nextStateModifier", offsetof(EntityStateMachine, nextStateModifier)},
+    {"networkIndex", offsetof(EntityStateMachine, networkIndex)},
+    {"AllowStartWithoutNetworker", offsetof(EntityStateMachine, AllowStartWithoutNetworker)},
+    {"ShouldStateTransitionOnUpdate", offsetof(EntityStateMachine, ShouldStateTransitionOnUpdate)},
+    {"debug", offsetof(EntityStateMachine, debug)},
+    {"<destroying>k__BackingField", offsetof(EntityStateMachine, destroying_backing)},
+};
+
+static const GameStructField OutsideInteractableLockerFields[] = {
+    {"lockPrefab", offsetof(OutsideInteractableLocker, lockPrefab)},
+    {"lockObjectMap", offsetof(OutsideInteractableLocker, lockObjectMap)},
+    {"eggLockInfoMap", offsetof(OutsideInteractableLocker, eggLockInfoMap)},
+    {"lockInteractableMap", offsetof(OutsideInteractableLocker, lockInteractableMap)},
+    {"currentCoroutine", offsetof(OutsideInteractableLocker, currentCoroutine)},
+    {"updateInterval", offsetof(OutsideInteractableLocker, updateInterval)},
+    {"lockInside", offsetof(OutsideInteractableLocker, lockInside)},
+    {"<radius>k__BackingField", offsetof(OutsideInteractableLocker, radius_backing)},
+    {"updateTimer", offsetof(OutsideInteractableLocker, updateTimer)},
+};
+
+static const GameStructField PickupDropTableFields[] = {
+    {"canDropBeReplaced", offsetof(PickupDropTable, canDropBeReplaced)},
+};
+
+static const GameStructField BossGroupFields[] = {
+    {"dropPosition", offsetof(BossGroup, dropPosition)},
+    {"dropTable", offsetof(BossGroup, dropTable)},
+    {"thresholdController", offsetof(BossGroup, thresholdController)},
+    {"<combatSquad>k__BackingField", offsetof(BossGroup, combatSquad_backing)},
+    {"rng", offsetof(BossGroup, rng)},
+    {"bossDropTables", offsetof(BossGroup, bossDropTables)},
+    {"bossDrops", offsetof(BossGroup, bossDrops)},
+    {"bossMemories", offsetof(BossGroup, bossMemories)},
+    {"<bestObservedName>k__BackingField", offsetof(BossGroup, bestObservedName_backing)},
+    {"<bestObservedSubtitle>k__BackingField", offsetof(BossGroup, bestObservedSubtitle_backing)},
+    {"bossDropChance", offsetof(BossGroup, bossDropChance)},
+    {"scaleRewardsByPlayerCount", offsetof(BossGroup, scaleRewardsByPlayerCount)},
+    {"shouldDisplayHealthBarOnHud", offsetof(BossGroup, shouldDisplayHealthBarOnHud)},
+    {"shouldCreateObjectiveEntry", offsetof(BossGroup, shouldCreateObjectiveEntry)},
+    {"<bonusRewardCount>k__BackingField", offsetof(BossGroup, bonusRewardCount_backing)},
+    {"bossDropTablesLocked", offsetof(BossGroup, bossDropTablesLocked)},
+    {"enabledTime", offsetof(BossGroup, enabledTime)},
+    {"forceTier3Reward", offsetof(BossGroup, forceTier3Reward)},
+    {"bossMemoryCount", offsetof(BossGroup, bossMemoryCount)},
+    {"currentPriority", offsetof(BossGroup, currentPriority)},
+    {"bodiesOfCurrentPriority", offsetof(BossGroup, bodiesOfCurrentPriority)},
+    {"lastDisplayedPriority", offsetof(BossGroup, lastDisplayedPriority)},
+    {"<totalMaxObservedMaxHealth>k__BackingField", offsetof(BossGroup, totalMaxObservedMaxHealth_backing)},
+    {"<totalObservedHealth>k__BackingField", offsetof(BossGroup, totalObservedHealth_backing)},
+};
+
+static const GameStructField NetworkSoundEventDefFields[] = {
+    {"eventName", offsetof(NetworkSoundEventDef, eventName)},
+    {"<index>k__BackingField", offsetof(NetworkSoundEventDef, index_backing)},
+    {"<akId>k__BackingField", offsetof(NetworkSoundEventDef, akId_backing)},
+};
+
+static const GameStructField BuffDefFields[] = {
+    {"iconPath", offsetof(BuffDef, iconPath)},
+    {"iconSprite", offsetof(BuffDef, iconSprite)},
+    {"eliteDef", offsetof(BuffDef, eliteDef)},
+    {"startSfx", offsetof(BuffDef, startSfx)},
+    {"<buffIndex>k__BackingField", offsetof(BuffDef, buffIndex_backing)},
+    {"buffColor", offsetof(BuffDef, buffColor)},
+    {"canStack", offsetof(BuffDef, canStack)},
+    {"isDebuff", offsetof(BuffDef, isDebuff)},
+    {"isDOT", offsetof(BuffDef, isDOT)},
+    {"ignoreGrowthNectar", offsetof(BuffDef, ignoreGrowthNectar)},
+    {"isCooldown", offsetof(BuffDef, isCooldown)},
+    {"isHidden", offsetof(BuffDef, isHidden)},
+    {"flags", offsetof(BuffDef, flags)},
+    {"stackingDisplayMethod", offsetof(BuffDef, stackingDisplayMethod)},
+};
+
+static const GameStructField TeamFilterFields[] = {
+    {"teamIndexInternal", offsetof(TeamFilter, teamIndexInternal)},
+    {"defaultTeam", offsetof(TeamFilter, defaultTeam)},
+};
+
+static const GameStructField BuffWardFields[] = {
+    {"rangeIndicator", offsetof(BuffWard, rangeIndicator)},
+    {"buffDef", offsetof(BuffWard, buffDef)},
+    {"radiusCoefficientCurve", offsetof(BuffWard, radiusCoefficientCurve)},
+    {"removalSoundString", offsetof(BuffWard, removalSoundString)},
+    {"onRemoval", offsetof(BuffWard, onRemoval)},
+    {"teamFilter", offsetof(BuffWard, teamFilter)},
+    {"shape", offsetof(BuffWard, shape)},
+    {"radius", offsetof(BuffWard, radius)},
+    {"TubeHeight", offsetof(BuffWard, TubeHeight)},
+    {"CubeSize", offsetof(BuffWard, CubeSize)},
+    {"interval", offsetof(BuffWard, interval)},
+    {"buffDuration", offsetof(BuffWard, buffDuration)},
+    {"floorWard", offsetof(BuffWard, floorWard)},
+    {"expires", offsetof(BuffWard, expires)},
+    {"invertTeamFilter", offsetof(BuffWard, invertTeamFilter)},
+    {"expireDuration", offsetof(BuffWard, expireDuration)},
+    {"animateRadius", offsetof(BuffWard, animateRadius)},
+    {"removalTime", offsetof(BuffWard, removalTime)},
+    {"needsRemovalTime", offsetof(BuffWard, needsRemovalTime)},
+    {"requireGrounded", offsetof(BuffWard, requireGrounded)},
+    {"requireAlive", offsetof(BuffWard, requireAlive)},
+    {"resetStopwatchOnDisable", offsetof(BuffWard, resetStopwatchOnDisable)},
+    {"useTeamMemberFeetPosition", offsetof(BuffWard, useTeamMemberFeetPosition)},
+    {"buffTimer", offsetof(BuffWard, buffTimer)},
+    {"rangeIndicatorScaleVelocity", offsetof(BuffWard, rangeIndicatorScaleVelocity)},
+    {"stopwatch", offsetof(BuffWard, stopwatch)},
+    {"calculatedRadius", offsetof(BuffWard, calculatedRadius)},
+};
+
+static const GameStructField HoldoutZoneControllerFields[] = {
+    {"radiusIndicator", offsetof(HoldoutZoneController, radiusIndicator)},
+    {"healingNovaItemEffect", offsetof(HoldoutZoneController, healingNovaItemEffect)},
+    {"healingNovaRoot", offsetof(HoldoutZoneController, healingNovaRoot)},
+    {"inBoundsObjectiveToken", offsetof(HoldoutZoneController, inBoundsObjectiveToken)},
+    {"outOfBoundsObjectiveToken", offsetof(HoldoutZoneController, outOfBoundsObjectiveToken)},
+    {"onCharged", offsetof(HoldoutZoneController, onCharged)},
+    {"calcRadius", offsetof(HoldoutZoneController, calcRadius)},
+    {"calcChargeRate", offsetof(HoldoutZoneController, calcChargeRate)},
+    {"calcPercentageOfPlayersInRadius", offsetof(HoldoutZoneController, calcPercentageOfPlayersInRadius)},
+    {"calcAccumulatedCharge", offsetof(HoldoutZoneController, calcAccumulatedCharge)},
+    {"calcColor", offsetof(HoldoutZoneController, calcColor)},
+    {"buffWard", offsetof(HoldoutZoneController, buffWard)},
+    {"healingNovaGeneratorsByTeam", offsetof(HoldoutZoneController, healingNovaGeneratorsByTeam)},
+    {"holdoutZoneShape", offsetof(HoldoutZoneController, holdoutZoneShape)},
+    {"baseRadius", offsetof(HoldoutZoneController, baseRadius)},
+    {"minimumRadius", offsetof(HoldoutZoneController, minimumRadius)},
+    {"chargeRadiusDelta", offsetof(HoldoutZoneController, chargeRadiusDelta)},
+    {"baseChargeDuration", offsetof(HoldoutZoneController, baseChargeDuration)},
+    {"radiusSmoothTime", offsetof(HoldoutZoneController, radiusSmoothTime)},
+    {"showObjective", offsetof(HoldoutZoneController, showObjective)},
+    {"applyFocusConvergence", offsetof(HoldoutZoneController, applyFocusConvergence)},
+    {"applyHealingNova", offsetof(HoldoutZoneController, applyHealingNova)},
+    {"applyDevotedEvolution", offsetof(HoldoutZoneController, applyDevotedEvolution)},
+    {"applyDelusionResetChests", offsetof(HoldoutZoneController, applyDelusionResetChests)},
+    {"playerCountScaling", offsetof(HoldoutZoneController, playerCountScaling)},
+    {"dischargeRate", offsetof(HoldoutZoneController, dischargeRate)},
+    {"<currentRadius>k__BackingField", offsetof(HoldoutZoneController, currentRadius_backing)},
+    {"<isAnyoneCharging>k__BackingField", offsetof(HoldoutZoneController, isAnyoneCharging_backing)},
+    {"<chargingTeam>k__BackingField", offsetof(HoldoutZoneController, chargingTeam_backing)},
+    {"baseIndicatorColor", offsetof(HoldoutZoneController, baseIndicatorColor)},
+    {"radiusVelocity", offsetof(HoldoutZoneController, radiusVelocity)},
+    {"wasCharged", offsetof(HoldoutZoneController, wasCharged)},
+    {"_charge", offsetof(HoldoutZoneController, _charge)},
+};
+
+static const GameStructField SceneDefFields[] = {
+    {"sceneAddress", offsetof(SceneDef, sceneAddress)},
+    {"baseSceneNameOverride", offsetof(SceneDef, baseSceneNameOverride)},
+    {"requiredExpansion", offsetof(SceneDef, requiredExpansion)},
+    {"nameToken", offsetof(SceneDef, nameToken)},
+    {"subtitleToken", offsetof(SceneDef, subtitleToken)},
+    {"previewTexture", offsetof(SceneDef, previewTexture)},
+    {"previewTextureReference", offsetof(SceneDef, previewTextureReference)},
+    {"portalMaterial", offsetof(SceneDef, portalMaterial)},
+    {"portalMaterialReference", offsetof(SceneDef, portalMaterialReference)},
+    {"portalSelectionMessageString", offsetof(SceneDef, portalSelectionMessageString)},
+    {"loreToken", offsetof(SceneDef, loreToken)},
+    {"dioramaPrefab", offsetof(SceneDef, dioramaPrefab)},
+    {"dioramaPrefabAddress", offsetof(SceneDef, dioramaPrefabAddress)},
+    {"mainTrack", offsetof(SceneDef, mainTrack)},
+    {"bossTrack", offsetof(SceneDef, bossTrack)},
+    {"destinationsGroup", offsetof(SceneDef, destinationsGroup)},
+    {"loopedDestinationsGroup", offsetof(SceneDef, loopedDestinationsGroup)},
+    {"loopedSceneDef", offsetof(SceneDef, loopedSceneDef)},
+    {"destinations", offsetof(SceneDef, destinations)},
+    {"preferredPortalPrefab", offsetof(SceneDef, preferredPortalPrefab)},
+    {"portalPrefabAddress", offsetof(SceneDef, portalPrefabAddress)},
+    {"_cachedName", offsetof(SceneDef, _cachedName)},
+    {"sceneNameOverrides", offsetof(SceneDef, sceneNameOverrides)},
+    {"<sceneDefIndex>k__BackingField", offsetof(SceneDef, sceneDefIndex_backing)},
+    {"sceneType", offsetof(SceneDef, sceneType)},
+    {"isOfflineScene", offsetof(SceneDef, isOfflineScene)},
+    {"stageOrder", offsetof(SceneDef, stageOrder)},
+    {"filterOutOfBazaar", offsetof(SceneDef, filterOutOfBazaar)},
+    {"shouldIncludeInLogbook", offsetof(SceneDef, shouldIncludeInLogbook)},
+    {"environmentColor", offsetof(SceneDef, environmentColor)},
+    {"hasSafeStart", offsetof(SceneDef, hasSafeStart)},
+    {"suppressPlayerEntry", offsetof(SceneDef, suppressPlayerEntry)},
+    {"suppressNpcEntry", offsetof(SceneDef, suppressNpcEntry)},
+    {"blockOrbitalSkills", offsetof(SceneDef, blockOrbitalSkills)},
+    {"validForRandomSelection", offsetof(SceneDef, validForRandomSelection)},
+    {"allowItemsToSpawnObjects", offsetof(SceneDef, allowItemsToSpawnObjects)},
+    {"preventStageAdvanceCounter", offsetof(SceneDef, preventStageAdvanceCounter)},
+    {"needSkipDevotionRespawn", offsetof(SceneDef, needSkipDevotionRespawn)},
+    {"shouldUpdateSceneCollectionAfterLooping", offsetof(SceneDef, shouldUpdateSceneCollectionAfterLooping)},
+    {"isLockedBeforeLooping", offsetof(SceneDef, isLockedBeforeLooping)},
+};
+
+static const GameStructField ConvertPlayerMoneyToExperienceFields[] = {
+    {"burstSizes", offsetof(ConvertPlayerMoneyToExperience, burstSizes)},
+    {"burstTimer", offsetof(ConvertPlayerMoneyToExperience, burstTimer)},
+    {"burstInterval", offsetof(ConvertPlayerMoneyToExperience, burstInterval)},
+    {"burstCount", offsetof(ConvertPlayerMoneyToExperience, burstCount)},
+};
+
+static const GameStructField SceneExitControllerFields[] = {
+    {"destinationScene", offsetof(SceneExitController, destinationScene)},
+    {"tier1AlternateDestinationScene", offsetof(SceneExitController, tier1AlternateDestinationScene)},
+    {"tier2AlternateDestinationScene", offsetof(SceneExitController, tier2AlternateDestinationScene)},
+    {"tier3AlternateDestinationScene", offsetof(SceneExitController, tier3AlternateDestinationScene)},
+    {"tier4AlternateDestinationScene", offsetof(SceneExitController, tier4AlternateDestinationScene)},
+    {"tier5AlternateDestinationScene", offsetof(SceneExitController, tier5AlternateDestinationScene)},
+    {"experienceCollector", offsetof(SceneExitController, experienceCollector)},
+    {"useRunNextStageScene", offsetof(SceneExitController, useRunNextStageScene)},
+    {"teleportOutTimer", offsetof(SceneExitController, teleportOutTimer)},
+    {"isAlternatePath", offsetof(SceneExitController, isAlternatePath)},
+    {"isColossusPortal", offsetof(SceneExitController, isColossusPortal)},
+    {"portalUsedAfterTeleporterEventFinish", offsetof(SceneExitController, portalUsedAfterTeleporterEventFinish)},
+    {"exitState", offsetof(SceneExitController, exitState)},
+};
+
+static const GameStructField PositionIndicatorFields[] = {
+    {"targetTransform", offsetof(PositionIndicator, targetTransform)},
+    {"transform", offsetof(PositionIndicator, transform)},
+    {"insideViewObject", offsetof(PositionIndicator, insideViewObject)},
+    {"outsideViewObject", offsetof(PositionIndicator, outsideViewObject)},
+    {"alwaysVisibleObject", offsetof(PositionIndicator, alwaysVisibleObject)},
+    {"shouldRotateOutsideViewObject", offsetof(PositionIndicator, shouldRotateOutsideViewObject)},
+    {"outsideViewRotationOffset", offsetof(PositionIndicator, outsideViewRotationOffset)},
+    {"yOffset", offsetof(PositionIndicator, yOffset)},
+    {"generateDefaultPosition", offsetof(PositionIndicator, generateDefaultPosition)},
+    {"<defaultPosition>k__BackingField", offsetof(PositionIndicator, defaultPosition_backing)},
+};
+
+static const GameStructField ChargeIndicatorControllerFields[] = {
+    {"iconSprites", offsetof(ChargeIndicatorController, iconSprites)},
+    {"chargingText", offsetof(ChargeIndicatorController, chargingText)},
+    {"pingText", offsetof(ChargeIndicatorController, pingText)},
+    {"holdoutZoneController", offsetof(ChargeIndicatorController, holdoutZoneController)},
+    {"pingBounceAnimation", offsetof(ChargeIndicatorController, pingBounceAnimation)},
+    {"cachedUserProfile", offsetof(ChargeIndicatorController, cachedUserProfile)},
+    {"spriteBaseColor", offsetof(ChargeIndicatorController, spriteBaseColor)},
+    {"spriteFlashColor", offsetof(ChargeIndicatorController, spriteFlashColor)},
+    {"spriteChargingColor", offsetof(ChargeIndicatorController, spriteChargingColor)},
+    {"spriteChargedColor", offsetof(ChargeIndicatorController, spriteChargedColor)},
+    {"textBaseColor", offsetof(ChargeIndicatorController, textBaseColor)},
+    {"textChargingColor", offsetof(ChargeIndicatorController, textChargingColor)},
+    {"playerPingColor", offsetof(ChargeIndicatorController, playerPingColor)},
+    {"disableTextWhenNotCharging", offsetof(ChargeIndicatorController, disableTextWhenNotCharging)},
+    {"disableTextWhenCharged", offsetof(ChargeIndicatorController, disableTextWhenCharged)},
+    {"flashWhenNotCharging", offsetof(ChargeIndicatorController, flashWhenNotCharging)},
+    {"flashFrequency", offsetof(ChargeIndicatorController, flashFrequency)},
+    {"isCharging", offsetof(ChargeIndicatorController, isCharging)},
+    {"isCharged", offsetof(ChargeIndicatorController, isCharged)},
+    {"isDiscovered", offsetof(ChargeIndicatorController, isDiscovered)},
+    {"isActivated", offsetof(ChargeIndicatorController, isActivated)},
+    {"<chargeValue>k__BackingField", offsetof(ChargeIndicatorController, chargeValue_backing)},
+    {"flashStopwatch", offsetof(ChargeIndicatorController, flashStopwatch)},
+    {"isPinged", offsetof(ChargeIndicatorController, isPinged)},
+    {"showIndicatorWhenDiscovered", offsetof(ChargeIndicatorController, showIndicatorWhenDiscovered)},
+};
+
+static const GameStructField InteractableSpawnCardFields[] = {
+    {"orientToFloor", offsetof(InteractableSpawnCard, orientToFloor)},
+    {"slightlyRandomizeOrientation", offsetof(InteractableSpawnCard, slightlyRandomizeOrientation)},
+    {"skipSpawnWhenSacrificeArtifactEnabled", offsetof(InteractableSpawnCard, skipSpawnWhenSacrificeArtifactEnabled)},
+    {"weightScalarWhenSacrificeArtifactEnabled", offsetof(InteractableSpawnCard, weightScalarWhenSacrificeArtifactEnabled)},
+    {"skipSpawnWhenDevotionArtifactEnabled", offsetof(InteractableSpawnCard, skipSpawnWhenDevotionArtifactEnabled)},
+    {"maxSpawnsPerStage", offsetof(InteractableSpawnCard, maxSpawnsPerStage)},
+    {"prismaticTrialSpawnChance", offsetof(InteractableSpawnCard, prismaticTrialSpawnChance)},
+};
+
+static const GameStructField PortalSpawnerFields[] = {
+    {"portalSpawnCard", offsetof(PortalSpawner, portalSpawnCard)},
+    {"spawnReferenceLocation", offsetof(PortalSpawner, spawnReferenceLocation)},
+    {"spawnPreviewMessageToken", offsetof(PortalSpawner, spawnPreviewMessageToken)},
+    {"spawnMessageToken", offsetof(PortalSpawner, spawnMessageToken)},
+    {"modelChildLocator", offsetof(PortalSpawner, modelChildLocator)},
+    {"previewChildName", offsetof(PortalSpawner, previewChildName)},
+    {"requiredExpansion", offsetof(PortalSpawner, requiredExpansion)},
+    {"bannedEventFlag", offsetof(PortalSpawner, bannedEventFlag)},
+    {"spawnReferenceLocationOverride", offsetof(PortalSpawner, spawnReferenceLocationOverride)},
+    {"requiredEventFlag", offsetof(PortalSpawner, requiredEventFlag)},
+    {"validStages", offsetof(PortalSpawner, validStages)},
+    {"invalidStages", offsetof(PortalSpawner, invalidStages)},
+    {"validStageTiers", offsetof(PortalSpawner, validStageTiers)},
+    {"rng", offsetof(PortalSpawner, rng)},
+    {"previewChild", offsetof(PortalSpawner, previewChild)},
+    {"spawnChance", offsetof(PortalSpawner, spawnChance)},
+    {"minSpawnDistance", offsetof(PortalSpawner, minSpawnDistance)},
+    {"maxSpawnDistance", offsetof(PortalSpawner, maxSpawnDistance)},
+    {"minStagesCleared", offsetof(PortalSpawner, minStagesCleared)},
+    {"registerSelfToPortalRemotelyOnActivation", offsetof(PortalSpawner, registerSelfToPortalRemotelyOnActivation)},
+    {"hasRegisteredToTeleporter", offsetof(PortalSpawner, hasRegisteredToTeleporter)},
+    {"willSpawn", offsetof(PortalSpawner, willSpawn)},
+};
+
+static const GameStructField TeleporterInteractionFields[] = {
+    {"bonusDirector", offsetof(TeleporterInteraction, bonusDirector)},
+    {"bossDirector", offsetof(TeleporterInteraction, bossDirector)},
+    {"companionBoss", offsetof(TeleporterInteraction, companionBoss)},
+    {"mainStateMachine", offsetof(TeleporterInteraction, mainStateMachine)},
+    {"outsideInteractableLocker", offsetof(TeleporterInteraction, outsideInteractableLocker)},
+    {"beginContextString", offsetof(TeleporterInteraction, beginContextString)},
+    {"exitContextString", offsetof(TeleporterInteraction, exitContextString)},
+    {"interactableObjectMap", offsetof(TeleporterInteraction, interactableObjectMap)},
+    {"bossGroup", offsetof(TeleporterInteraction, bossGroup)},
+    {"modelChildLocator", offsetof(TeleporterInteraction, modelChildLocator)},
+    {"<holdoutZoneController>k__BackingField", offsetof(TeleporterInteraction, holdoutZoneController_backing)},
+    {"<sceneExitController>k__BackingField", offsetof(TeleporterInteraction, sceneExitController_backing)},
+    {"teleporterPositionIndicator", offsetof(TeleporterInteraction, teleporterPositionIndicator)},
+    {"teleporterChargeIndicatorController", offsetof(TeleporterInteraction, teleporterChargeIndicatorController)},
+    {"_bossShrineCounter", offsetof(TeleporterInteraction, _bossShrineCounter)},
+    {"rng", offsetof(TeleporterInteraction, rng)},
+    {"chargeActivatorServer", offsetof(TeleporterInteraction, chargeActivatorServer)},
+    {"shopPortalSpawnCard", offsetof(TeleporterInteraction, shopPortalSpawnCard)},
+    {"goldshoresPortalSpawnCard", offsetof(TeleporterInteraction, goldshoresPortalSpawnCard)},
+    {"msPortalSpawnCard", offsetof(TeleporterInteraction, msPortalSpawnCard)},
+    {"hiddenRealmPortalSpawnCard", offsetof(TeleporterInteraction, hiddenRealmPortalSpawnCard)},
+    {"portalSpawners", offsetof(TeleporterInteraction, portalSpawners)},
+    {"currentPings", offsetof(TeleporterInteraction, currentPings)},
+    {"cachedParticleMinSizeScript", offsetof(TeleporterInteraction, cachedParticleMinSizeScript)},
+    {"cachedLocalUser", offsetof(TeleporterInteraction, cachedLocalUser)},
+    {"triggerWavePillarInterval", offsetof(TeleporterInteraction, triggerWavePillarInterval)},
+    {"<sceneStartAmbientLevel>k__BackingField", offsetof(TeleporterInteraction, sceneStartAmbientLevel_backing)},
+    {"_locked", offsetof(TeleporterInteraction, _locked)},
+    {"_shrineBonusStacks", offsetof(TeleporterInteraction, _shrineBonusStacks)},
+    {"<isAccessingCodes>k__BackingField", offsetof(TeleporterInteraction, isAccessingCodes_backing)},
+    {"isDiscovered", offsetof(TeleporterInteraction, isDiscovered)},
+    {"isActivated", offsetof(TeleporterInteraction, isActivated)},
+    {"discoveryRadius", offsetof(TeleporterInteraction, discoveryRadius)},
+    {"originalTeleporterColor", offsetof(TeleporterInteraction, originalTeleporterColor)},
+    {"_shouldAttemptToSpawnShopPortal", offsetof(TeleporterInteraction, _shouldAttemptToSpawnShopPortal)},
+    {"_shouldAttemptToSpawnGoldshoresPortal", offsetof(TeleporterInteraction, _shouldAttemptToSpawnGoldshoresPortal)},
+    {"_shouldAttemptToSpawnMSPortal", offsetof(TeleporterInteraction, _shouldAttemptToSpawnMSPortal)},
+    {"_shouldAttemptToSpawnHiddenRealmPortal", offsetof(TeleporterInteraction, _shouldAttemptToSpawnHiddenRealmPortal)},
+    {"monstersCleared", offsetof(TeleporterInteraction, monstersCleared)},
+    {"showExtraBossesIndicator", offsetof(TeleporterInteraction, showExtraBossesIndicator)},
+    {"showAccessCodesIndicator", offsetof(TeleporterInteraction, showAccessCodesIndicator)},
+    {"baseShopSpawnChance", offsetof(TeleporterInteraction, baseShopSpawnChance)},
+    {"skipCombat", offsetof(TeleporterInteraction, skipCombat)},
+    {"particleScaleUpdateTimer", offsetof(TeleporterInteraction, particleScaleUpdateTimer)},
+    {"shouldScaleParticles", offsetof(TeleporterInteraction, shouldScaleParticles)},
+};
+
+static const GameStructField BodyAnimatorSmoothingParametersFields[] = {
+    {"smoothingParameters", offsetof(BodyAnimatorSmoothingParameters, smoothingParameters)},
+};
+
+static const GameStructField RigidbodyMotorFields[] = {
+    {"rigid", offsetof(RigidbodyMotor, rigid)},
+    {"forcePID", offsetof(RigidbodyMotor, forcePID)},
+    {"animatorForward", offsetof(RigidbodyMotor, animatorForward)},
+    {"animatorRight", offsetof(RigidbodyMotor, animatorRight)},
+    {"animatorUp", offsetof(RigidbodyMotor, animatorUp)},
+    {"networkIdentity", offsetof(RigidbodyMotor, networkIdentity)},
+    {"characterBody", offsetof(RigidbodyMotor, characterBody)},
+    {"inputBank", offsetof(RigidbodyMotor, inputBank)},
+    {"modelLocator", offsetof(RigidbodyMotor, modelLocator)},
+    {"animator", offsetof(RigidbodyMotor, animator)},
+    {"bodyAnimatorSmoothingParameters", offsetof(RigidbodyMotor, bodyAnimatorSmoothingParameters)},
+    {"healthComponent", offsetof(RigidbodyMotor, healthComponent)},
+    {"onMovementHit", offsetof(RigidbodyMotor, onMovementHit)},
+    {"moveVector", offsetof(RigidbodyMotor, moveVector)},
+    {"centerOfMassOffset", offsetof(RigidbodyMotor, centerOfMassOffset)},
+    {"enableOverrideMoveVectorInLocalSpace", offsetof(RigidbodyMotor, enableOverrideMoveVectorInLocalSpace)},
+    {"canTakeImpactDamage", offsetof(RigidbodyMotor, canTakeImpactDamage)},
+    {"overrideMoveVectorInLocalSpace", offsetof(RigidbodyMotor, overrideMoveVectorInLocalSpace)},
+    {"rootMotion", offsetof(RigidbodyMotor, rootMotion)},
+};
+
+static const GameStructField HurtBoxGroupFields[] = {
+    {"hurtBoxes", offsetof(HurtBoxGroup, hurtBoxes)},
+    {"mainHurtBox", offsetof(HurtBoxGroup, mainHurtBox)},
+    {"bullseyeCount", offsetof(HurtBoxGroup, bullseyeCount)},
+    {"_hurtBoxesDeactivatorCounter", offsetof(HurtBoxGroup, _hurtBoxesDeactivatorCounter)},
+};
+
+static const GameStructField CharacterModelFields[] = {
+    {"body", offsetof(CharacterModel, body)},
+    {"itemDisplayRuleSet", offsetof(CharacterModel, itemDisplayRuleSet)},
+    {"gameObjectActivationTransforms", offsetof(CharacterModel, gameObjectActivationTransforms)},
+    {"customGameObjectActivationTransforms", offsetof(CharacterModel, customGameObjectActivationTransforms)},
+    {"baseRendererInfos", offsetof(CharacterModel, baseRendererInfos)},
+    {"baseLightInfos", offsetof(CharacterModel, baseLightInfos)},
+    {"childLocator", offsetof(CharacterModel, childLocator)},
+    {"goldAffixEffect", offsetof(CharacterModel, goldAffixEffect)},
+    {"hurtBoxInfos", offsetof(CharacterModel, hurtBoxInfos)},
+    {"coreTransform", offsetof(CharacterModel, coreTransform)},
+    {"temporaryOverlays", offsetof(CharacterModel, temporaryOverlays)},
+    {"propertyStorage", offsetof(CharacterModel, propertyStorage)},
+    {"mainSkinnedMeshRenderer", offsetof(CharacterModel, mainSkinnedMeshRenderer)},
+    {"visibilityChecker", offsetof(CharacterModel, visibilityChecker)},
+    {"particleMaterialOverride", offsetof(CharacterModel, particleMaterialOverride)},
+    {"poisonAffixEffect", offsetof(CharacterModel, poisonAffixEffect)},
+    {"hauntedAffixEffect", offsetof(CharacterModel, hauntedAffixEffect)},
+    {"voidAffixEffect", offsetof(CharacterModel, voidAffixEffect)},
+    {"enabledItemDisplays", offsetof(CharacterModel, enabledItemDisplays)},
+    {"parentedPrefabDisplays", offsetof(CharacterModel, parentedPrefabDisplays)},
+    {"limbMaskDisplays", offsetof(CharacterModel, limbMaskDisplays)},
+    {"limbFlagSet", offsetof(CharacterModel, limbFlagSet)},
+    {"currentOverlays", offsetof(CharacterModel, currentOverlays)},
+    {"rtpcEliteEnemy", offsetof(CharacterModel, rtpcEliteEnemy)},
+    {"autoPopulateLightInfos", offsetof(CharacterModel, autoPopulateLightInfos)},
+    {"fullBodyPing", offsetof(CharacterModel, fullBodyPing)},
+    {"_visibility", offsetof(CharacterModel, _visibility)},
+    {"_isGhost", offsetof(CharacterModel, _isGhost)},
+    {"_isDoppelganger", offsetof(CharacterModel, _isDoppelganger)},
+    {"_isEcho", offsetof(CharacterModel, _isEcho)},
+    {"_invisibilityCount", offsetof(CharacterModel, _invisibilityCount)},
+    {"materialsDirty", offsetof(CharacterModel, materialsDirty)},
+    {"inventoryEquipmentIndex", offsetof(CharacterModel, inventoryEquipmentIndex)},
+    {"myEliteIndex", offsetof(CharacterModel, myEliteIndex)},
+    {"constraintItemDisplaysScale", offsetof(CharacterModel, constraintItemDisplaysScale)},
+    {"fade", offsetof(CharacterModel, fade)},
+    {"firstPersonFade", offsetof(CharacterModel, firstPersonFade)},
+    {"ignoreJitterBones", offsetof(CharacterModel, ignoreJitterBones)},
+    {"corpseFade", offsetof(CharacterModel, corpseFade)},
+    {"speedFade", offsetof(CharacterModel, speedFade)},
+    {"CharacterOnScreen", offsetof(CharacterModel, CharacterOnScreen)},
+    {"lightColorOverride", offsetof(CharacterModel, lightColorOverride)},
+    {"useHullForFadeCalc", offsetof(CharacterModel, useHullForFadeCalc)},
+    {"affixHauntedCloakLockoutDuration", offsetof(CharacterModel, affixHauntedCloakLockoutDuration)},
+    {"currentEquipmentDisplayIndex", offsetof(CharacterModel, currentEquipmentDisplayIndex)},
+    {"activeOverlayCount", offsetof(CharacterModel, activeOverlayCount)},
+    {"wasPreviouslyClayGooed", offsetof(CharacterModel, wasPreviouslyClayGooed)},
+    {"wasPreviouslyHaunted", offsetof(CharacterModel, wasPreviouslyHaunted)},
+    {"wasPreviouslyOiled", offsetof(CharacterModel, wasPreviouslyOiled)},
+    {"wasPreviouslyAccelerantGooded", offsetof(CharacterModel, wasPreviouslyAccelerantGooded)},
+    {"wasPreviouslyTransferDebuffed", offsetof(CharacterModel, wasPreviouslyTransferDebuffed)},
+    {"wasPreviouslyOverheated", offsetof(CharacterModel, wasPreviouslyOverheated)},
+    {"wasPreviouslyParrying", offsetof(CharacterModel, wasPreviouslyParrying)},
+    {"shaderDroneUpgradePair", offsetof(CharacterModel, shaderDroneUpgradePair)},
+    {"shaderEliteRampIndex", offsetof(CharacterModel, shaderEliteRampIndex)},
+    {"eliteChanged", offsetof(CharacterModel, eliteChanged)},
+    {"activeOverlays", offsetof(CharacterModel, activeOverlays)},
+    {"oldOverlays", offsetof(CharacterModel, oldOverlays)},
+    {"hitFlashValue", offsetof(CharacterModel, hitFlashValue)},
+    {"healFlashValue", offsetof(CharacterModel, healFlashValue)},
+    {"oldHit", offsetof(CharacterModel, oldHit)},
+    {"oldHeal", offsetof(CharacterModel, oldHeal)},
+    {"oldFade", offsetof(CharacterModel, oldFade)},
+    {"oldEliteIndex", offsetof(CharacterModel, oldEliteIndex)},
+    {"forceUpdate", offsetof(CharacterModel, forceUpdate)},
+};
+
+static const GameStructField RigidbodyDirectionFields[] = {
+    {"rigid", offsetof(RigidbodyDirection, rigid)},
+    {"angularVelocityPID", offsetof(RigidbodyDirection, angularVelocityPID)},
+    {"torquePID", offsetof(RigidbodyDirection, torquePID)},
+    {"modelLocator", offsetof(RigidbodyDirection, modelLocator)},
+    {"animator", offsetof(RigidbodyDirection, animator)},
+    {"animatorXCycle", offsetof(RigidbodyDirection, animatorXCycle)},
+    {"animatorYCycle", offsetof(RigidbodyDirection, animatorYCycle)},
+    {"animatorZCycle", offsetof(RigidbodyDirection, animatorZCycle)},
+    {"inputBank", offsetof(RigidbodyDirection, inputBank)},
+    {"visibility", offsetof(RigidbodyDirection, visibility)},
+    {"aimDirection", offsetof(RigidbodyDirection, aimDirection)},
+    {"freezeXRotation", offsetof(RigidbodyDirection, freezeXRotation)},
+    {"freezeYRotation", offsetof(RigidbodyDirection, freezeYRotation)},
+    {"freezeZRotation", offsetof(RigidbodyDirection, freezeZRotation)},
+    {"animatorXCycleIndex", offsetof(RigidbodyDirection, animatorXCycleIndex)},
+    {"animatorYCycleIndex", offsetof(RigidbodyDirection, animatorYCycleIndex)},
+    {"animatorZCycleIndex", offsetof(RigidbodyDirection, animatorZCycleIndex)},
+    {"animatorTorqueScale", offsetof(RigidbodyDirection, animatorTorqueScale)},
+    {"targetTorque", offsetof(RigidbodyDirection, targetTorque)},
+};
+
+static const GameStructField RailMotorFields[] = {
+    {"modelAnimator", offsetof(RailMotor, modelAnimator)},
+    {"inputBank", offsetof(RailMotor, inputBank)},
+    {"railGraph", offsetof(RailMotor, railGraph)},
+    {"characterBody", offsetof(RailMotor, characterBody)},
+    {"characterDirection", offsetof(RailMotor, characterDirection)},
+    {"inputMoveVector", offsetof(RailMotor, inputMoveVector)},
+    {"rootMotion", offsetof(RailMotor, rootMotion)},
+    {"nodeA", offsetof(RailMotor, nodeA)},
+    {"nodeB", offsetof(RailMotor, nodeB)},
+    {"currentLink", offsetof(RailMotor, currentLink)},
+    {"linkLerp", offsetof(RailMotor, linkLerp)},
+    {"projectedMoveVector", offsetof(RailMotor, projectedMoveVector)},
+    {"nodeAPosition", offsetof(RailMotor, nodeAPosition)},
+    {"nodeBPosition", offsetof(RailMotor, nodeBPosition)},
+    {"linkVector", offsetof(RailMotor, linkVector)},
+    {"linkLength", offsetof(RailMotor, linkLength)},
+    {"currentMoveSpeed", offsetof(RailMotor, currentMoveSpeed)},
+    {"useRootMotion", offsetof(RailMotor, useRootMotion)},
+};
+
+static const GameStructField CharacterEmoteDefinitionsFields[] = {
+    {"emoteDefinitions", offsetof(CharacterEmoteDefinitions, emoteDefinitions)},
+};
+
+static const GameStructField LoopSoundDefFields[] = {
+    {"startSoundName", offsetof(LoopSoundDef, startSoundName)},
+    {"stopSoundName", offsetof(LoopSoundDef, stopSoundName)},
+};
+
+static const GameStructField ProjectileGhostControllerFields[] = {
+    {"transform", offsetof(ProjectileGhostController, transform)},
+    {"emh", offsetof(ProjectileGhostController, emh)},
+    {"<authorityTransform>k__BackingField", offsetof(ProjectileGhostController, authorityTransform_backing)},
+    {"<predictionTransform>k__BackingField", offsetof(ProjectileGhostController, predictionTransform_backing)},
+    {"ParentProjectileDestroyedEvent", offsetof(ProjectileGhostController, ParentProjectileDestroyedEvent)},
+    {"migration", offsetof(ProjectileGhostController, migration)},
+    {"inheritScaleFromProjectile", offsetof(ProjectileGhostController, inheritScaleFromProjectile)},
+    {"alreadyRunParentProjectileDestroyedEvent", offsetof(ProjectileGhostController, alreadyRunParentProjectileDestroyedEvent)},
+};
+
+static const GameStructField ProjectileControllerFields[] = {
+    {"ghostPrefab", offsetof(ProjectileController, ghostPrefab)},
+    {"ghostPrefabReference", offsetof(ProjectileController, ghostPrefabReference)},
+    {"ghostTransformAnchor", offsetof(ProjectileController, ghostTransformAnchor)},
+    {"startSound", offsetof(ProjectileController, startSound)},
+    {"flightSoundLoop", offsetof(ProjectileController, flightSoundLoop)},
+    {"rigidbody", offsetof(ProjectileController, rigidbody)},
+    {"<teamFilter>k__BackingField", offsetof(ProjectileController, teamFilter_backing)},
+    {"<ghost>k__BackingField", offsetof(ProjectileController, ghost_backing)},
+    {"owner", offsetof(ProjectileController, owner)},
+    {"onInitialized", offsetof(ProjectileController, onInitialized)},
+    {"<clientAuthorityOwner>k__BackingField", offsetof(ProjectileController, clientAuthorityOwner_backing)},
+    {"myColliders", offsetof(ProjectileController, myColliders)},
+    {"_efhGhost", offsetof(ProjectileController, _efhGhost)},
+    {"catalogIndex", offsetof(ProjectileController, catalogIndex)},
+    {"cannotBeDeleted", offsetof(ProjectileController, cannotBeDeleted)},
+    {"authorityHandlesCollisionEvents", offsetof(ProjectileController, authorityHandlesCollisionEvents)},
+    {"<isPrediction>k__BackingField", offsetof(ProjectileController, isPrediction_backing)},
+    {"canImpactOnTrigger", offsetof(ProjectileController, canImpactOnTrigger)},
+    {"<shouldPlaySounds>k__BackingField", offsetof(ProjectileController, shouldPlaySounds_backing)},
+    {"allowPrediction", offsetof(ProjectileController, allowPrediction)},
+    {"predictionId", offsetof(ProjectileController, predictionId)},
+    {"localCollisionHappened", offsetof(ProjectileController, localCollisionHappened)},
+    {"<procChainMask>k__BackingField", offsetof(ProjectileController, procChainMask_backing)},
+    {"procCoefficient", offsetof(ProjectileController, procCoefficient)},
+    {"combo", offsetof(ProjectileController, combo)},
+    {"CheckChildrenForCollidersAndIncludeDisabled", offsetof(ProjectileController, CheckChildrenForCollidersAndIncludeDisabled)},
+    {"___ownerNetId", offsetof(ProjectileController, ___ownerNetId)},
+};
+
+static const GameStructField ItemTierDefFields[] = {
+    {"bgIconTexture", offsetof(ItemTierDef, bgIconTexture)},
+    {"highlightPrefab", offsetof(ItemTierDef, highlightPrefab)},
+    {"dropletDisplayPrefab", offsetof(ItemTierDef, dropletDisplayPrefab)},
+    {"_tier", offsetof(ItemTierDef, _tier)},
+    {"colorIndex", offsetof(ItemTierDef, colorIndex)},
+    {"darkColorIndex", offsetof(ItemTierDef, darkColorIndex)},
+    {"isDroppable", offsetof(ItemTierDef, isDroppable)},
+    {"canScrap", offsetof(ItemTierDef, canScrap)},
+    {"canRestack", offsetof(ItemTierDef, canRestack)},
+    {"canRebirth", offsetof(ItemTierDef, canRebirth)},
+    {"pickupRules", offsetof(ItemTierDef, pickupRules)},
+};
+
+static const GameStructField ItemTagFields[] = {
+    {"value__", offsetof(ItemTag, value__)},
+};
+
+static const GameStructField ItemDefFields[] = {
+    {"_itemTierDef", offsetof(ItemDef, _itemTierDef)},
+    {"nameToken", offsetof(ItemDef, nameToken)},
+    {"pickupToken", offsetof(ItemDef, pickupToken)},
+    {"descriptionToken", offsetof(ItemDef, descriptionToken)},
+    {"loreToken", offsetof(ItemDef, loreToken)},
+    {"unlockableDef", offsetof(ItemDef, unlockableDef)},
+    {"pickupModelPrefab", offsetof(ItemDef, pickupModelPrefab)},
+    {"pickupModelReference", offsetof(ItemDef, pickupModelReference)},
+    {"pickupIconSprite", offsetof(ItemDef, pickupIconSprite)},
+    {"tags", offsetof(ItemDef, tags)},
+    {"requiredExpansion", offsetof(ItemDef, requiredExpansion)},
+    {"_itemIndex", offsetof(ItemDef, _itemIndex)},
+    {"deprecatedTier", offsetof(ItemDef, deprecatedTier)},
+    {"isConsumed", offsetof(ItemDef, isConsumed)},
+    {"hidden", offsetof(ItemDef, hidden)},
+    {"canRemove", offsetof(ItemDef, canRemove)},
+};
+
+static const GameStructField SkillLocatorFields[] = {
+    {"primary", offsetof(SkillLocator, primary)},
+    {"secondary", offsetof(SkillLocator, secondary)},
+    {"utility", offsetof(SkillLocator, utility)},
+    {"special", offsetof(SkillLocator, special)},
+    {"passiveSkill", offsetof(SkillLocator, passiveSkill)},
+    {"primaryBonusStockOverrideSkill", offsetof(SkillLocator, primaryBonusStockOverrideSkill)},
+    {"secondaryBonusStockOverrideSkill", offsetof(SkillLocator, secondaryBonusStockOverrideSkill)},
+    {"utilityBonusStockOverrideSkill", offsetof(SkillLocator, utilityBonusStockOverrideSkill)},
+    {"specialBonusStockOverrideSkill", offsetof(SkillLocator, specialBonusStockOverrideSkill)},
+    {"networkIdentity", offsetof(SkillLocator, networkIdentity)},
+    {"allSkills", offsetof(SkillLocator, allSkills)},
+    {"hasEffectiveAuthority", offsetof(SkillLocator, hasEffectiveAuthority)},
+    {"skillDefDirtyFlags", offsetof(SkillLocator, skillDefDirtyFlags)},
+    {"inDeserialize", offsetof(SkillLocator, inDeserialize)},
+};
+
+static const GameStructField GenericSkillFields[] = {
+    {"<skillDef>k__BackingField", offsetof(GenericSkill, skillDef_backing)},
+    {"_skillFamily", offsetof(GenericSkill, _skillFamily)},
+    {"<baseSkill>k__BackingField", offsetof(GenericSkill, baseSkill_backing)},
+    {"skillName", offsetof(GenericSkill, skillName)},
+    {"loadoutTitleToken", offsetof(GenericSkill, loadoutTitleToken)},
+    {"<stateMachine>k__BackingField", offsetof(GenericSkill, stateMachine_backing)},
+    {"<skillInstanceData>k__BackingField", offsetof(GenericSkill, skillInstanceData_backing)},
+    {"<characterBody>k__BackingField", offsetof(GenericSkill, characterBody_backing)},
+    {"<defaultSkillDef>k__BackingField", offsetof(GenericSkill, defaultSkillDef_backing)},
+    {"onSkillChanged", offsetof(GenericSkill, onSkillChanged)},
+    {"skillAkEvent", offsetof(GenericSkill, skillAkEvent)},
+    {"skillOverrides", offsetof(GenericSkill, skillOverrides)},
+    {"_customStateMachineResolver", offsetof(GenericSkill, _customStateMachineResolver)},
+    {"<overriddenRechargeInterval>k__BackingField", offsetof(GenericSkill, overriddenRechargeInterval_backing)},
+    {"hideInCharacterSelect", offsetof(GenericSkill, hideInCharacterSelect)},
+    {"hideInLoadoutSelect", offsetof(GenericSkill, hideInLoadoutSelect)},
+    {"<isCooldownBlocked>k__BackingField", offsetof(GenericSkill, isCooldownBlocked_backing)},
+    {"currentSkillOverride", offsetof(GenericSkill, currentSkillOverride)},
+    {"bonusStockFromBody", offsetof(GenericSkill, bonusStockFromBody)},
+    {"<maxStock>k__BackingField", offsetof(GenericSkill, maxStock_backing)},
+    {"baseStock", offsetof(GenericSkill, baseStock)},
+    {"finalRechargeInterval", offsetof(GenericSkill, finalRechargeInterval)},
+    {"_cooldownScale", offsetof(GenericSkill, _cooldownScale)},
+    {"_flatCooldownReduction", offsetof(GenericSkill, _flatCooldownReduction)},
+    {"_temporaryCooldownPenalty", offsetof(GenericSkill, _temporaryCooldownPenalty)},
+    {"_cooldownOverride", offsetof(GenericSkill, _cooldownOverride)},
+    {"baseRechargeStopwatch", offsetof(GenericSkill, baseRechargeStopwatch)},
+    {"hasExecutedSuccessfully", offsetof(GenericSkill, hasExecutedSuccessfully)},
+};
+
+static const GameStructField SkillDefFields[] = {
+    {"skillName", offsetof(SkillDef, skillName)},
+    {"skillNameToken", offsetof(SkillDef, skillNameToken)},
+    {"skillDescriptionToken", offsetof(SkillDef, skillDescriptionToken)},
+    {"keywordTokens", offsetof(SkillDef, keywordTokens)},
+    {"icon", offsetof(SkillDef, icon)},
+    {"activationStateMachineName", offsetof(SkillDef, activationStateMachineName)},
+    {"activationState", offsetof(SkillDef, activationState)},
+    {"<skillIndex>k__BackingField", offsetof(SkillDef, skillIndex_backing)},
+    {"interruptPriority", offsetof(SkillDef, interruptPriority)},
+    {"baseRechargeInterval", offsetof(SkillDef, baseRechargeInterval)},
+    {"baseMaxStock", offsetof(SkillDef, baseMaxStock)},
+    {"rechargeStock", offsetof(SkillDef, rechargeStock)},
+    {"requiredStock", offsetof(SkillDef, requiredStock)},
+    {"stockToConsume", offsetof(SkillDef, stockToConsume)},
+    {"attackSpeedBuffsRestockSpeed", offsetof(SkillDef, attackSpeedBuffsRestockSpeed)},
+    {"attackSpeedBuffsRestockSpeed_Multiplier", offsetof(SkillDef, attackSpeedBuffsRestockSpeed_Multiplier)},
+    {"resetCooldownTimerOnUse", offsetof(SkillDef, resetCooldownTimerOnUse)},
+    {"fullRestockOnAssign", offsetof(SkillDef, fullRestockOnAssign)},
+    {"dontAllowPastMaxStocks", offsetof(SkillDef, dontAllowPastMaxStocks)},
+    {"beginSkillCooldownOnSkillEnd", offsetof(SkillDef, beginSkillCooldownOnSkillEnd)},
+    {"isCooldownBlockedUntilManuallyReset", offsetof(SkillDef, isCooldownBlockedUntilManuallyReset)},
+    {"cancelSprintingOnActivation", offsetof(SkillDef, cancelSprintingOnActivation)},
+    {"forceSprintDuringState", offsetof(SkillDef, forceSprintDuringState)},
+    {"canceledFromSprinting", offsetof(SkillDef, canceledFromSprinting)},
+    {"isCombatSkill", offsetof(SkillDef, isCombatSkill)},
+    {"mustKeyPress", offsetof(SkillDef, mustKeyPress)},
+    {"triggeredByPressRelease", offsetof(SkillDef, triggeredByPressRelease)},
+    {"autoHandleLuminousShot", offsetof(SkillDef, autoHandleLuminousShot)},
+    {"suppressSkillActivation", offsetof(SkillDef, suppressSkillActivation)},
+    {"hideStockCount", offsetof(SkillDef, hideStockCount)},
+    {"hideCooldown", offsetof(SkillDef, hideCooldown)},
+};
+
+static const GameStructField BullseyeSearchFields[] = {
+    {"viewer", offsetof(BullseyeSearch, viewer)},
+    {"candidatesEnumerable", offsetof(BullseyeSearch, candidatesEnumerable)},
+    {"DistinctEntityHash", offsetof(BullseyeSearch, DistinctEntityHash)},
+    {"searchOrigin", offsetof(BullseyeSearch, searchOrigin)},
+    {"searchDirection", offsetof(BullseyeSearch, searchDirection)},
+    {"minThetaDot", offsetof(BullseyeSearch, minThetaDot)},
+    {"maxThetaDot", offsetof(BullseyeSearch, maxThetaDot)},
+    {"minDistanceFilter", offsetof(BullseyeSearch, minDistanceFilter)},
+    {"maxDistanceFilter", offsetof(BullseyeSearch, maxDistanceFilter)},
+    {"teamMaskFilter", offsetof(BullseyeSearch, teamMaskFilter)},
+    {"filterByLoS", offsetof(BullseyeSearch, filterByLoS)},
+    {"filterByDistinctEntity", offsetof(BullseyeSearch, filterByDistinctEntity)},
+    {"queryTriggerInteraction", offsetof(BullseyeSearch, queryTriggerInteraction)},
+    {"sortMode", offsetof(BullseyeSearch, sortMode)},
+};
+
+static const GameStructField HuntressTrackerFields[] = {
+    {"trackingPrefab", offsetof(HuntressTracker, trackingPrefab)},
+    {"trackingTarget", offsetof(HuntressTracker, trackingTarget)},
+    {"characterBody", offsetof(HuntressTracker, characterBody)},
+    {"teamComponent", offsetof(HuntressTracker, teamComponent)},
+    {"inputBank", offsetof(HuntressTracker, inputBank)},
+    {"indicator", offsetof(HuntressTracker, indicator)},
+    {"search", offsetof(HuntressTracker, search)},
+    {"maxTrackingDistance", offsetof(HuntressTracker, maxTrackingDistance)},
+    {"maxTrackingAngle", offsetof(HuntressTracker, maxTrackingAngle)},
+    {"trackerUpdateFrequency", offsetof(HuntressTracker, trackerUpdateFrequency)},
+    {"trackerUpdateStopwatch", offsetof(HuntressTracker, trackerUpdateStopwatch)},
+};
+
+static const GameStructField SkillFamilyFields[] = {
+    {"variants", offsetof(SkillFamily, variants)},
+    {"<catalogIndex>k__BackingField", offsetof(SkillFamily, catalogIndex_backing)},
+    {"defaultVariantIndex", offsetof(SkillFamily, defaultVariantIndex)},
+};
+
+static const GameStructField PickupPickerControllerFields[] = {
+    {"panelPrefab", offsetof(PickupPickerController, panelPrefab)},
+    {"onPickupSelected", offsetof(PickupPickerController, onPickupSelected)},
+    {"onUniquePickupSelected", offsetof(PickupPickerController, onUniquePickupSelected)},
+    {"onServerInteractionBegin", offsetof(PickupPickerController, onServerInteractionBegin)},
+    {"contextString", offsetof(PickupPickerController, contextString)},
+    {"excludedItemsDropTable", offsetof(PickupPickerController, excludedItemsDropTable)},
+    {"includedItemsDropTable", offsetof(PickupPickerController, includedItemsDropTable)},
+    {"delusionInventory", offsetof(PickupPickerController, delusionInventory)},
+    {"networkUIPromptController", offsetof(PickupPickerController, networkUIPromptController)},
+    {"panelInstance", offsetof(PickupPickerController, panelInstance)},
+    {"panelInstanceController", offsetof(PickupPickerController, panelInstanceController)},
+    {"chestGeneratedFrom", offsetof(PickupPickerController, chestGeneratedFrom)},
+    {"options", offsetof(PickupPickerController, options)},
+    {"eventFunctions", offsetof(PickupPickerController, eventFunctions)},
+    {"cutoffDistance", offsetof(PickupPickerController, cutoffDistance)},
+    {"canUseTemporaryItems", offsetof(PickupPickerController, canUseTemporaryItems)},
+    {"<available>k__BackingField", offsetof(PickupPickerController, available_backing)},
+    {"shouldProximityHighlight", offsetof(PickupPickerController, shouldProximityHighlight)},
+    {"synchronizeItemSelectionAcrossNetwork", offsetof(PickupPickerController, synchronizeItemSelectionAcrossNetwork)},
+    {"isDelusionChoice", offsetof(PickupPickerController, isDelusionChoice)},
+    {"isRebirthChoice", offsetof(PickupPickerController, isRebirthChoice)},
+    {"allowRemoteOpInteraction", offsetof(PickupPickerController, allowRemoteOpInteraction)},
+    {"delusionOptionsSet", offsetof(PickupPickerController, delusionOptionsSet)},
+    {"delusionChoicePickupIndex", offsetof(PickupPickerController, delusionChoicePickupIndex)},
+    {"numberOfPickUpsSelected", offsetof(PickupPickerController, numberOfPickUpsSelected)},
+    {"multiOptionsAvailable", offsetof(PickupPickerController, multiOptionsAvailable)},
+};
+
+static const GameStructField PickupDropletControllerFields[] = {
+    {"createPickupInfo", offsetof(PickupDropletController, createPickupInfo)},
+    {"pickupState", offsetof(PickupDropletController, pickupState)},
+    {"alive", offsetof(PickupDropletController, alive)},
+};
+
+static const GameStructField ChestBehaviorFields[] = {
+    {"dropTable", offsetof(ChestBehavior, dropTable)},
+    {"dropTransform", offsetof(ChestBehavior, dropTransform)},
+    {"openState", offsetof(ChestBehavior, openState)},
+    {"closingState", offsetof(ChestBehavior, closingState)},
+    {"dropRoller", offsetof(ChestBehavior, dropRoller)},
+    {"rng", offsetof(ChestBehavior, rng)},
+    {"ppc", offsetof(ChestBehavior, ppc)},
+    {"<currentPickup>k__BackingField", offsetof(ChestBehavior, currentPickup_backing)},
+    {"dropUpVelocityStrength", offsetof(ChestBehavior, dropUpVelocityStrength)},
+    {"dropForwardVelocityStrength", offsetof(ChestBehavior, dropForwardVelocityStrength)},
+    {"minDropCount", offsetof(ChestBehavior, minDropCount)},
+    {"maxDropCount", offsetof(ChestBehavior, maxDropCount)},
+    {"tier1Chance", offsetof(ChestBehavior, tier1Chance)},
+    {"tier2Chance", offsetof(ChestBehavior, tier2Chance)},
+    {"tier3Chance", offsetof(ChestBehavior, tier3Chance)},
+    {"lunarChance", offsetof(ChestBehavior, lunarChance)},
+    {"requiredItemTag", offsetof(ChestBehavior, requiredItemTag)},
+    {"lunarCoinChance", offsetof(ChestBehavior, lunarCoinChance)},
+    {"dropCount", offsetof(ChestBehavior, dropCount)},
+    {"isCommandChest", offsetof(ChestBehavior, isCommandChest)},
+    {"isChestOpened", offsetof(ChestBehavior, isChestOpened)},
+    {"isChestReset", offsetof(ChestBehavior, isChestReset)},
+};
+
+static const GameStructField PurchaseInteractionFields[] = {
+    {"displayNameToken", offsetof(PurchaseInteraction, displayNameToken)},
+    {"contextToken", offsetof(PurchaseInteraction, contextToken)},
+    {"requiredUnlockable", offsetof(PurchaseInteraction, requiredUnlockable)},
+    {"purchaseStatNames", offsetof(PurchaseInteraction, purchaseStatNames)},
+    {"requiredExpansion", offsetof(PurchaseInteraction, requiredExpansion)},
+    {"cachedInspectInfoProviders", offsetof(PurchaseInteraction, cachedInspectInfoProviders)},
+    {"lastActivator", offsetof(PurchaseInteraction, lastActivator)},
+    {"lockGameObject", offsetof(PurchaseInteraction, lockGameObject)},
+    {"rng", offsetof(PurchaseInteraction, rng)},
+    {"gameObjectUnlockableFilter", offsetof(PurchaseInteraction, gameObjectUnlockableFilter)},
+    {"onPurchase", offsetof(PurchaseInteraction, onPurchase)},
+    {"onDetailedPurchaseServer", offsetof(PurchaseInteraction, onDetailedPurchaseServer)},
+    {"viewerTransform", offsetof(PurchaseInteraction, viewerTransform)},
+    {"viewerBody", offsetof(PurchaseInteraction, viewerBody)},
+    {"costType", offsetof(PurchaseInteraction, costType)},
+    {"available", offsetof(PurchaseInteraction, available)},
+    {"cost", offsetof(PurchaseInteraction, cost)},
+    {"solitudeCost", offsetof(PurchaseInteraction, solitudeCost)},
+    {"automaticallyScaleCostWithDifficulty", offsetof(PurchaseInteraction, automaticallyScaleCostWithDifficulty)},
+    {"ignoreSpherecastForInteractability", offsetof(PurchaseInteraction, ignoreSpherecastForInteractability)},
+    {"setUnavailableOnTeleporterActivated", offsetof(PurchaseInteraction, setUnavailableOnTeleporterActivated)},
+    {"isShrine", offsetof(PurchaseInteraction, isShrine)},
+    {"isGoldShrine", offsetof(PurchaseInteraction, isGoldShrine)},
+    {"isDrone", offsetof(PurchaseInteraction, isDrone)},
+    {"shouldProximityHighlight", offsetof(PurchaseInteraction, shouldProximityHighlight)},
+    {"saleStarCompatible", offsetof(PurchaseInteraction, saleStarCompatible)},
+    {"disableSpawnOnInteraction", offsetof(PurchaseInteraction, disableSpawnOnInteraction)},
+    {"allowRemoteOpInteraction", offsetof(PurchaseInteraction, allowRemoteOpInteraction)},
+    {"currentInspectIndex", offsetof(PurchaseInteraction, currentInspectIndex)},
+    {"___lockGameObjectNetId", offsetof(PurchaseInteraction, ___lockGameObjectNetId)},
+};
+
+static const GameStructField ShopTerminalBehaviorFields[] = {
+    {"pickupDisplay", offsetof(ShopTerminalBehavior, pickupDisplay)},
+    {"dropTransform", offsetof(ShopTerminalBehavior, dropTransform)},
+    {"dropTable", offsetof(ShopTerminalBehavior, dropTable)},
+    {"animator", offsetof(ShopTerminalBehavior, animator)},
+    {"MysteryItemInspectDef", offsetof(ShopTerminalBehavior, MysteryItemInspectDef)},
+    {"inspectHintOverrideToken", offsetof(ShopTerminalBehavior, inspectHintOverrideToken)},
+    {"shopInspectDef", offsetof(ShopTerminalBehavior, shopInspectDef)},
+    {"cachedInspectInfoProviders", offsetof(ShopTerminalBehavior, cachedInspectInfoProviders)},
+    {"rng", offsetof(ShopTerminalBehavior, rng)},
+    {"serverMultiShopController", offsetof(ShopTerminalBehavior, serverMultiShopController)},
+    {"pickup", offsetof(ShopTerminalBehavior, pickup)},
+    {"hidden", offsetof(ShopTerminalBehavior, hidden)},
+    {"hasBeenPurchased", offsetof(ShopTerminalBehavior, hasBeenPurchased)},
+    {"dropVelocity", offsetof(ShopTerminalBehavior, dropVelocity)},
+    {"tempItemDropRangeX", offsetof(ShopTerminalBehavior, tempItemDropRangeX)},
+    {"tempItemDropRangeY", offsetof(ShopTerminalBehavior, tempItemDropRangeY)},
+    {"tempItemDropRangeZ", offsetof(ShopTerminalBehavior, tempItemDropRangeZ)},
+    {"dropAmount", offsetof(ShopTerminalBehavior, dropAmount)},
+    {"debt", offsetof(ShopTerminalBehavior, debt)},
+    {"hintWantsItemFormatting", offsetof(ShopTerminalBehavior, hintWantsItemFormatting)},
+    {"disablesInspectionOnPurchase", offsetof(ShopTerminalBehavior, disablesInspectionOnPurchase)},
+    {"inspectShop", offsetof(ShopTerminalBehavior, inspectShop)},
+    {"ignorePingFormatting", offsetof(ShopTerminalBehavior, ignorePingFormatting)},
+    {"itemTier", offsetof(ShopTerminalBehavior, itemTier)},
+    {"bannedItemTag", offsetof(ShopTerminalBehavior, bannedItemTag)},
+    {"selfGeneratePickup", offsetof(ShopTerminalBehavior, selfGeneratePickup)},
+    {"hasStarted", offsetof(ShopTerminalBehavior, hasStarted)},
+};
+
+static const GameStructField RouletteChestControllerFields[] = {
+    {"bonusTimeDecay", offsetof(RouletteChestController, bonusTimeDecay)},
+    {"dropTable", offsetof(RouletteChestController, dropTable)},
+    {"ejectionTransform", offsetof(RouletteChestController, ejectionTransform)},
+    {"modelAnimator", offsetof(RouletteChestController, modelAnimator)},
+    {"pickupDisplay", offsetof(RouletteChestController, pickupDisplay)},
+    {"stateMachine", offsetof(RouletteChestController, stateMachine)},
+    {"purchaseInteraction", offsetof(RouletteChestController, purchaseInteraction)},
+    {"networkIdentity", offsetof(RouletteChestController, networkIdentity)},
+    {"entries", offsetof(RouletteChestController, entries)},
+    {"rng", offsetof(RouletteChestController, rng)},
+    {"onCycleBeginServer", offsetof(RouletteChestController, onCycleBeginServer)},
+    {"onCycleCompletedServer", offsetof(RouletteChestController, onCycleCompletedServer)},
+    {"onChangedEntryClient", offsetof(RouletteChestController, onChangedEntryClient)},
+    {"maxEntries", offsetof(RouletteChestController, maxEntries)},
+    {"bonusTime", offsetof(RouletteChestController, bonusTime)},
+    {"localEjectionVelocity", offsetof(RouletteChestController, localEjectionVelocity)},
+    {"activationTime", offsetof(RouletteChestController, activationTime)},
+    {"dropCount", offsetof(RouletteChestController, dropCount)},
+    {"previousEntryIndexClient", offsetof(RouletteChestController, previousEntryIndexClient)},
+};
+
+static const GameStructField MultiShopControllerFields[] = {
+    {"terminalPrefab", offsetof(MultiShopController, terminalPrefab)},
+    {"terminalPositions", offsetof(MultiShopController, terminalPositions)},
+    {"animator", offsetof(MultiShopController, animator)},
+    {"DroneVendorDeploy", offsetof(MultiShopController, DroneVendorDeploy)},
+    {"vendorBasePurchaseVFX", offsetof(MultiShopController, vendorBasePurchaseVFX)},
+    {"_interactor", offsetof(MultiShopController, _interactor)},
+    {"_purchaseInteraction", offsetof(MultiShopController, _purchaseInteraction)},
+    {"multishopSOA", offsetof(MultiShopController, multishopSOA)},
+    {"terminalGameObjects", offsetof(MultiShopController, terminalGameObjects)},
+    {"terminalNetIds", offsetof(MultiShopController, terminalNetIds)},
+    {"doCloseOnTerminalPurchase", offsetof(MultiShopController, doCloseOnTerminalPurchase)},
+    {"rng", offsetof(MultiShopController, rng)},
+    {"revealCount", offsetof(MultiShopController, revealCount)},
+    {"hiddenChance", offsetof(MultiShopController, hiddenChance)},
+    {"isTripleDroneVendor", offsetof(MultiShopController, isTripleDroneVendor)},
+    {"PurchaseWaitDuration", offsetof(MultiShopController, PurchaseWaitDuration)},
+    {"_wantsPlayPurchaseAnim", offsetof(MultiShopController, _wantsPlayPurchaseAnim)},
+    {"_hasPurchaseAnimPlayed", offsetof(MultiShopController, _hasPurchaseAnimPlayed)},
+    {"_currentTriggerTime", offsetof(MultiShopController, _currentTriggerTime)},
+    {"hasResolvedTerminals", offsetof(MultiShopController, hasResolvedTerminals)},
+    {"itemTier", offsetof(MultiShopController, itemTier)},
+    {"doEquipmentInstead", offsetof(MultiShopController, doEquipmentInstead)},
+    {"hideDisplayContent", offsetof(MultiShopController, hideDisplayContent)},
+    {"available", offsetof(MultiShopController, available)},
+    {"baseCost", offsetof(MultiShopController, baseCost)},
+    {"costType", offsetof(MultiShopController, costType)},
+    {"cost", offsetof(MultiShopController, cost)},
+};
+
+static const GameStructField DelusionChestControllerFields[] = {
+    {"delusionChest", offsetof(DelusionChestController, delusionChest)},
+    {"_delusionPickupIndexesTable", offsetof(DelusionChestController, _delusionPickupIndexesTable)},
+    {"_netUIPromptController", offsetof(DelusionChestController, _netUIPromptController)},
+    {"_pickupPickerController", offsetof(DelusionChestController, _pickupPickerController)},
+    {"interactor", offsetof(DelusionChestController, interactor)},
+    {"interactorInventory", offsetof(DelusionChestController, interactorInventory)},
+    {"previousInteractor", offsetof(DelusionChestController, previousInteractor)},
+    {"_delusionPickupIndex", offsetof(DelusionChestController, _delusionPickupIndex)},
+    {"_selectedPickupIndex", offsetof(DelusionChestController, _selectedPickupIndex)},
+    {"hasBeenReset", offsetof(DelusionChestController, hasBeenReset)},
+};
+
+static const GameStructField ScrapperControllerFields[] = {
+    {"pickupPickerController", offsetof(ScrapperController, pickupPickerController)},
+    {"esm", offsetof(ScrapperController, esm)},
+    {"<pickupPrintQueue>k__BackingField", offsetof(ScrapperController, pickupPrintQueue_backing)},
+    {"interactor", offsetof(ScrapperController, interactor)},
+    {"maxItemsToScrapAtATime", offsetof(ScrapperController, maxItemsToScrapAtATime)},
+};
+
+static const GameStructField BarrelInteractionFields[] = {
+    {"displayNameToken", offsetof(BarrelInteraction, displayNameToken)},
+    {"contextToken", offsetof(BarrelInteraction, contextToken)},
+    {"salvageOrb", offsetof(BarrelInteraction, salvageOrb)},
+    {"goldReward", offsetof(BarrelInteraction, goldReward)},
+    {"expReward", offsetof(BarrelInteraction, expReward)},
+    {"shouldProximityHighlight", offsetof(BarrelInteraction, shouldProximityHighlight)},
+    {"opened", offsetof(BarrelInteraction, opened)},
+};
+
+static const GameStructField GenericPickupControllerFields[] = {
+    {"pickupDisplay", offsetof(GenericPickupController, pickupDisplay)},
+    {"chestGeneratedFrom", offsetof(GenericPickupController, chestGeneratedFrom)},
+    {"idealPickupIndex", offsetof(GenericPickupController, idealPickupIndex)},
+    {"_pickupState", offsetof(GenericPickupController, _pickupState)},
+    {"Recycled", offsetof(GenericPickupController, Recycled)},
+    {"Duplicated", offsetof(GenericPickupController, Duplicated)},
+    {"selfDestructIfPickupIndexIsNotIdeal", offsetof(GenericPickupController, selfDestructIfPickupIndexIsNotIdeal)},
+    {"waitDuration", offsetof(GenericPickupController, waitDuration)},
+    {"waitStartTime", offsetof(GenericPickupController, waitStartTime)},
+    {"consumed", offsetof(GenericPickupController, consumed)},
+};
+
+static const GameStructField TimedChestControllerFields[] = {
+    {"displayTimer", offsetof(TimedChestController, displayTimer)},
+    {"displayScaleCurve", offsetof(TimedChestController, displayScaleCurve)},
+    {"contextString", offsetof(TimedChestController, contextString)},
+    {"lockTime", offsetof(TimedChestController, lockTime)},
+    {"displayIsAvailableColor", offsetof(TimedChestController, displayIsAvailableColor)},
+    {"displayIsLockedColor", offsetof(TimedChestController, displayIsLockedColor)},
+    {"purchased", offsetof(TimedChestController, purchased)},
+    {"shouldProximityHighlight", offsetof(TimedChestController, shouldProximityHighlight)},
+};
+
+static const GameStructField ShrineCleanseBehaviorFields[] = {
+    {"contextToken", offsetof(ShrineCleanseBehavior, contextToken)},
+    {"activationEffectPrefab", offsetof(ShrineCleanseBehavior, activationEffectPrefab)},
+};
+
+static const GameStructField GenericInteractionFields[] = {
+    {"contextToken", offsetof(GenericInteraction, contextToken)},
+    {"onActivation", offsetof(GenericInteraction, onActivation)},
+    {"interactability", offsetof(GenericInteraction, interactability)},
+    {"shouldIgnoreSpherecastForInteractibility", offsetof(GenericInteraction, shouldIgnoreSpherecastForInteractibility)},
+    {"shouldProximityHighlight", offsetof(GenericInteraction, shouldProximityHighlight)},
+    {"allowRemoteOpInteraction", offsetof(GenericInteraction, allowRemoteOpInteraction)},
+    {"shouldShowOnScanner", offsetof(GenericInteraction, shouldShowOnScanner)},
+};
+
+static const GameStructField PressurePlateControllerFields[] = {
+    {"switchDownSoundString", offsetof(PressurePlateController, switchDownSoundString)},
+    {"switchUpSoundString", offsetof(PressurePlateController, switchUpSoundString)},
+    {"OnSwitchDown", offsetof(PressurePlateController, OnSwitchDown)},
+    {"OnSwitchUp", offsetof(PressurePlateController, OnSwitchUp)},
+    {"pingCollider", offsetof(PressurePlateController, pingCollider)},
+    {"switchVisualPositionFromUpToDown", offsetof(PressurePlateController, switchVisualPositionFromUpToDown)},
+    {"switchVisualPositionFromDownToUp", offsetof(PressurePlateController, switchVisualPositionFromDownToUp)},
+    {"switchVisualTransform", offsetof(PressurePlateController, switchVisualTransform)},
+    {"enableOverlapSphere", offsetof(PressurePlateController, enableOverlapSphere)},
+    {"overlapSphereRadius", offsetof(PressurePlateController, overlapSphereRadius)},
+    {"overlapSphereFrequency", offsetof(PressurePlateController, overlapSphereFrequency)},
+    {"overlapSphereStopwatch", offsetof(PressurePlateController, overlapSphereStopwatch)},
+    {"animationStopwatch", offsetof(PressurePlateController, animationStopwatch)},
+    {"switchDown", offsetof(PressurePlateController, switchDown)},
+};
+
+static const GameStructField HighlightFields[] = {
+    {"displayNameProvider", offsetof(Highlight, displayNameProvider)},
+    {"targetRenderer", offsetof(Highlight, targetRenderer)},
+    {"targetRendererList", offsetof(Highlight, targetRendererList)},
+    {"pickupState", offsetof(Highlight, pickupState)},
+    {"strength", offsetof(Highlight, strength)},
+    {"highlightColor", offsetof(Highlight, highlightColor)},
+    {"CustomColor", offsetof(Highlight, CustomColor)},
+    {"isOn", offsetof(Highlight, isOn)},
+};
+
+static const GameStructField PickupDisplayFields[] = {
+    {"tier1ParticleEffect", offsetof(PickupDisplay, tier1ParticleEffect)},
+    {"tier2ParticleEffect", offsetof(PickupDisplay, tier2ParticleEffect)},
+    {"tier3ParticleEffect", offsetof(PickupDisplay, tier3ParticleEffect)},
+    {"equipmentParticleEffect", offsetof(PickupDisplay, equipmentParticleEffect)},
+    {"lunarParticleEffect", offsetof(PickupDisplay, lunarParticleEffect)},
+    {"bossParticleEffect", offsetof(PickupDisplay, bossParticleEffect)},
+    {"voidParticleEffect", offsetof(PickupDisplay, voidParticleEffect)},
+    {"foodParticleEffect", offsetof(PickupDisplay, foodParticleEffect)},
+    {"coloredParticleSystems", offsetof(PickupDisplay, coloredParticleSystems)},
+    {"temporaryItemIndicator", offsetof(PickupDisplay, temporaryItemIndicator)},
+    {"propertyStorage", offsetof(PickupDisplay, propertyStorage)},
+    {"highlight", offsetof(PickupDisplay, highlight)},
+    {"modelObject", offsetof(PickupDisplay, modelObject)},
+    {"<modelRenderer>k__BackingField", offsetof(PickupDisplay, modelRenderer_backing)},
+    {"<modelRenderers>k__BackingField", offsetof(PickupDisplay, modelRenderers_backing)},
+    {"modelPrefab", offsetof(PickupDisplay, modelPrefab)},
+    {"verticalWave", offsetof(PickupDisplay, verticalWave)},
+    {"dontInstantiatePickupModel", offsetof(PickupDisplay, dontInstantiatePickupModel)},
+    {"spinSpeed", offsetof(PickupDisplay, spinSpeed)},
+    {"pickupState", offsetof(PickupDisplay, pickupState)},
+    {"hidden", offsetof(PickupDisplay, hidden)},
+    {"renderersDisabled", offsetof(PickupDisplay, renderersDisabled)},
+    {"modelScale", offsetof(PickupDisplay, modelScale)},
+    {"localTime", offsetof(PickupDisplay, localTime)},
+    {"shouldUpdate", offsetof(PickupDisplay, shouldUpdate)},
+};
+
+static const GameStructField PickupDefFields[] = {
+    {"internalName", offsetof(PickupDef, internalName)},
+    {"displayPrefab", offsetof(PickupDef, displayPrefab)},
+    {"displayPrefabReference", offsetof(PickupDef, displayPrefabReference)},
+    {"dropletDisplayPrefab", offsetof(PickupDef, dropletDisplayPrefab)},
+    {"nameToken", offsetof(PickupDef, nameToken)},
+    {"unlockableDef", offsetof(PickupDef, unlockableDef)},
+    {"interactContextToken", offsetof(PickupDef, interactContextToken)},
+    {"iconTexture", offsetof(PickupDef, iconTexture)},
+    {"iconSprite", offsetof(PickupDef, iconSprite)},
+    {"attemptGrant", offsetof(PickupDef, attemptGrant)},
+    {"<pickupIndex>k__BackingField", offsetof(PickupDef, pickupIndex_backing)},
+    {"baseColor", offsetof(PickupDef, baseColor)},
+    {"darkColor", offsetof(PickupDef, darkColor)},
+    {"itemIndex", offsetof(PickupDef, itemIndex)},
+    {"equipmentIndex", offsetof(PickupDef, equipmentIndex)},
+    {"artifactIndex", offsetof(PickupDef, artifactIndex)},
+    {"miscPickupIndex", offsetof(PickupDef, miscPickupIndex)},
+    {"droneIndex", offsetof(PickupDef, droneIndex)},
+    {"itemTier", offsetof(PickupDef, itemTier)},
+    {"coinValue", offsetof(PickupDef, coinValue)},
+    {"isLunar", offsetof(PickupDef, isLunar)},
+    {"isBoss", offsetof(PickupDef, isBoss)},
+};
+
+static const GameStructField RunFields[] = {
+    {"networkRuleBookComponent", offsetof(Run, networkRuleBookComponent)},
+    {"nameToken", offsetof(Run, nameToken)},
+    {"rebirthDropTable", offsetof(Run, rebirthDropTable)},
+    {"startingScenes", offsetof(Run, startingScenes)},
+    {"startingSceneGroup", offsetof(Run, startingSceneGroup)},
+    {"EventFlagsToResetOnLoop", offsetof(Run, EventFlagsToResetOnLoop)},
+    {"availableItems", offsetof(Run, availableItems)},
+    {"expansionLockedItems", offsetof(Run, expansionLockedItems)},
+    {"availableEquipment", offsetof(Run, availableEquipment)},
+    {"expansionLockedEquipment", offsetof(Run, expansionLockedEquipment)},
+    {"availableDrones", offsetof(Run, availableDrones)},
+    {"expansionLockedDrones", offsetof(Run, expansionLockedDrones)},
+    {"nextStageScene", offsetof(Run, nextStageScene)},
+    {"blacklistedScenesForFirstScene", offsetof(Run, blacklistedScenesForFirstScene)},
+    {"gameOverPrefab", offsetof(Run, gameOverPrefab)},
+    {"lobbyBackgroundPrefab", offsetof(Run, lobbyBackgroundPrefab)},
+    {"uiPrefab", offsetof(Run, uiPrefab)},
+    {"<uiInstances>k__BackingField", offsetof(Run, uiInstances_backing)},
+    {"runRNG", offsetof(Run, runRNG)},
+    {"loopRngGenerator", offsetof(Run, loopRngGenerator)},
+    {"nextStageRng", offsetof(Run, nextStageRng)},
+    {"stageRngGenerator", offsetof(Run, stageRngGenerator)},
+    {"stageRng", offsetof(Run, stageRng)},
+    {"bossRewardRng", offsetof(Run, bossRewardRng)},
+    {"treasureRng", offsetof(Run, treasureRng)},
+    {"spawnRng", offsetof(Run, spawnRng)},
+    {"randomSurvivorOnRespawnRng", offsetof(Run, randomSurvivorOnRespawnRng)},
+    {"unlockablesUnlockedByAnyUser", offsetof(Run, unlockablesUnlockedByAnyUser)},
+    {"unlockablesUnlockedByAllUsers", offsetof(Run, unlockablesUnlockedByAllUsers)},
+    {"unlockablesAlreadyFullyObtained", offsetof(Run, unlockablesAlreadyFullyObtained)},
+    {"userMasters", offsetof(Run, userMasters)},
+    {"availableTier1DropList", offsetof(Run, availableTier1DropList)},
+    {"availableTier2DropList", offsetof(Run, availableTier2DropList)},
+    {"availableTier3DropList", offsetof(Run, availableTier3DropList)},
+    {"availableEquipmentDropList", offsetof(Run, availableEquipmentDropList)},
+    {"availableLunarEquipmentDropList", offsetof(Run, availableLunarEquipmentDropList)},
+    {"availableLunarItemDropList", offsetof(Run, availableLunarItemDropList)},
+    {"availableLunarCombinedDropList", offsetof(Run, availableLunarCombinedDropList)},
+    {"availableBossDropList", offsetof(Run, availableBossDropList)},
+    {"availableVoidTier1DropList", offsetof(Run, availableVoidTier1DropList)},
+    {"availableVoidTier2DropList", offsetof(Run, availableVoidTier2DropList)},
+    {"availableVoidTier3DropList", offsetof(Run, availableVoidTier3DropList)},
+    {"availableVoidBossDropList", offsetof(Run, availableVoidBossDropList)},
+    {"availableFoodTierDropList", offsetof(Run, availableFoodTierDropList)},
+    {"availablePowerShapeItemsDropList", offsetof(Run, availablePowerShapeItemsDropList)},
+    {"smallChestDropTierSelector", offsetof(Run, smallChestDropTierSelector)},
+    {"mediumChestDropTierSelector", offsetof(Run, mediumChestDropTierSelector)},
+    {"largeChestDropTierSelector", offsetof(Run, largeChestDropTierSelector)},
+    {"availableTier1DroneList", offsetof(Run, availableTier1DroneList)},
+    {"availableTier2DroneList", offsetof(Run, availableTier2DroneList)},
+    {"availableTier3DroneList", offsetof(Run, availableTier3DroneList)},
+    {"availableRemoteOpDroneList", offsetof(Run, availableRemoteOpDroneList)},
+    {"eventFlags", offsetof(Run, eventFlags)},
+    {"gameModeIndex", offsetof(Run, gameModeIndex)},
+    {"userPickable", offsetof(Run, userPickable)},
+    {"inSceneTransition", offsetof(Run, inSceneTransition)},
+    {"_uniqueId", offsetof(Run, _uniqueId)},
+    {"isRemoteOperationAllowed", offsetof(Run, isRemoteOperationAllowed)},
+    {"startTimeUtc", offsetof(Run, startTimeUtc)},
+    {"isRunWeekly", offsetof(Run, isRunWeekly)},
+    {"fixedTime", offsetof(Run, fixedTime)},
+    {"time", offsetof(Run, time)},
+    {"isRunning", offsetof(Run, isRunning)},
+    {"runStopwatch", offsetof(Run, runStopwatch)},
+    {"isRunStopwatchForcePaused", offsetof(Run, isRunStopwatchForcePaused)},
+    {"stageClearCount", offsetof(Run, stageClearCount)},
+    {"prestiegeArtifactMountainValue", offsetof(Run, prestiegeArtifactMountainValue)},
+    {"_loopClearCount", offsetof(Run, _loopClearCount)},
+    {"stageClearCountAtLoopStart", offsetof(Run, stageClearCountAtLoopStart)},
+    {"_seed", offsetof(Run, _seed)},
+    {"difficultyCoefficient", offsetof(Run, difficultyCoefficient)},
+    {"compensatedDifficultyCoefficient", offsetof(Run, compensatedDifficultyCoefficient)},
+    {"oneOverCompensatedDifficultyCoefficientSquared", offsetof(Run, oneOverCompensatedDifficultyCoefficientSquared)},
+    {"selectedDifficultyInternal", offsetof(Run, selectedDifficultyInternal)},
+    {"<ambientLevel>k__BackingField", offsetof(Run, ambientLevel_backing)},
+    {"<ambientLevelFloor>k__BackingField", offsetof(Run, ambientLevelFloor_backing)},
+    {"shopPortalCount", offsetof(Run, shopPortalCount)},
+    {"lowerPricedChestsTimerOn", offsetof(Run, lowerPricedChestsTimerOn)},
+    {"lowerPricedChestsTimer", offsetof(Run, lowerPricedChestsTimer)},
+    {"lowerPricedChestsDuration", offsetof(Run, lowerPricedChestsDuration)},
+    {"shutdown", offsetof(Run, shutdown)},
+    {"allowNewParticipants", offsetof(Run, allowNewParticipants)},
+    {"<preventGameOver>k__BackingField", offsetof(Run, preventGameOver_backing)},
+    {"<isGameOverServer>k__BackingField", offsetof(Run, isGameOverServer_backing)},
+};
+
+static const GameStructField CharacterSpawnCardFields[] = {
+    {"_loadout", offsetof(CharacterSpawnCard, _loadout)},
+    {"inventoryToCopy", offsetof(CharacterSpawnCard, inventoryToCopy)},
+    {"inventoryItemCopyFilter", offsetof(CharacterSpawnCard, inventoryItemCopyFilter)},
+    {"equipmentToGrant", offsetof(CharacterSpawnCard, equipmentToGrant)},
+    {"itemsToGrant", offsetof(CharacterSpawnCard, itemsToGrant)},
+    {"runtimeLoadout", offsetof(CharacterSpawnCard, runtimeLoadout)},
+    {"noElites", offsetof(CharacterSpawnCard, noElites)},
+    {"forbiddenAsBoss", offsetof(CharacterSpawnCard, forbiddenAsBoss)},
+};
+
+static const GameStructField TeamManagerFields[] = {
+    {"teamExperience", offsetof(TeamManager, teamExperience)},
+    {"teamLevels", offsetof(TeamManager, teamLevels)},
+    {"teamCurrentLevelExperience", offsetof(TeamManager, teamCurrentLevelExperience)},
+    {"teamNextLevelExperience", offsetof(TeamManager, teamNextLevelExperience)},
+};
+
+const GameStructLayout gameStructLayouts[GameStructCount] = {
+    {"CameraState_Value", "RoR2", "CameraState", true, CameraState_ValueFields, static_cast<uint32_t>(sizeof(CameraState_ValueFields) / sizeof(GameStructField))},
+    {"CharacterCameraParamsData_Value", "RoR2", "CharacterCameraParamsData", true, CharacterCameraParamsData_ValueFields, static_cast<uint32_t>(sizeof(CharacterCameraParamsData_ValueFields) / sizeof(GameStructField))},
+    {"RtpcSetter_Value", "RoR2.WwiseUtils", "RtpcSetter", true, RtpcSetter_ValueFields, static_cast<uint32_t>(sizeof(RtpcSetter_ValueFields) / sizeof(GameStructField))},
+    {"Ray_Value", "UnityEngine", "Ray", true, Ray_ValueFields, static_cast<uint32_t>(sizeof(Ray_ValueFields) / sizeof(GameStructField))},
+    {"RaycastHit_Value", "UnityEngine", "RaycastHit", true, RaycastHit_ValueFields, static_cast<uint32_t>(sizeof(RaycastHit_ValueFields) / sizeof(GameStructField))},
+    {"NetworkUserId_Value", "RoR2", "NetworkUserId", true, NetworkUserId_ValueFields, static_cast<uint32_t>(sizeof(NetworkUserId_ValueFields) / sizeof(GameStructField))},
+    {"PassiveSkill_Value", "RoR2", "PassiveSkill", true, PassiveSkill_ValueFields, static_cast<uint32_t>(sizeof(PassiveSkill_ValueFields) / sizeof(GameStructField))},
+    {"UniquePickup_Value", "RoR2", "UniquePickup", true, UniquePickup_ValueFields, static_cast<uint32_t>(sizeof(UniquePickup_ValueFields) / sizeof(GameStructField))},
+    {"RangeFloat_Value", "RoR2", "RangeFloat", true, RangeFloat_ValueFields, static_cast<uint32_t>(sizeof(RangeFloat_ValueFields) / sizeof(GameStructField))},
+    {"ItemCollection_Value", "RoR2", "ItemCollection", true, ItemCollection_ValueFields, static_cast<uint32_t>(sizeof(ItemCollection_ValueFields) / sizeof(GameStructField))},
+    {"Wave_Value", "RoR2", "Wave", true, Wave_ValueFields, static_cast<uint32_t>(sizeof(Wave_ValueFields) / sizeof(GameStructField))},
+    {"NetworkGuid_Value", "RoR2.Networking", "NetworkGuid", true, NetworkGuid_ValueFields, static_cast<uint32_t>(sizeof(NetworkGuid_ValueFields) / sizeof(GameStructField))},
+    {"NetworkDateTime_Value", "RoR2.Networking", "NetworkDateTime", true, NetworkDateTime_ValueFields, static_cast<uint32_t>(sizeof(NetworkDateTime_ValueFields) / sizeof(GameStructField))},
+    {"CharacterGravityParameters_Value", "RoR2", "CharacterGravityParameters", true, CharacterGravityParameters_ValueFields, static_cast<uint32_t>(sizeof(CharacterGravityParameters_ValueFields) / sizeof(GameStructField))},
+    {"CharacterFlightParameters_Value", "RoR2", "CharacterFlightParameters", true, CharacterFlightParameters_ValueFields, static_cast<uint32_t>(sizeof(CharacterFlightParameters_ValueFields) / sizeof(GameStructField))},
+    {"HealthComponent", "RoR2", "HealthComponent", false, HealthComponentFields, static_cast<uint32_t>(sizeof(HealthComponentFields) / sizeof(GameStructField))},
+    {"EquipmentState", "RoR2", "EquipmentState", false, EquipmentStateFields, static_cast<uint32_t>(sizeof(EquipmentStateFields) / sizeof(GameStructField))},
+    {"Inventory", "RoR2", "Inventory", false, InventoryFields, static_cast<uint32_t>(sizeof(InventoryFields) / sizeof(GameStructField))},
+    {"TeamComponent", "RoR2", "TeamComponent", false, TeamComponentFields, static_cast<uint32_t>(sizeof(TeamComponentFields) / sizeof(GameStructField))},
+    {"CharacterMotor", "RoR2", "CharacterMotor", false, CharacterMotorFields, static_cast<uint32_t>(sizeof(CharacterMotorFields) / sizeof(GameStructField))},
+    {"ModelLocator", "RoR2", "ModelLocator", false, ModelLocatorFields, static_cast<uint32_t>(sizeof(ModelLocatorFields) / sizeof(GameStructField))},
+    {"CharacterBody", "RoR2", "CharacterBody", false, CharacterBodyFields, static_cast<uint32_t>(sizeof(CharacterBodyFields) / sizeof(GameStructField))},
+    {"NetworkUser", "RoR2", "NetworkUser", false, NetworkUserFields, static_cast<uint32_t>(sizeof(NetworkUserFields) / sizeof(GameStructField))},
+    {"PlayerCharacterMasterController", "RoR2", "PlayerCharacterMasterController", false, PlayerCharacterMasterControllerFields, static_cast<uint32_t>(sizeof(PlayerCharacterMasterControllerFields) / sizeof(GameStructField))},
+    {"CharacterMaster", "RoR2", "CharacterMaster", false, CharacterMasterFields, static_cast<uint32_t>(sizeof(CharacterMasterFields) / sizeof(GameStructField))},
+    {"CameraTargetParams", "RoR2", "CameraTargetParams", false, CameraTargetParamsFields, static_cast<uint32_t>(sizeof(CameraTargetParamsFields) / sizeof(GameStructField))},
+    {"CameraRigController", "RoR2", "CameraRigController", false, CameraRigControllerFields, static_cast<uint32_t>(sizeof(CameraRigControllerFields) / sizeof(GameStructField))},
+    {"PlayerStatsComponent", "RoR2.Stats", "PlayerStatsComponent", false, PlayerStatsComponentFields, static_cast<uint32_t>(sizeof(PlayerStatsComponentFields) / sizeof(GameStructField))},
+    {"LocalUser", "RoR2", "LocalUser", false, LocalUserFields, static_cast<uint32_t>(sizeof(LocalUserFields) / sizeof(GameStructField))},
+    {"RuleBook", "RoR2", "RuleBook", false, RuleBookFields, static_cast<uint32_t>(sizeof(RuleBookFields) / sizeof(GameStructField))},
+    {"ServerManagerBase", "RoR2", "ServerManagerBase`1", false, ServerManagerBaseFields, static_cast<uint32_t>(sizeof(ServerManagerBaseFields) / sizeof(GameStructField))},
+    {"RangeFloat", "RoR2", "RangeFloat", false, RangeFloatFields, static_cast<uint32_t>(sizeof(RangeFloatFields) / sizeof(GameStructField))},
+    {"CombatSquad", "RoR2", "CombatSquad", false, CombatSquadFields, static_cast<uint32_t>(sizeof(CombatSquadFields) / sizeof(GameStructField))},
+    {"SpawnCard", "RoR2", "SpawnCard", false, SpawnCardFields, static_cast<uint32_t>(sizeof(SpawnCardFields) / sizeof(GameStructField))},
+    {"RuleCategoryDef", "RoR2", "RuleCategoryDef", false, RuleCategoryDefFields, static_cast<uint32_t>(sizeof(RuleCategoryDefFields) / sizeof(GameStructField))},
+    {"RuleDef", "RoR2", "RuleDef", false, RuleDefFields, static_cast<uint32_t>(sizeof(RuleDefFields) / sizeof(GameStructField))},
+    {"EntitlementDef", "RoR2.EntitlementManagement", "EntitlementDef", false, EntitlementDefFields, static_cast<uint32_t>(sizeof(EntitlementDefFields) / sizeof(GameStructField))},
+    {"RuleChoiceDef", "RoR2", "RuleChoiceDef", false, RuleChoiceDefFields, static_cast<uint32_t>(sizeof(RuleChoiceDefFields) / sizeof(GameStructField))},
+    {"ExpansionDef", "RoR2.ExpansionManagement", "ExpansionDef", false, ExpansionDefFields, static_cast<uint32_t>(sizeof(ExpansionDefFields) / sizeof(GameStructField))},
+    {"ExpansionRequirementComponent", "RoR2.ExpansionManagement", "ExpansionRequirementComponent", false, ExpansionRequirementComponentFields, static_cast<uint32_t>(sizeof(ExpansionRequirementComponentFields) / sizeof(GameStructField))},
+    {"UnlockableDef", "RoR2", "UnlockableDef", false, UnlockableDefFields, static_cast<uint32_t>(sizeof(UnlockableDefFields) / sizeof(GameStructField))},
+    {"DirectorCard", "RoR2", "DirectorCard", false, DirectorCardFields, static_cast<uint32_t>(sizeof(DirectorCardFields) / sizeof(GameStructField))},
+    {"DirectorCardCategorySelection", "RoR2", "DirectorCardCategorySelection", false, DirectorCardCategorySelectionFields, static_cast<uint32_t>(sizeof(DirectorCardCategorySelectionFields) / sizeof(GameStructField))},
+    {"EliteDef", "RoR2", "EliteDef", false, EliteDefFields, static_cast<uint32_t>(sizeof(EliteDefFields) / sizeof(GameStructField))},
+    {"CombatDirector", "RoR2", "CombatDirector", false, CombatDirectorFields, static_cast<uint32_t>(sizeof(CombatDirectorFields) / sizeof(GameStructField))},
+    {"EntityState", "EntityStates", "EntityState", false, EntityStateFields, static_cast<uint32_t>(sizeof(EntityStateFields) / sizeof(GameStructField))},
+    {"NetworkStateMachine", "RoR2", "NetworkStateMachine", false, NetworkStateMachineFields, static_cast<uint32_t>(sizeof(NetworkStateMachineFields) / sizeof(GameStructField))},
+    {"EntityStateMachine", "RoR2", "EntityStateMachine", false, EntityStateMachineFields, static_cast<uint32_t>(sizeof(EntityStateMachineFields) / sizeof(GameStructField))},
+    {"OutsideInteractableLocker", "RoR2", "OutsideInteractableLocker", false, OutsideInteractableLockerFields, static_cast<uint32_t>(sizeof(OutsideInteractableLockerFields) / sizeof(GameStructField))},
+    {"PickupDropTable", "RoR2", "PickupDropTable", false, PickupDropTableFields, static_cast<uint32_t>(sizeof(PickupDropTableFields) / sizeof(GameStructField))},
+    {"BossGroup", "RoR2", "BossGroup", false, BossGroupFields, static_cast<uint32_t>(sizeof(BossGroupFields) / sizeof(GameStructField))},
+    {"NetworkSoundEventDef", "RoR2", "NetworkSoundEventDef", false, NetworkSoundEventDefFields, static_cast<uint32_t>(sizeof(NetworkSoundEventDefFields) / sizeof(GameStructField))},
+    {"BuffDef", "RoR2", "BuffDef", false, BuffDefFields, static_cast<uint32_t>(sizeof(BuffDefFields) / sizeof(GameStructField))},
+    {"TeamFilter", "RoR2", "TeamFilter", false, TeamFilterFields, static_cast<uint32_t>(sizeof(TeamFilterFields) / sizeof(GameStructField))},
+    {"BuffWard", "RoR2", "BuffWard", false, BuffWardFields, static_cast<uint32_t>(sizeof(BuffWardFields) / sizeof(GameStructField))},
+    {"HoldoutZoneController", "RoR2", "HoldoutZoneController", false, HoldoutZoneControllerFields, static_cast<uint32_t>(sizeof(HoldoutZoneControllerFields) / sizeof(GameStructField))},
+    {"SceneDef", "RoR2", "SceneDef", false, SceneDefFields, static_cast<uint32_t>(sizeof(SceneDefFields) / sizeof(GameStructField))},
+    {"ConvertPlayerMoneyToExperience", "RoR2", "ConvertPlayerMoneyToExperience", false, ConvertPlayerMoneyToExperienceFields, static_cast<uint32_t>(sizeof(ConvertPlayerMoneyToExperienceFields) / sizeof(GameStructField))},
+    {"SceneExitController", "RoR2", "SceneExitController", false, SceneExitControllerFields, static_cast<uint32_t>(sizeof(SceneExitControllerFields) / sizeof(GameStructField))},
+    {"PositionIndicator", "RoR2", "PositionIndicator", false, PositionIndicatorFields, static_cast<uint32_t>(sizeof(PositionIndicatorFields) / sizeof(GameStructField))},
+    {"ChargeIndicatorController", "RoR2.UI", "ChargeIndicatorController", false, ChargeIndicatorControllerFields, static_cast<uint32_t>(sizeof(ChargeIndicatorControllerFields) / sizeof(GameStructField))},
+    {"InteractableSpawnCard", "RoR2", "InteractableSpawnCard", false, InteractableSpawnCardFields, static_cast<uint32_t>(sizeof(InteractableSpawnCardFields) / sizeof(GameStructField))},
+    {"PortalSpawner", "RoR2", "PortalSpawner", false, PortalSpawnerFields, static_cast<uint32_t>(sizeof(PortalSpawnerFields) / sizeof(GameStructField))},
+    {"TeleporterInteraction", "RoR2", "TeleporterInteraction", false, TeleporterInteractionFields, static_cast<uint32_t>(sizeof(TeleporterInteractionFields) / sizeof(GameStructField))},
+    {"BodyAnimatorSmoothingParameters", "RoR2", "BodyAnimatorSmoothingParameters", false, BodyAnimatorSmoothingParametersFields, static_cast<uint32_t>(sizeof(BodyAnimatorSmoothingParametersFields) / sizeof(GameStructField))},
+    {"RigidbodyMotor", "RoR2", "RigidbodyMotor", false, RigidbodyMotorFields, static_cast<uint32_t>(sizeof(RigidbodyMotorFields) / sizeof(GameStructField))},
+    {"HurtBoxGroup", "RoR2", "HurtBoxGroup", false, HurtBoxGroupFields, static_cast<uint32_t>(sizeof(HurtBoxGroupFields) / sizeof(GameStructField))},
+    {"CharacterModel", "RoR2", "CharacterModel", false, CharacterModelFields, static_cast<uint32_t>(sizeof(CharacterModelFields) / sizeof(GameStructField))},
+    {"RigidbodyDirection", "RoR2", "RigidbodyDirection", false, RigidbodyDirectionFields, static_cast<uint32_t>(sizeof(RigidbodyDirectionFields) / sizeof(GameStructField))},
+    {"RailMotor", "RoR2", "RailMotor", false, RailMotorFields, static_cast<uint32_t>(sizeof(RailMotorFields) / sizeof(GameStructField))},
+    {"CharacterEmoteDefinitions", "RoR2", "CharacterEmoteDefinitions", false, CharacterEmoteDefinitionsFields, static_cast<uint32_t>(sizeof(CharacterEmoteDefinitionsFields) / sizeof(GameStructField))},
+    {"LoopSoundDef", "RoR2.Audio", "LoopSoundDef", false, LoopSoundDefFields, static_cast<uint32_t>(sizeof(LoopSoundDefFields) / sizeof(GameStructField))},
+    {"ProjectileGhostController", "RoR2.Projectile", "ProjectileGhostController", false, ProjectileGhostControllerFields, static_cast<uint32_t>(sizeof(ProjectileGhostControllerFields) / sizeof(GameStructField))},
+    {"ProjectileController", "RoR2.Projectile", "ProjectileController", false, ProjectileControllerFields, static_cast<uint32_t>(sizeof(ProjectileControllerFields) / sizeof(GameStructField))},
+    {"ItemTierDef", "RoR2", "ItemTierDef", false, ItemTierDefFields, static_cast<uint32_t>(sizeof(ItemTierDefFields) / sizeof(GameStructField))},
+    {"ItemTag", "RoR2", "ItemTag", false, ItemTagFields, static_cast<uint32_t>(sizeof(ItemTagFields) / sizeof(GameStructField))},
+    {"ItemDef", "RoR2", "ItemDef", false, ItemDefFields, static_cast<uint32_t>(sizeof(ItemDefFields) / sizeof(GameStructField))},
+    {"SkillLocator", "RoR2", "SkillLocator", false, SkillLocatorFields, static_cast<uint32_t>(sizeof(SkillLocatorFields) / sizeof(GameStructField))},
+    {"GenericSkill", "RoR2", "GenericSkill", false, GenericSkillFields, static_cast<uint32_t>(sizeof(GenericSkillFields) / sizeof(GameStructField))},
+    {"SkillDef", "RoR2.Skills", "SkillDef", false, SkillDefFields, static_cast<uint32_t>(sizeof(SkillDefFields) / sizeof(GameStructField))},
+    {"BullseyeSearch", "RoR2", "BullseyeSearch", false, BullseyeSearchFields, static_cast<uint32_t>(sizeof(BullseyeSearchFields) / sizeof(GameStructField))},
+    {"HuntressTracker", "RoR2", "HuntressTracker", false, HuntressTrackerFields, static_cast<uint32_t>(sizeof(HuntressTrackerFields) / sizeof(GameStructField))},
+    {"SkillFamily", "RoR2.Skills", "SkillFamily", false, SkillFamilyFields, static_cast<uint32_t>(sizeof(SkillFamilyFields) / sizeof(GameStructField))},
+    {"PickupPickerController", "RoR2", "PickupPickerController", false, PickupPickerControllerFields, static_cast<uint32_t>(sizeof(PickupPickerControllerFields) / sizeof(GameStructField))},
+    {"PickupDropletController", "RoR2", "PickupDropletController", false, PickupDropletControllerFields, static_cast<uint32_t>(sizeof(PickupDropletControllerFields) / sizeof(GameStructField))},
+    {"ChestBehavior", "RoR2", "ChestBehavior", false, ChestBehaviorFields, static_cast<uint32_t>(sizeof(ChestBehaviorFields) / sizeof(GameStructField))},
+    {"PurchaseInteraction", "RoR2", "PurchaseInteraction", false, PurchaseInteractionFields, static_cast<uint32_t>(sizeof(PurchaseInteractionFields) / sizeof(GameStructField))},
+    {"ShopTerminalBehavior", "RoR2", "ShopTerminalBehavior", false, ShopTerminalBehaviorFields, static_cast<uint32_t>(sizeof(ShopTerminalBehaviorFields) / sizeof(GameStructField))},
+    {"RouletteChestController", "RoR2", "RouletteChestController", false, RouletteChestControllerFields, static_cast<uint32_t>(sizeof(RouletteChestControllerFields) / sizeof(GameStructField))},
+    {"MultiShopController", "RoR2", "MultiShopController", false, MultiShopControllerFields, static_cast<uint32_t>(sizeof(MultiShopControllerFields) / sizeof(GameStructField))},
+    {"DelusionChestController", "RoR2", "DelusionChestController", false, DelusionChestControllerFields, static_cast<uint32_t>(sizeof(DelusionChestControllerFields) / sizeof(GameStructField))},
+    {"ScrapperController", "RoR2", "ScrapperController", false, ScrapperControllerFields, static_cast<uint32_t>(sizeof(ScrapperControllerFields) / sizeof(GameStructField))},
+    {"BarrelInteraction", "RoR2", "BarrelInteraction", false, BarrelInteractionFields, static_cast<uint32_t>(sizeof(BarrelInteractionFields) / sizeof(GameStructField))},
+    {"GenericPickupController", "RoR2", "GenericPickupController", false, GenericPickupControllerFields, static_cast<uint32_t>(sizeof(GenericPickupControllerFields) / sizeof(GameStructField))},
+    {"TimedChestController", "RoR2", "TimedChestController", false, TimedChestControllerFields, static_cast<uint32_t>(sizeof(TimedChestControllerFields) / sizeof(GameStructField))},
+    {"ShrineCleanseBehavior", "RoR2", "ShrineCleanseBehavior", false, ShrineCleanseBehaviorFields, static_cast<uint32_t>(sizeof(ShrineCleanseBehaviorFields) / sizeof(GameStructField))},
+    {"GenericInteraction", "RoR2", "GenericInteraction", false, GenericInteractionFields, static_cast<uint32_t>(sizeof(GenericInteractionFields) / sizeof(GameStructField))},
+    {"PressurePlateController", "RoR2", "PressurePlateController", false, PressurePlateControllerFields, static_cast<uint32_t>(sizeof(PressurePlateControllerFields) / sizeof(GameStructField))},
+    {"Highlight", "RoR2", "Highlight", false, HighlightFields, static_cast<uint32_t>(sizeof(HighlightFields) / sizeof(GameStructField))},
+    {"PickupDisplay", "RoR2", "PickupDisplay", false, PickupDisplayFields, static_cast<uint32_t>(sizeof(PickupDisplayFields) / sizeof(GameStructField))},
+    {"PickupDef", "RoR2", "PickupDef", false, PickupDefFields, static_cast<uint32_t>(sizeof(PickupDefFields) / sizeof(GameStructField))},
+    {"Run", "RoR2", "Run", false, RunFields, static_cast<uint32_t>(sizeof(RunFields) / sizeof(GameStructField))},
+    {"CharacterSpawnCard", "RoR2", "CharacterSpawnCard", false, CharacterSpawnCardFields, static_cast<uint32_t>(sizeof(CharacterSpawnCardFields) / sizeof(GameStructField))},
+    {"TeamManager", "RoR2", "TeamManager", false, TeamManagerFields, static_cast<uint32_t>(sizeof(TeamManagerFields) / sizeof(GameStructField))},
+};
@@ -0,0 +1,132 @@
+// Generated by scripts/generate_struct_layouts.py from GameStructs.hpp, do not edit
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Every struct in GameStructs.hpp generated from a named managed type
+enum class GameStructId : uint16_t {
+    CameraState_Value,
+    CharacterCameraParamsData_Value,
+    RtpcSetter_Value,
+    Ray_Value,
+    RaycastHit_Value,
+    NetworkUserId_Value,
+    PassiveSkill_Value,
+    UniquePickup_Value,
+    RangeFloat_Value,
+    ItemCollection_Value,
+    Wave_Value,
+    NetworkGuid_Value,
+    NetworkDateTime_Value,
+    CharacterGravityParameters_Value,
+    CharacterFlightParameters_Value,
+    HealthComponent,
+    EquipmentState,
+    Inventory,
+    TeamComponent,
+    CharacterMotor,
+    ModelLocator,
+    CharacterBody,
+    NetworkUser,
+    PlayerCharacterMasterController,
+    CharacterMaster,
+    CameraTargetParams,
+    CameraRigController,
+    PlayerStatsComponent,
+    LocalUser,
+    RuleBook,
+    ServerManagerBase,
+    RangeFloat,
+    CombatSquad,
+    SpawnCard,
+    RuleCategoryDef,
+    RuleDef,
+    EntitlementDef,
+    RuleChoiceDef,
+    ExpansionDef,
+    ExpansionRequirementComponent,
+    UnlockableDef,
+    DirectorCard,
+    DirectorCardCategorySelection,
+    EliteDef,
+    CombatDirector,
+    EntityState,
+    NetworkStateMachine,
+    EntityStateMachine,
+    OutsideInteractableLocker,
+    PickupDropTable,
+    BossGroup,
+    NetworkSoundEventDef,
+    BuffDef,
+    TeamFilter,
+    BuffWard,
+    HoldoutZoneController,
+    SceneDef,
+    ConvertPlayerMoneyToExperience,
+    SceneExitController,
+    PositionIndicator,
+    ChargeIndicatorController,
+    InteractableSpawnCard,
+    PortalSpawner,
+    TeleporterInteraction,
+    BodyAnimatorSmoothingParameters,
+    RigidbodyMotor,
+    HurtBoxGroup,
+    CharacterModel,
+    RigidbodyDirection,
+    RailMotor,
+    CharacterEmoteDefinitions,
+    LoopSoundDef,
+    ProjectileGhostController,
+    ProjectileController,
+    ItemTierDef,
+    ItemTag,
+    ItemDef,
+    SkillLocator,
+    GenericSkill,
+    SkillDef,
+    BullseyeSearch,
+    HuntressTracker,
+    SkillFamily,
+    PickupPickerController,
+    PickupDropletController,
+    ChestBehavior,
+    PurchaseInteraction,
+    ShopTerminalBehavior,
+    RouletteChestController,
+    MultiShopController,
+    DelusionChestController,
+    ScrapperController,
+    BarrelInteraction,
+    GenericPickupController,
+    TimedChestController,
+    ShrineCleanseBehavior,
+    GenericInteraction,
+    PressurePlateController,
+    Highlight,
+    PickupDisplay,
+    PickupDef,
+    Run,
+    CharacterSpawnCard,
+    TeamManager,
+    Count
+};
+
+constexpr size_t GameStructCount = static_cast<size_t>(GameStructId::Count);
+
+struct GameStructField {
+    const char* name; // Managed field name
+    uint32_t offset;  // offsetof in the C++ struct
+};
+
+struct GameStructLayout {
+    const char* structName;
+    const char* nameSpace;
+    const char* className;
+    bool isValueType; // C++ offsets are unboxed, the managed ones include the object header
+    const GameStructField* fields;
+    uint32_t fieldCount;
+};
+
+// Indexed by GameStructId
+extern const GameStructLayout gameStructLayouts[GameStructCount];
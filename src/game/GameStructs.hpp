@@ -1,5 +1,6 @@
 #pragma once
 #include "utils/Math.hpp"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -186,6 +187,29 @@ struct MonoArray_Internal {
 template <typename T> static T* mono_array_addr(MonoArray_Internal* arr) {
     return reinterpret_cast<T*>(reinterpret_cast<uint8_t*>(arr) + offsetof(MonoArray_Internal, vector_arr));
 }
+
+// Bounds-checked read-only view over a managed single-dimension array, reading its length and elements in place
+// instead of calling System.Array.Get per element. T is the element as stored: a pointer for reference element types,
+// the value itself for enums and structs. Only valid while the array is reachable, e.g. for the duration of one catalog walk.
+template <typename T> class MonoArrayView {
+  private:
+    MonoArray_Internal* m_array = nullptr;
+
+  public:
+    MonoArrayView() = default;
+    explicit MonoArrayView(const void* array) : m_array(static_cast<MonoArray_Internal*>(const_cast<void*>(array))) {}
+
+    bool IsValid() const { return m_array != nullptr; }
+    size_t Size() const { return m_array ? static_cast<size_t>(m_array->max_length) : 0; }
+    bool InBounds(int64_t index) const { return index >= 0 && static_cast<uint64_t>(index) < Size(); }
+
+    const T* Data() const { return m_array ? mono_array_addr<T>(m_array) : nullptr; }
+    const T* begin() const { return Data(); }
+    const T* end() const { return Data() + Size(); }
+
+    // Element at index, or a value-initialized T (nullptr for references) when index is out of bounds
+    T Get(int64_t index) const { return InBounds(index) ? Data()[index] : T(); }
+};
 /*
     uint32_t len = static_cast<uint32_t>((reinterpret_cast<MonoArray_Internal*>(itemDefsArray))->max_length);
     ItemDef** data = mono_array_addr<ItemDef*>(reinterpret_cast<MonoArray_Internal*>(itemDefsArray));
@@ -0,0 +1,70 @@
+#include "StructLayoutValidator.hpp"
+#include "utils/Logger.hpp"
+
+// Assemblies the generated structs come from, searched in order
+static const char* layoutAssemblies[] = {"Assembly-CSharp", "RoR2", "UnityEngine.CoreModule", "UnityEngine.PhysicsModule"};
+
+// Managed offsets of value type fields count the boxed object header, the C++ _Value structs don't
+static constexpr int32_t boxedHeaderSize = 2 * sizeof(void*);
+
+MonoClass* StructLayoutValidator::FindClass(MonoRuntime* runtime, const GameStructLayout& layout) {
+    for (const char* assemblyName : layoutAssemblies) {
+        if (!runtime->GetImage(assemblyName))
+            continue;
+        if (MonoClass* klass = runtime->GetClass(assemblyName, layout.nameSpace, layout.className))
+            return klass;
+    }
+    return nullptr;
+}
+
+bool StructLayoutValidator::ValidateLayout(MonoRuntime* runtime, MonoClass* klass, const GameStructLayout& layout) {
+    bool matches = true;
+    for (uint32_t i = 0; i < layout.fieldCount; i++) {
+        const GameStructField& field = layout.fields[i];
+        MonoField* monoField = runtime->GetField(klass, field.name);
+        if (!monoField) {
+            LOG_ERROR("%s.%s no longer exists in %s.%s", layout.structName, field.name, layout.nameSpace, layout.className);
+            matches = false;
+            continue;
+        }
+
+        MonoFieldLayout fieldLayout{};
+        runtime->GetFieldLayout(klass, monoField, false, fieldLayout);
+        int32_t declaredOffset = static_cast<int32_t>(field.offset) + (layout.isValueType ? boxedHeaderSize : 0);
+        if (fieldLayout.offset != declaredOffset) {
+            LOG_ERROR("%s.%s is at offset %d in the game but %d in GameStructs.hpp", layout.structName, field.name, fieldLayout.offset, declaredOffset);
+            matches = false;
+        }
+    }
+    return matches;
+}
+
+size_t StructLayoutValidator::Validate(MonoRuntime* runtime) {
+    size_t mismatched = 0;
+    size_t missing = 0;
+    for (size_t i = 0; i < GameStructCount; i++) {
+        const GameStructLayout& layout = gameStructLayouts[i];
+        MonoClass* klass = FindClass(runtime, layout);
+        if (!klass) {
+            LOG_WARNING("Can't find %s.%s to check %s, trusting its layout", layout.nameSpace, layout.className, layout.structName);
+            m_mismatched[i].store(false, std::memory_order_release);
+            missing++;
+            continue;
+        }
+
+        bool matches = ValidateLayout(runtime, klass, layout);
+        m_mismatched[i].store(!matches, std::memory_order_release);
+        mismatched += matches ? 0 : 1;
+    }
+
+    LOG_INFO("Checked %zu struct layouts: %zu mismatched, %zu not found", GameStructCount, mismatched, missing);
+    return mismatched;
+}
+
+bool StructLayoutValidator::AllMatch(const std::vector<GameStructId>& ids) const {
+    for (GameStructId id : ids) {
+        if (!Matches(id))
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include "core/MonoRuntime.hpp"
+#include "game/GameStructLayouts.hpp"
+#include <array>
+#include <atomic>
+#include <vector>
+
+// Checks the field offsets GameStructs.hpp was generated with against the classes the game actually loaded. Code that
+// dereferences those structs asks Matches first and stays off, or reads through Mono, when a game update moved a field.
+// Everything matches until Validate has run. Validate runs on a startup worker while hooks and the render thread may already
+// ask Matches, so every flag is its own atomic.
+class StructLayoutValidator {
+  private:
+    std::array<std::atomic<bool>, GameStructCount> m_mismatched{};
+
+    MonoClass* FindClass(MonoRuntime* runtime, const GameStructLayout& layout);
+    bool ValidateLayout(MonoRuntime* runtime, MonoClass* klass, const GameStructLayout& layout);
+
+  public:
+    // Returns the number of mismatched structs. Types that can't be found are logged and trusted.
+    size_t Validate(MonoRuntime* runtime);
+    bool Matches(GameStructId id) const { return !m_mismatched[static_cast<size_t>(id)].load(std::memory_order_acquire); }
+    bool AllMatch(const std::vector<GameStructId>& ids) const;
+};
@@ -16,6 +16,7 @@ WNDPROC oWndProc = nullptr;
 HWND windowHwnd = nullptr;
 Logger logger;
 std::unique_ptr<GameFunctions> gameFunctions = nullptr;
+std::unique_ptr<StructLayoutValidator> structLayouts = std::make_unique<StructLayoutValidator>();
 
 int worldLayer = -1;
 int playerBodyLayer = -1;
@@ -11,6 +11,7 @@
 #include "core/MonoRuntime.hpp"
 #include "game/GameFunctions.hpp"
 #include "game/GameStructs.hpp"
+#include "game/StructLayoutValidator.hpp"
 #include "helper/CSharpHelper.hpp"
 #include "menu/InputControls.hpp"
 #include "modules/ESPModule.hpp"
@@ -40,6 +41,7 @@ extern WNDPROC oWndProc;
 extern HWND windowHwnd;
 extern Logger logger;
 extern std::unique_ptr<GameFunctions> gameFunctions;
+extern std::unique_ptr<StructLayoutValidator> structLayouts;
 
 extern int worldLayer;
 extern int playerBodyLayer;
@@ -0,0 +1,69 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+// Every managed method the mod detours, expanded by the caller's HOOK and HOOK_NESTED macros.
+// HOOK(assembly, ns, class, method, paramcount, returntype, {paramtypes...}) detours into Hooks::hk<ns><class><method>,
+// HOOK_NESTED takes the parent and nested class separately and resolves "Parent+Nested".
+// The overload is picked by exact return and parameter type names, so a game update that changes a signature fails loudly.
+#define HOOK_TABLE(HOOK, HOOK_NESTED)                                                                                                                          \
+    HOOK(RoR2, RoR2, RoR2Application, Update, 0, "System.Void", {})                                                                                            \
+    HOOK(Rewired_Core, Rewired, Player, GetButtonDown, 1, "System.Boolean", {"System.Int32"})                                                                  \
+    HOOK(RoR2, RoR2, RoR2Application, UpdateCursorState, 0, "System.Void", {})                                                                                 \
+    HOOK(RoR2, RoR2, MPEventSystemManager, Update, 0, "System.Void", {})                                                                                       \
+    HOOK(UnityEngine.CoreModule, UnityEngine, Cursor, set_lockState, 1, "System.Void", {"UnityEngine.CursorLockMode"})                                         \
+    HOOK(UnityEngine.CoreModule, UnityEngine, Cursor, set_visible, 1, "System.Void", {"System.Boolean"})                                                       \
+    HOOK(RoR2, RoR2, LocalUser, RebuildControlChain, 0, "System.Void", {})                                                                                     \
+    HOOK(RoR2, RoR2, Inventory, HandleInventoryChanged, 0, "System.Void", {})                                                                                  \
+    HOOK(RoR2, RoR2, Inventory, RemoveItem, 2, "System.Void", {"RoR2.ItemIndex", "System.Int32"})                                                              \
+    HOOK_NESTED(RoR2, RoR2, ItemStealController, StolenInventoryInfo, StealItem, 3, "System.Int32",                                                            \
+                {"RoR2.ItemIndex", "System.Int32", "System.Nullable<System.Boolean>"})                                                                         \
+    HOOK(RoR2, RoR2, SteamworksServerManager, TagsStringUpdated, 0, "System.Void", {})                                                                         \
+    HOOK(RoR2, RoR2, TeleporterInteraction, Awake, 0, "System.Void", {})                                                                                       \
+    HOOK(RoR2, RoR2, TeleporterInteraction, FixedUpdate, 0, "System.Void", {})                                                                                 \
+    HOOK(RoR2, RoR2, TeleporterInteraction, OnDestroy, 0, "System.Void", {})                                                                                   \
+    HOOK(RoR2, RoR2, ConvertPlayerMoneyToExperience, FixedUpdate, 0, "System.Void", {})                                                                        \
+    HOOK(RoR2, RoR2, CharacterBody, Start, 0, "System.Void", {})                                                                                               \
+    HOOK(RoR2, RoR2, CharacterBody, OnDestroy, 0, "System.Void", {})                                                                                           \
+    HOOK(RoR2, RoR2, CharacterMotor, AddDisplacement, 1, "System.Void", {"UnityEngine.Vector3"})                                                               \
+    HOOK(RoR2, RoR2, CharacterMotor, ApplyForce, 3, "System.Void", {"UnityEngine.Vector3", "System.Boolean", "System.Boolean"})                                \
+    HOOK(RoR2, RoR2, HuntressTracker, Start, 0, "System.Void", {})                                                                                             \
+    HOOK(RoR2, RoR2, BullseyeSearch, GetResults, 0, "System.Collections.Generic.IEnumerable<RoR2.HurtBox>", {})                                                \
+    HOOK(RoR2, RoR2, BullseyeSearch, RefreshCandidates, 0, "System.Void", {})                                                                                  \
+    HOOK(RoR2, RoR2, PurchaseInteraction, Start, 0, "System.Void", {})                                                                                         \
+    HOOK(RoR2, RoR2, BarrelInteraction, Start, 0, "System.Void", {})                                                                                           \
+    HOOK(RoR2, RoR2, GenericPickupController, Start, 0, "System.Void", {})                                                                                     \
+    HOOK(RoR2, RoR2, GenericPickupController, OnDisable, 0, "System.Void", {})                                                                                 \
+    HOOK(RoR2, RoR2, TimedChestController, OnEnable, 0, "System.Void", {})                                                                                     \
+    HOOK(RoR2, RoR2, TimedChestController, OnDisable, 0, "System.Void", {})                                                                                    \
+    HOOK(RoR2, RoR2, TeamManager, OnEnable, 0, "System.Void", {})                                                                                              \
+    HOOK(RoR2, RoR2, TeamManager, OnDisable, 0, "System.Void", {})                                                                                             \
+    HOOK(RoR2, RoR2, GenericInteraction, OnEnable, 0, "System.Void", {})                                                                                       \
+    HOOK(RoR2, RoR2, PickupPickerController, Awake, 0, "System.Void", {})                                                                                      \
+    HOOK(RoR2, RoR2, PickupPickerController, OnDisable, 0, "System.Void", {})                                                                                  \
+    HOOK(RoR2, RoR2, Run, AdvanceStage, 1, "System.Void", {"RoR2.SceneDef"})                                                                                   \
+    HOOK(RoR2, RoR2, Run, Awake, 0, "System.Void", {})                                                                                                         \
+    HOOK(RoR2, RoR2, Run, OnDisable, 0, "System.Void", {})                                                                                                     \
+    HOOK(RoR2, RoR2, Stage, OnDisable, 0, "System.Void", {})                                                                                                   \
+    HOOK(RoR2, RoR2, ChestBehavior, Start, 0, "System.Void", {})                                                                                               \
+    HOOK(RoR2, RoR2, ShopTerminalBehavior, Start, 0, "System.Void", {})                                                                                        \
+    HOOK(RoR2, RoR2, PressurePlateController, Start, 0, "System.Void", {})                                                                                     \
+    HOOK(RoR2, RoR2, HoldoutZoneController, Update, 0, "System.Void", {})                                                                                      \
+    HOOK(RoR2, RoR2, TimedChestController, GetInteractability, 1, "RoR2.Interactability", {"RoR2.Interactor"})                                                 \
+    HOOK(RoR2, RoR2, PurchaseInteraction, GetInteractability, 1, "RoR2.Interactability", {"RoR2.Interactor"})                                                  \
+    HOOK(RoR2, RoR2, PortalSpawner, Start, 0, "System.Void", {})                                                                                               \
+    HOOK(RoR2, RoR2, CharacterMaster, GetDeployableSameSlotLimit, 1, "System.Int32", {"RoR2.DeployableSlot"})                                                  \
+    HOOK(RoR2, RoR2, CharacterMaster, SpawnBody, 2, "RoR2.CharacterBody", {"UnityEngine.Vector3", "UnityEngine.Quaternion"})                                   \
+    HOOK(RoR2, RoR2, Language, SetCurrentLanguage, 1, "System.Void", {"System.String"})
+
+#define HOOK_ID(assembly, ns, class, method, ...) ns##class##method,
+#define HOOK_NESTED_ID(assembly, ns, parentclass, nestedclass, method, ...) ns##parentclass##nestedclass##method,
+
+// Dense index of every hook in HOOK_TABLE, used to look up originals without any string keys
+enum class HookId : uint16_t { HOOK_TABLE(HOOK_ID, HOOK_NESTED_ID) Count };
+
+#undef HOOK_ID
+#undef HOOK_NESTED_ID
+
+constexpr size_t HookCount = static_cast<size_t>(HookId::Count);
+constexpr size_t MaxHookParams = 4; // Longest paramtypes list in HOOK_TABLE
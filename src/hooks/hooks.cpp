@@ -1,4 +1,5 @@
 #include "hooks.hpp"
+#include "HookTable.hpp"
 #include "config/ConfigManager.hpp"
 #include "core/MonoList.hpp"
 #include "fonts/FontManager.hpp"
@@ -12,80 +13,148 @@
 #include "menu/menu.hpp"
 #include "minhook/include/MinHook.h"
 #include "utils/Math.hpp"
+#include "utils/PhaseGraph.hpp"
 #include "version.hpp"
 #include <algorithm>
+#include <atomic>
 #include <map>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 // #define DEBUG_PRINT
 
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 
-std::map<std::string, LPVOID> hooks;
-std::map<std::string, LPVOID> hookTargets;
 std::queue<std::pair<std::string, std::function<void()>>> internalCallInitQueue;
 
-bool CreateHook(const char* assemblyName, const char* nameSpace, const char* className, const char* methodName, int paramCount, const char* returnType,
-                const char** paramTypes, LPVOID pDetour, LPVOID* ppOriginal) {
-    std::string hookName = std::string(nameSpace) + std::string(className) + std::string(methodName);
+struct HookDefinition {
+    const char* name; // Flattened ns + class + method, as in the HookId and detour names
+    const char* assemblyName;
+    const char* nameSpace;
+    const char* className;
+    const char* methodName;
+    int paramCount;
+    const char* returnType;
+    const char* paramTypes[MaxHookParams];
+    LPVOID detour;
+};
 
-    const int maxRetries = 100;
-    const int retryDelay = 50;
+#define STRINGIFY(x) #x
+#define HOOK_DEFINITION(assembly, ns, class, method, paramcount, returntype, ...)                                                                              \
+    {STRINGIFY(ns##class##method), #assembly, #ns, #class, #method, paramcount, returntype, __VA_ARGS__,                                                       \
+     reinterpret_cast<LPVOID>(&Hooks::hk##ns##class##method)},
+#define HOOK_NESTED_DEFINITION(assembly, ns, parentclass, nestedclass, method, paramcount, returntype, ...)                                                    \
+    {STRINGIFY(ns##parentclass##nestedclass##method), #assembly, #ns, #parentclass "+" #nestedclass, #method, paramcount, returntype, __VA_ARGS__,             \
+     reinterpret_cast<LPVOID>(&Hooks::hk##ns##parentclass##nestedclass##method)},
+
+static const HookDefinition hookDefinitions[] = {HOOK_TABLE(HOOK_DEFINITION, HOOK_NESTED_DEFINITION)};
+static_assert(sizeof(hookDefinitions) / sizeof(hookDefinitions[0]) == HookCount, "hookDefinitions must cover HOOK_TABLE");
+
+static LPVOID hookOriginals[HookCount] = {}; // Trampolines, indexed by HookId
+static LPVOID hookTargets[HookCount] = {};   // Hooked method entry points, nullptr when not hooked
+
+static LPVOID GetOriginal(HookId id) { return hookOriginals[static_cast<size_t>(id)]; }
+
+// Resolves all hooks declared on one class: its methods are listed once into a name index,
+// then each hook picks its overload from the index by signature and compiles it
+static void ResolveHookGroup(const std::vector<size_t>& group, LPVOID* targets) {
+    MonoRuntime* runtime = G::g_monoRuntime.get();
+    const HookDefinition& first = hookDefinitions[group.front()];
+
+    MonoClass* klass = runtime->GetClass(first.assemblyName, first.nameSpace, first.className);
+    if (!klass) {
+        LOG_ERROR("Failed to find class %s::%s::%s", first.assemblyName, first.nameSpace, first.className);
+        return;
+    }
 
-    for (int attempt = 0; attempt < maxRetries; attempt++) {
-        LPVOID pTarget = G::g_monoRuntime->GetMethodAddress(assemblyName, nameSpace, className, methodName, paramCount, returnType, paramTypes);
+    std::unordered_multimap<std::string_view, MonoMethod*> methodIndex;
+    for (MonoMethod* method : runtime->GetMethods(klass)) {
+        methodIndex.emplace(runtime->GetMethodName(method), method);
+    }
 
-        if (!pTarget) {
-            LOG_ERROR("Failed to get method address for %s::%s::%s::%s", assemblyName, nameSpace, className, methodName);
-            return false;
+    for (size_t id : group) {
+        const HookDefinition& def = hookDefinitions[id];
+        auto [begin, end] = methodIndex.equal_range(def.methodName);
+        for (auto it = begin; it != end && !targets[id]; ++it) {
+            if (runtime->MethodMatchesSignature(it->second, def.paramCount, def.returnType, def.paramTypes)) {
+                targets[id] = runtime->CompileMethod(it->second);
+            }
+        }
+
+        if (!targets[id]) {
+            LOG_ERROR("Failed to get method address for %s::%s::%s::%s", def.assemblyName, def.nameSpace, def.className, def.methodName);
+        }
+    }
+}
+
+// Resolves every hook target in one pass. JIT compiling the targets dominates this, so the class groups are
+// spread over a few worker threads, each attached to Mono for the duration.
+static void ResolveHookTargets(LPVOID* targets) {
+    std::map<std::string, std::vector<size_t>> classGroups;
+    for (size_t id = 0; id < HookCount; id++) {
+        const HookDefinition& def = hookDefinitions[id];
+        classGroups[std::string(def.assemblyName) + "/" + def.nameSpace + "/" + def.className].push_back(id);
+    }
+
+    std::vector<const std::vector<size_t>*> groups;
+    for (const auto& [key, group] : classGroups) {
+        groups.push_back(&group);
+    }
+
+    std::atomic<size_t> nextGroup{0};
+    auto resolveGroups = [&]() {
+        for (size_t index; (index = nextGroup.fetch_add(1, std::memory_order_relaxed)) < groups.size();) {
+            ResolveHookGroup(*groups[index], targets);
         }
+    };
 
-        MH_STATUS create_status = MH_CreateHook(pTarget, pDetour, ppOriginal);
+    size_t workerCount = std::min<size_t>(std::clamp(std::thread::hardware_concurrency(), 1u, 4u), groups.size());
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back([&]() {
+            if (!G::g_monoRuntime->AttachThread())
+                return;
+            resolveGroups();
+            G::g_monoRuntime->DetachThread();
+        });
+    }
+
+    // The calling thread takes a share too, it is a startup worker that may not have touched Mono yet
+    if (G::g_monoRuntime->AttachThread())
+        resolveGroups();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+static bool CreateHook(HookId hookId, LPVOID pTarget) {
+    size_t id = static_cast<size_t>(hookId);
+    const HookDefinition& def = hookDefinitions[id];
+
+    const int maxRetries = 100;
+    const int retryDelay = 50;
+
+    for (int attempt = 0; attempt < maxRetries; attempt++) {
+        MH_STATUS create_status = MH_CreateHook(pTarget, def.detour, &hookOriginals[id]);
         if (create_status == MH_OK) {
-            hooks[hookName] = *ppOriginal;
-            hookTargets[hookName] = pTarget;
+            hookTargets[id] = pTarget;
             return true;
         }
 
         if (attempt < maxRetries - 1) {
-            LOG_WARNING("Hook creation attempt %d failed for %s::%s::%s (Status: %d), retrying...", attempt + 1, nameSpace, className, methodName,
+            LOG_WARNING("Hook creation attempt %d failed for %s::%s::%s (Status: %d), retrying...", attempt + 1, def.nameSpace, def.className, def.methodName,
                         create_status);
             Sleep(retryDelay);
         }
     }
 
-    LOG_ERROR("Hook creation failed after %d attempts for %s::%s::%s", maxRetries, nameSpace, className, methodName);
+    LOG_ERROR("Hook creation failed after %d attempts for %s::%s::%s", maxRetries, def.nameSpace, def.className, def.methodName);
     return false;
 }
 
-#define STRINGIFY(x) #x
-#define HOOK(assembly, ns, class, method, paramcount, returntype, ...)                                                                                         \
-    {                                                                                                                                                          \
-        const char* paramTypes[] = __VA_ARGS__;                                                                                                                \
-        void (*fp##ns##class##method)(void);                                                                                                                   \
-        if (CreateHook(#assembly, #ns, #class, #method, paramcount, returntype, paramTypes, reinterpret_cast<LPVOID>(&Hooks::hk##ns##class##method),           \
-                       reinterpret_cast<LPVOID*>(&fp##ns##class##method))) {                                                                                   \
-            LOG_INFO(STRINGIFY(Hooked ns##class##method));                                                                                                     \
-        } else {                                                                                                                                               \
-            LOG_ERROR(STRINGIFY(Failed to hook ns##class##method));                                                                                            \
-            G::allHooksLoaded = false;                                                                                                                         \
-        }                                                                                                                                                      \
-    }
-
-#define HOOK_NESTED(assembly, ns, parentclass, nestedclass, method, paramcount, returntype, ...)                                                               \
-    {                                                                                                                                                          \
-        const char* paramTypes[] = __VA_ARGS__;                                                                                                                \
-        void (*fp##ns##parentclass##nestedclass##method)(void);                                                                                                \
-        if (CreateHook(#assembly, #ns, #parentclass "+" #nestedclass, #method, paramcount, returntype, paramTypes,                                             \
-                       reinterpret_cast<LPVOID>(&Hooks::hk##ns##parentclass##nestedclass##method),                                                             \
-                       reinterpret_cast<LPVOID*>(&fp##ns##parentclass##nestedclass##method))) {                                                                \
-            LOG_INFO(STRINGIFY(Hooked ns##parentclass##nestedclass##method));                                                                                  \
-        } else {                                                                                                                                               \
-            LOG_ERROR(STRINGIFY(Failed to hook ns##parentclass##nestedclass##method));                                                                         \
-            G::allHooksLoaded = false;                                                                                                                         \
-        }                                                                                                                                                      \
-    }
-
 #define DEFINE_INTERNAL_CALL(Assembly, Namespace, Class, Method, ParamCount, ReturnType, ...)                                                                  \
     typedef ReturnType (*Class##_##Method##_fn)(__VA_ARGS__);                                                                                                  \
     Class##_##Method##_fn Hooks::Class##_##Method = nullptr;                                                                                                   \
@@ -136,170 +205,39 @@ DEFINE_INTERNAL_CALL(UnityEngine.PhysicsModule, UnityEngine, PhysicsScene, Inter
 DEFINE_INTERNAL_CALL(UnityEngine.CoreModule, UnityEngine, Component, get_transform, 0, void*, void* component);
 DEFINE_INTERNAL_CALL(UnityEngine.CoreModule, UnityEngine, GameObject, get_transform, 0, void*, void* gameObject);
 
-void Hooks::Init() {
-    MH_STATUS status = MH_Initialize();
-    if (status != MH_OK) {
-        LOG_ERROR("Failed to initialize MinHook: %s", MH_StatusToString(status));
-        G::running = false;
-        return;
-    }
-
-    G::g_monoRuntime = std::make_unique<MonoRuntime>();
-    while (!G::g_monoRuntime->Initialize()) {
-        Sleep(100);
-    }
-    G::gameFunctions = std::make_unique<GameFunctions>(G::g_monoRuntime.get());
-    while (G::gameFunctions->RoR2Application_IsLoading() && !G::gameFunctions->RoR2Application_IsLoadFinished() &&
-           G::gameFunctions->RoR2Application_GetLoadGameContentPercentage() < 10) {
-        LOG_INFO("Waiting for RoR2 to load...");
-        Sleep(1000);
-    }
-
-    bool hooked = false;
-    while (!hooked) {
-        if (kiero::init(kiero::RenderType::D3D11) == kiero::Status::Success) {
-            kiero::bind(8, reinterpret_cast<void**>(&G::oPresent), reinterpret_cast<void*>(hkPresent11));
-            hooked = true;
+// Creates every resolved hook and enables them all with a single MH_ApplyQueued
+static bool InstallHooks(LPVOID* targets) {
+    size_t queuedHooks = 0;
+    for (size_t id = 0; id < HookCount; id++) {
+        const char* name = hookDefinitions[id].name;
+        if (!targets[id] || !CreateHook(static_cast<HookId>(id), targets[id])) {
+            LOG_ERROR("Failed to hook %s", name);
+            G::allHooksLoaded = false;
+            continue;
         }
-    }
 
-    HOOK(RoR2, RoR2, RoR2Application, Update, 0, "System.Void", {});
-    HOOK(Rewired_Core, Rewired, Player, GetButtonDown, 1, "System.Boolean", {"System.Int32"});
-    HOOK(RoR2, RoR2, RoR2Application, UpdateCursorState, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, MPEventSystemManager, Update, 0, "System.Void", {});
-    HOOK(UnityEngine.CoreModule, UnityEngine, Cursor, set_lockState, 1, "System.Void", {"UnityEngine.CursorLockMode"});
-    HOOK(UnityEngine.CoreModule, UnityEngine, Cursor, set_visible, 1, "System.Void", {"System.Boolean"});
-    HOOK(RoR2, RoR2, LocalUser, RebuildControlChain, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, Inventory, HandleInventoryChanged, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, Inventory, RemoveItem, 2, "System.Void", {"RoR2.ItemIndex", "System.Int32"});
-    HOOK_NESTED(RoR2, RoR2, ItemStealController, StolenInventoryInfo, StealItem, 3, "System.Int32",
-                {"RoR2.ItemIndex", "System.Int32", "System.Nullable<System.Boolean>"});
-    HOOK(RoR2, RoR2, SteamworksServerManager, TagsStringUpdated, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TeleporterInteraction, Awake, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TeleporterInteraction, FixedUpdate, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TeleporterInteraction, OnDestroy, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, ConvertPlayerMoneyToExperience, FixedUpdate, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, CharacterBody, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, CharacterBody, OnDestroy, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, CharacterMotor, AddDisplacement, 1, "System.Void", {"UnityEngine.Vector3"});
-    HOOK(RoR2, RoR2, CharacterMotor, ApplyForce, 3, "System.Void", {"UnityEngine.Vector3", "System.Boolean", "System.Boolean"});
-    HOOK(RoR2, RoR2, HuntressTracker, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, BullseyeSearch, GetResults, 0, "System.Collections.Generic.IEnumerable<RoR2.HurtBox>", {});
-    HOOK(RoR2, RoR2, BullseyeSearch, RefreshCandidates, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, PurchaseInteraction, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, BarrelInteraction, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, GenericPickupController, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, GenericPickupController, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TimedChestController, OnEnable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TimedChestController, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TeamManager, OnEnable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TeamManager, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, GenericInteraction, OnEnable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, PickupPickerController, Awake, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, PickupPickerController, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, Run, AdvanceStage, 1, "System.Void", {"RoR2.SceneDef"});
-    HOOK(RoR2, RoR2, Run, Awake, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, Run, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, Stage, OnDisable, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, ChestBehavior, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, ShopTerminalBehavior, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, PressurePlateController, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, HoldoutZoneController, Update, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, TimedChestController, GetInteractability, 1, "RoR2.Interactability", {"RoR2.Interactor"});
-    HOOK(RoR2, RoR2, PurchaseInteraction, GetInteractability, 1, "RoR2.Interactability", {"RoR2.Interactor"});
-    HOOK(RoR2, RoR2, PortalSpawner, Start, 0, "System.Void", {});
-    HOOK(RoR2, RoR2, CharacterMaster, GetDeployableSameSlotLimit, 1, "System.Int32", {"RoR2.DeployableSlot"});
-    HOOK(RoR2, RoR2, CharacterMaster, SpawnBody, 2, "RoR2.CharacterBody", {"UnityEngine.Vector3", "UnityEngine.Quaternion"});
-
-    for (auto& target : hookTargets) {
-        MH_STATUS enable_status = MH_EnableHook(target.second);
-        if (enable_status == MH_OK) {
-            LOG_INFO("Hook successfully enabled for %s", target.first.c_str());
+        MH_STATUS queue_status = MH_QueueEnableHook(targets[id]);
+        if (queue_status == MH_OK) {
+            LOG_INFO("Hooked %s", name);
+            queuedHooks++;
         } else {
-            LOG_ERROR("Hook enabling failed for %s, error: %s (code: %d)", target.first.c_str(), MH_StatusToString(enable_status), enable_status);
-        }
-    }
-
-    LOG_INFO("Initializing %zu internal calls", internalCallInitQueue.size());
-    while (!internalCallInitQueue.empty()) {
-        auto [name, func] = internalCallInitQueue.front();
-        internalCallInitQueue.pop();
-
-        LOG_INFO("Initializing internal call: %s", name.c_str());
-        func();
-    }
-
-    G::localPlayer->InitializeItems();
-
-    // Initialize enemies
-    int enemyCount = -1;
-    do {
-        enemyCount = G::gameFunctions->LoadEnemies();
-        if (enemyCount == -1) {
-            Sleep(2000);
-        }
-    } while (enemyCount == -1);
-    LOG_INFO("Enemies loaded successfully");
-
-    // Initialize body catalog
-    std::vector<std::pair<std::string, GameObject*>> bodyPrefabsWithNames;
-    do {
-        bodyPrefabsWithNames = G::gameFunctions->GetAllBodyPrefabsWithNames();
-        if (bodyPrefabsWithNames.empty()) {
-            LOG_INFO("Waiting for BodyCatalog to be initialized...");
-            Sleep(2000);
+            LOG_ERROR("Hook enabling failed for %s, error: %s (code: %d)", name, MH_StatusToString(queue_status), queue_status);
+            G::allHooksLoaded = false;
         }
-    } while (bodyPrefabsWithNames.empty());
-    LOG_INFO("BodyCatalog loaded with %d body prefabs", bodyPrefabsWithNames.size());
-    G::localPlayer->SetBodyPrefabsWithNames(bodyPrefabsWithNames);
-
-    // Initialize elite types
-    int eliteCount = -1;
-    do {
-        eliteCount = G::gameFunctions->LoadElites();
-        if (eliteCount == -1) {
-            Sleep(1000);
-        }
-    } while (eliteCount == -1);
-    LOG_INFO("Elites loaded successfully");
-
-    // Initialize enemy spawning module
-    G::enemySpawningModule->InitializeEnemies();
-    G::enemySpawningModule->InitializeItems();
-
-#ifdef DEBUG_PRINT
-    std::shared_lock<std::shared_mutex> enemyLock(G::enemiesMutex);
-    for (auto& enemy : G::enemies) {
-        LOG_INFO("Enemy: %s, name: %s, index: %d", enemy.displayName.c_str(), enemy.masterName.c_str(), enemy.masterIndex);
     }
-#endif
 
-#ifdef DEBUG_PRINT
-    std::shared_lock<std::shared_mutex> lock(G::itemsMutex);
-    for (auto& item : G::items) {
-        LOG_INFO("Item: %s, name: %s, index: %d, tier: %d, nameToken: %s, pickupToken: %s, "
-                 "descriptionToken: %s, loreToken: %s, tierName: %s, isDroppable: %d, canScrap: %d, "
-                 "canRestack: %d, canRemove: %d, isConsumed: %d, hidden: %d, tags: %zu",
-                 item.displayName.c_str(), item.name.c_str(), item.index, static_cast<int>(item.tier), item.nameToken.c_str(), item.pickupToken.c_str(),
-                 item.descriptionToken.c_str(), item.loreToken.c_str(), item.tierName.c_str(), item.isDroppable, item.canScrap, item.canRestack, item.canRemove,
-                 item.isConsumed, item.hidden, item.tags.size());
-        for (auto& tag : item.tags) {
-            LOG_INFO("Tag: %d", tag);
-        }
-        LOG_INFO("-----------------------------------------------------");
+    // Enabling freezes every other thread in the process while the targets are patched, so all hooks go in at once
+    MH_STATUS enable_status = MH_ApplyQueued();
+    if (enable_status == MH_OK) {
+        LOG_INFO("Enabled %zu hooks", queuedHooks);
+    } else {
+        LOG_ERROR("Hook enabling failed, error: %s (code: %d)", MH_StatusToString(enable_status), enable_status);
+        G::allHooksLoaded = false;
     }
-#endif // DEBUG_PRINT
-
-    // Load and cache all pickup names
-    int pickupCount = -1;
-    do {
-        pickupCount = G::gameFunctions->LoadPickupNames();
-        if (pickupCount == -1) {
-            Sleep(2000);
-        }
-    } while (pickupCount == -1);
-    LOG_INFO("Loaded %d pickup names", pickupCount);
+    return true; // Missing hooks are reported through G::allHooksLoaded, the rest of the mod still works
+}
 
+static void InitializeLayers() {
     MonoClass* layerMaskClass = G::g_monoRuntime->GetClass("UnityEngine.CoreModule", "UnityEngine", "LayerMask");
     if (layerMaskClass) {
         LOG_INFO("Getting layer indices using LayerMask.NameToLayer...");
@@ -307,7 +245,7 @@ void Hooks::Init() {
         MonoMethod* nameToLayerMethod = G::g_monoRuntime->GetMethod(layerMaskClass, "NameToLayer", 1);
         if (nameToLayerMethod) {
             auto getLayerByName = [&](const char* layerName) -> int {
-                MonoString* layerNameStr = G::g_monoRuntime->CreateString(layerName);
+                MonoString* layerNameStr = G::g_monoRuntime->GetConstantString(layerName);
                 MonoObject* result = G::g_monoRuntime->InvokeMethod(nameToLayerMethod, nullptr, reinterpret_cast<void**>(&layerNameStr));
                 if (result) {
                     return *static_cast<int*>(G::g_monoRuntime->m_mono_object_unbox(result));
@@ -329,31 +267,231 @@ void Hooks::Init() {
     } else {
         LOG_ERROR("Failed to find LayerMask class");
     }
+}
 
-    G::showMenuControl->SetOnChange([](bool enabled) {
-        if (enabled) {
-            G::gameFunctions->Cursor_SetLockState(2); // CursorLockMode.Confined
-            G::gameFunctions->Cursor_SetVisible(true);
+// Switches off every module that reads a struct whose layout no longer matches the game
+static void ApplyStructLayouts() {
+    std::pair<const char*, ModuleBase*> modules[] = {{"Player", G::localPlayer.get()},
+                                                     {"ESP", G::espModule.get()},
+                                                     {"World", G::worldModule.get()},
+                                                     {"Enemy spawning", G::enemySpawningModule.get()},
+                                                     {"Enemy", G::enemyModule.get()},
+                                                     {"Interactable spawning", G::interactableSpawningModule.get()}};
+    for (auto& [name, module] : modules) {
+        bool compatible = G::structLayouts->AllMatch(module->GetRequiredStructs());
+        module->SetLayoutCompatible(compatible);
+        if (!compatible) {
+            LOG_ERROR("%s module disabled, the game changed the layout of a struct it reads", name);
         }
+    }
+}
+
+// Retries load until it succeeds, false if the mod is unloaded while waiting
+static bool RetryUntilLoaded(const char* what, DWORD retryDelay, const std::function<bool()>& load) {
+    while (!load()) {
+        if (!G::running)
+            return false;
+        LOG_INFO("Waiting for %s...", what);
+        Sleep(retryDelay);
+    }
+    return true;
+}
+
+// Startup runs as a dependency graph: waiting for the game, hook resolution, the internal calls and the catalog loaders
+// overlap instead of running back to back, and the log gets a per-phase timing report at the end
+void Hooks::Init() {
+    PhaseGraph startup;
+    LPVOID targets[HookCount] = {};
+
+    auto minHook = startup.Add("MinHook", {}, []() {
+        MH_STATUS status = MH_Initialize();
+        if (status != MH_OK) {
+            LOG_ERROR("Failed to initialize MinHook: %s", MH_StatusToString(status));
+            G::running = false;
+            return false;
+        }
+        return true;
+    });
+
+    auto mono = startup.Add("Mono runtime", {}, []() {
+        G::g_monoRuntime = std::make_unique<MonoRuntime>();
+        if (!RetryUntilLoaded("Mono", 100, []() { return G::g_monoRuntime->Initialize(); }))
+            return false;
+        G::gameFunctions = std::make_unique<GameFunctions>(G::g_monoRuntime.get());
+        return true;
+    });
+
+    auto gameContent = startup.Add("Game content", {mono}, []() {
+        return RetryUntilLoaded("RoR2 to load", 1000, []() {
+            return !G::gameFunctions->RoR2Application_IsLoading() || G::gameFunctions->RoR2Application_IsLoadFinished() ||
+                   G::gameFunctions->RoR2Application_GetLoadGameContentPercentage() >= 10;
+        });
+    });
+
+    auto structLayouts = startup.Add("Struct layouts", {mono}, []() {
+        G::structLayouts->Validate(G::g_monoRuntime.get());
+        ApplyStructLayouts();
+        return true;
+    });
+
+    // Also after the layout check, the first frame already draws module UI and renders ESP
+    auto present = startup.Add("Present hook", {minHook, gameContent, structLayouts}, []() {
+        // kiero fails until the game has a D3D11 device, back off between attempts instead of spinning
+        return RetryUntilLoaded("D3D11", 100, []() {
+            if (kiero::init(kiero::RenderType::D3D11) != kiero::Status::Success)
+                return false;
+            kiero::bind(8, reinterpret_cast<void**>(&G::oPresent), reinterpret_cast<void*>(hkPresent11));
+            return true;
+        });
+    });
+
+    auto hookResolution = startup.Add("Hook resolution", {mono}, [&targets]() {
+        ResolveHookTargets(targets);
+        return true;
+    });
+
+    // After the layout check so no detour runs a module that is about to be switched off
+    auto hookInstall = startup.Add("Hook install", {minHook, hookResolution, gameContent, structLayouts}, [&targets]() { return InstallHooks(targets); });
+
+    auto internalCalls = startup.Add("Internal calls", {mono}, []() {
+        LOG_INFO("Initializing %zu internal calls", internalCallInitQueue.size());
+        while (!internalCallInitQueue.empty()) {
+            auto [name, func] = internalCallInitQueue.front();
+            internalCallInitQueue.pop();
+
+            LOG_INFO("Initializing internal call: %s", name.c_str());
+            func();
+        }
+        return G::running;
+    });
+
+    // A miss is not a failure, the catalog loaders then walk the game's catalogs themselves
+    auto catalogCache = startup.Add("Catalog cache", {gameContent}, []() {
+        G::gameFunctions->LoadCatalogCache();
+        return true;
+    });
+
+    // The catalog loaders read ItemDef, PickupDef and CharacterBody, through field accessors when the layout check flagged them
+    auto items = startup.Add("Items", {catalogCache, structLayouts}, []() {
+        G::localPlayer->InitializeItems();
+        return true;
+    });
+
+    auto enemies = startup.Add("Enemies", {catalogCache}, []() {
+        if (!RetryUntilLoaded("MasterCatalog", 2000, []() { return G::gameFunctions->LoadEnemies() != -1; }))
+            return false;
+        LOG_INFO("Enemies loaded successfully");
+        return true;
+    });
+
+    auto bodies = startup.Add("Body catalog", {gameContent, structLayouts}, []() {
+        std::vector<std::pair<std::string, GameObject*>> bodyPrefabsWithNames;
+        if (!RetryUntilLoaded("BodyCatalog to be initialized", 2000, [&]() {
+                bodyPrefabsWithNames = G::gameFunctions->GetAllBodyPrefabsWithNames();
+                return !bodyPrefabsWithNames.empty();
+            }))
+            return false;
+        LOG_INFO("BodyCatalog loaded with %d body prefabs", bodyPrefabsWithNames.size());
+        G::localPlayer->SetBodyPrefabsWithNames(bodyPrefabsWithNames);
+        return true;
+    });
+
+    auto elites = startup.Add("Elites", {catalogCache}, []() {
+        if (!RetryUntilLoaded("BuffCatalog", 1000, []() { return G::gameFunctions->LoadElites() != -1; }))
+            return false;
+        LOG_INFO("Elites loaded successfully");
+        return true;
+    });
+
+    auto enemySpawning = startup.Add("Enemy spawning", {items, enemies, elites}, []() {
+        G::enemySpawningModule->InitializeEnemies();
+        G::enemySpawningModule->InitializeItems();
+#ifdef DEBUG_PRINT
+        std::shared_lock<std::shared_mutex> enemyLock(G::enemiesMutex);
+        for (auto& enemy : G::enemies) {
+            LOG_INFO("Enemy: %s, name: %s, index: %d", enemy.displayName.c_str(), enemy.masterName.c_str(), enemy.masterIndex);
+        }
+#endif
+
+#ifdef DEBUG_PRINT
+        std::shared_lock<std::shared_mutex> lock(G::itemsMutex);
+        for (auto& item : G::items) {
+            LOG_INFO("Item: %s, name: %s, index: %d, tier: %d, nameToken: %s, pickupToken: %s, "
+                     "descriptionToken: %s, loreToken: %s, tierName: %s, isDroppable: %d, canScrap: %d, "
+                     "canRestack: %d, canRemove: %d, isConsumed: %d, hidden: %d, tags: %zu",
+                     item.displayName.c_str(), item.name.c_str(), item.index, static_cast<int>(item.tier), item.nameToken.c_str(), item.pickupToken.c_str(),
+                     item.descriptionToken.c_str(), item.loreToken.c_str(), item.tierName.c_str(), item.isDroppable, item.canScrap, item.canRestack, item.canRemove,
+                     item.isConsumed, item.hidden, item.tags.size());
+            for (auto& tag : item.tags) {
+                LOG_INFO("Tag: %d", tag);
+            }
+            LOG_INFO("-----------------------------------------------------");
+        }
+#endif // DEBUG_PRINT
+        return true;
+    });
+
+    // Like items and bodies this translates names through Language_GetString, which is safe to call from several phases at once
+    auto pickups = startup.Add("Pickup names", {catalogCache, structLayouts}, []() {
+        int pickupCount = -1;
+        if (!RetryUntilLoaded("PickupCatalog", 2000, [&]() { return (pickupCount = G::gameFunctions->LoadPickupNames()) != -1; }))
+            return false;
+        LOG_INFO("Loaded %d pickup names", pickupCount);
+        return true;
     });
-    G::showMenuControl->SetHotkey(ImGuiKey_Insert);
-    G::showMenuControl->SetSaveEnabledState(false);
-    G::runningButtonControl->SetSaveEnabledState(false);
 
-    G::hooksInitialized = true;
+    auto catalogCacheSave = startup.Add("Catalog cache save", {items, enemies, elites, pickups}, []() {
+        G::gameFunctions->SaveCatalogCache();
+        return true;
+    });
 
-    ConfigManager::Initialize();
+    auto layers = startup.Add("Layers", {gameContent}, []() {
+        InitializeLayers();
+        return true;
+    });
 
-    G::csHelper = std::make_unique<CSharpHelper>(G::g_monoRuntime.get());
-    if (G::csHelper->Initialize()) {
+    auto helper = startup.Add("Helper assembly", {gameContent}, []() {
+        G::csHelper = std::make_unique<CSharpHelper>(G::g_monoRuntime.get());
+        if (!G::csHelper->Initialize()) {
+            LOG_ERROR("Failed to initialize CSharpHelper");
+            return true; // Only interactable spawning depends on it
+        }
         LOG_INFO("CSharpHelper: initialized successfully");
         G::interactableSpawningModule->Initialize();
-    } else {
-        LOG_ERROR("Failed to initialize CSharpHelper");
-    }
+        return true;
+    });
+
+    startup.Add("Ready", {present, hookInstall, internalCalls, enemySpawning, bodies, pickups, catalogCacheSave, layers, helper}, []() {
+        G::showMenuControl->SetOnChange([](bool enabled) {
+            if (enabled) {
+                G::gameFunctions->Cursor_SetLockState(2); // CursorLockMode.Confined
+                G::gameFunctions->Cursor_SetVisible(true);
+            }
+        });
+        G::showMenuControl->SetHotkey(ImGuiKey_Insert);
+        G::showMenuControl->SetSaveEnabledState(false);
+        G::runningButtonControl->SetSaveEnabledState(false);
+
+        G::hooksInitialized = true;
+
+        ConfigManager::Initialize();
+
+        G::gameFunctions->RoR2Application_SetModded(true);
+        LOG_INFO("Modded: %d", G::gameFunctions->RoR2Application_IsModded());
+        return true;
+    });
 
-    G::gameFunctions->RoR2Application_SetModded(true);
-    LOG_INFO("Modded: %d", G::gameFunctions->RoR2Application_IsModded());
+    // Extra workers start before the Mono runtime exists, so they attach lazily: every MonoRuntime entry point attaches
+    // the calling thread on first use. They detach when they finish.
+    startup.Run(3, nullptr, []() {
+        if (G::g_monoRuntime)
+            G::g_monoRuntime->DetachThread();
+    });
+    startup.LogReport();
+
+    if (!startup.AllSucceeded()) {
+        LOG_ERROR("Startup did not complete, the mod stays inactive");
+    }
 }
 
 void Hooks::Unhook() {
@@ -387,24 +525,32 @@ void Hooks::Unhook() {
     }
 
     LOG_INFO("Disabling all hooks...");
-    for (auto& target : hookTargets) {
-        MH_STATUS disable_status = MH_DisableHook(target.second);
-        if (disable_status == MH_OK) {
-            LOG_INFO("Hook successfully disabled for %s", target.first.c_str());
-        } else {
-            LOG_ERROR("Hook disabling failed for %s, error: %s (code: %d)", target.first.c_str(), MH_StatusToString(disable_status), disable_status);
+    for (size_t id = 0; id < HookCount; id++) {
+        if (!hookTargets[id])
+            continue;
+        MH_STATUS queue_status = MH_QueueDisableHook(hookTargets[id]);
+        if (queue_status != MH_OK) {
+            LOG_ERROR("Hook disabling failed for %s, error: %s (code: %d)", hookDefinitions[id].name, MH_StatusToString(queue_status), queue_status);
         }
     }
-    LOG_INFO("All hooks disabled");
+    MH_STATUS disable_status = MH_ApplyQueued();
+    if (disable_status == MH_OK) {
+        LOG_INFO("All hooks disabled");
+    } else {
+        LOG_ERROR("Hook disabling failed, error: %s (code: %d)", MH_StatusToString(disable_status), disable_status);
+    }
 
     LOG_INFO("Removing all hooks...");
-    for (auto& target : hookTargets) {
-        MH_STATUS remove_status = MH_RemoveHook(target.second);
+    for (size_t id = 0; id < HookCount; id++) {
+        if (!hookTargets[id])
+            continue;
+        MH_STATUS remove_status = MH_RemoveHook(hookTargets[id]);
         if (remove_status == MH_OK) {
-            LOG_INFO("Hook successfully removed for %s", target.first.c_str());
+            LOG_INFO("Hook successfully removed for %s", hookDefinitions[id].name);
         } else {
-            LOG_ERROR("Hook removal failed for %s, error: %s (code: %d)", target.first.c_str(), MH_StatusToString(remove_status), remove_status);
+            LOG_ERROR("Hook removal failed for %s, error: %s (code: %d)", hookDefinitions[id].name, MH_StatusToString(remove_status), remove_status);
         }
+        hookTargets[id] = nullptr;
     }
     LOG_INFO("All hooks removed");
 
@@ -427,7 +573,7 @@ void Hooks::Unhook() {
 }
 
 void Hooks::hkRoR2RoR2ApplicationUpdate(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2RoR2ApplicationUpdate"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2RoR2ApplicationUpdate));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
@@ -444,33 +590,34 @@ void Hooks::hkRoR2RoR2ApplicationUpdate(void* instance) {
         action();
     }
 
-    G::espModule->OnGameUpdate();
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnGameUpdate();
 }
 
 bool Hooks::hkRewiredPlayerGetButtonDown(void* instance, int key) {
     if (G::showMenuControl->IsEnabled())
         return false;
 
-    static auto originalFunc = reinterpret_cast<bool (*)(void*, int)>(hooks["RewiredPlayerGetButtonDown"]);
+    static auto originalFunc = reinterpret_cast<bool (*)(void*, int)>(GetOriginal(HookId::RewiredPlayerGetButtonDown));
     return originalFunc(instance, key);
 }
 
 void Hooks::hkRoR2RoR2ApplicationUpdateCursorState(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2RoR2ApplicationUpdateCursorState"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2RoR2ApplicationUpdateCursorState));
     if (!G::showMenuControl->IsEnabled()) {
         originalFunc(instance);
     }
 }
 
 void Hooks::hkRoR2MPEventSystemManagerUpdate(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2MPEventSystemManagerUpdate"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2MPEventSystemManagerUpdate));
     if (!G::showMenuControl->IsEnabled()) {
         originalFunc(instance);
     }
 }
 
 void Hooks::hkUnityEngineCursorset_lockState(void* instance, int lockState) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, int)>(hooks["UnityEngineCursorset_lockState"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, int)>(GetOriginal(HookId::UnityEngineCursorset_lockState));
     if (G::showMenuControl->IsEnabled()) {
         lockState = 2; // CursorLockMode.Confined
     }
@@ -478,7 +625,7 @@ void Hooks::hkUnityEngineCursorset_lockState(void* instance, int lockState) {
 }
 
 void Hooks::hkUnityEngineCursorset_visible(void* instance, bool visible) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, bool)>(hooks["UnityEngineCursorset_visible"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, bool)>(GetOriginal(HookId::UnityEngineCursorset_visible));
     if (G::showMenuControl->IsEnabled()) {
         visible = true;
     }
@@ -486,32 +633,37 @@ void Hooks::hkUnityEngineCursorset_visible(void* instance, bool visible) {
 }
 
 void Hooks::hkRoR2LocalUserRebuildControlChain(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2LocalUserRebuildControlChain"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2LocalUserRebuildControlChain));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
         return;
     }
 
-    G::localPlayer->OnLocalUserUpdate(instance);
-    G::enemySpawningModule->OnLocalUserUpdate(instance);
-    G::enemyModule->OnLocalUserUpdate(instance);
-    G::worldModule->OnLocalUserUpdate(instance);
+    if (G::localPlayer->IsLayoutCompatible())
+        G::localPlayer->OnLocalUserUpdate(instance);
+    if (G::enemySpawningModule->IsLayoutCompatible())
+        G::enemySpawningModule->OnLocalUserUpdate(instance);
+    if (G::enemyModule->IsLayoutCompatible())
+        G::enemyModule->OnLocalUserUpdate(instance);
+    if (G::worldModule->IsLayoutCompatible())
+        G::worldModule->OnLocalUserUpdate(instance);
 }
 
 void Hooks::hkRoR2InventoryHandleInventoryChanged(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2InventoryHandleInventoryChanged"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2InventoryHandleInventoryChanged));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
         return;
     }
 
-    G::localPlayer->OnInventoryChanged(instance);
+    if (G::localPlayer->IsLayoutCompatible())
+        G::localPlayer->OnInventoryChanged(instance);
 }
 
 void Hooks::hkRoR2InventoryRemoveItem(void* instance, int itemIndex, int count) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, int, int)>(hooks["RoR2InventoryRemoveItem"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, int, int)>(GetOriginal(HookId::RoR2InventoryRemoveItem));
     if (!G::hooksInitialized || !G::localPlayer) {
         originalFunc(instance, itemIndex, count);
         return;
@@ -533,7 +685,7 @@ void Hooks::hkRoR2InventoryRemoveItem(void* instance, int itemIndex, int count)
 }
 
 int Hooks::hkRoR2ItemStealControllerStolenInventoryInfoStealItem(void* instance, int itemIndex, int maxStackToSteal, void* useOrbOverride) {
-    static auto originalFunc = reinterpret_cast<int (*)(void*, int, int, void*)>(hooks["RoR2ItemStealController+StolenInventoryInfoStealItem"]);
+    static auto originalFunc = reinterpret_cast<int (*)(void*, int, int, void*)>(GetOriginal(HookId::RoR2ItemStealControllerStolenInventoryInfoStealItem));
 
     if (!originalFunc) {
         return 0;
@@ -554,19 +706,19 @@ int Hooks::hkRoR2ItemStealControllerStolenInventoryInfoStealItem(void* instance,
 }
 
 void Hooks::hkRoR2SteamworksServerManagerTagsStringUpdated(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2SteamworksServerManagerTagsStringUpdated"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2SteamworksServerManagerTagsStringUpdated));
     originalFunc(instance);
 
     LOG_INFO("ServerManagerTags::StringUpdated - instance=%p", instance);
     ServerManagerBase* serverManager_ptr = static_cast<ServerManagerBase*>(instance);
-    if (serverManager_ptr && serverManager_ptr->tags) {
+    if (serverManager_ptr && G::structLayouts->Matches(GameStructId::ServerManagerBase) && serverManager_ptr->tags) {
         MonoList list(static_cast<MonoObject*>(serverManager_ptr->tags));
         list.AddItem("ror2mod");
     }
 }
 
 void Hooks::hkRoR2TeleporterInteractionAwake(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TeleporterInteractionAwake"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TeleporterInteractionAwake));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
@@ -574,69 +726,78 @@ void Hooks::hkRoR2TeleporterInteractionAwake(void* instance) {
     }
 
     LOG_INFO("TeleporterInteraction::Awake - instance=%p", instance);
-    G::espModule->OnTeleporterAwake(instance);
-    G::worldModule->OnTeleporterInteractionAwake(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnTeleporterAwake(instance);
+    if (G::worldModule->IsLayoutCompatible())
+        G::worldModule->OnTeleporterInteractionAwake(instance);
 }
 
 void Hooks::hkRoR2TeleporterInteractionFixedUpdate(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TeleporterInteractionFixedUpdate"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TeleporterInteractionFixedUpdate));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
         return;
     }
 
-    G::worldModule->OnTeleporterInteractionFixedUpdate(instance);
-    G::espModule->OnTeleporterFixedUpdate(instance);
+    if (G::worldModule->IsLayoutCompatible())
+        G::worldModule->OnTeleporterInteractionFixedUpdate(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnTeleporterFixedUpdate(instance);
 }
 
 void Hooks::hkRoR2TeleporterInteractionOnDestroy(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TeleporterInteractionOnDestroy"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TeleporterInteractionOnDestroy));
 
     if (G::hooksInitialized) {
         LOG_INFO("TeleporterInteraction::OnDestroy - instance=%p", instance);
-        G::espModule->OnTeleporterDestroyed(instance);
+        if (G::espModule->IsLayoutCompatible())
+            G::espModule->OnTeleporterDestroyed(instance);
     }
 
     originalFunc(instance);
 }
 
 void Hooks::hkRoR2ConvertPlayerMoneyToExperienceFixedUpdate(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2ConvertPlayerMoneyToExperienceFixedUpdate"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2ConvertPlayerMoneyToExperienceFixedUpdate));
     originalFunc(instance);
 
     if (!G::hooksInitialized) {
         return;
     }
 
-    G::localPlayer->ConvertPlayerMoneyToExperienceUpdate();
+    if (G::localPlayer->IsLayoutCompatible())
+        G::localPlayer->ConvertPlayerMoneyToExperienceUpdate();
 }
 
 void Hooks::hkRoR2CharacterBodyStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2CharacterBodyStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2CharacterBodyStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("CharacterBody::Start - instance=%p", instance);
-    G::espModule->OnCharacterBodySpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnCharacterBodySpawned(instance);
 }
 
 void Hooks::hkRoR2CharacterBodyOnDestroy(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2CharacterBodyOnDestroy"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2CharacterBodyOnDestroy));
 
     if (G::hooksInitialized) {
         LOG_INFO("CharacterBody::OnDestroy - instance=%p", instance);
-        G::espModule->OnCharacterBodyDestroyed(instance);
-        G::localPlayer->OnCharacterBodyDestroyed(instance);
+        if (G::espModule->IsLayoutCompatible())
+            G::espModule->OnCharacterBodyDestroyed(instance);
+        if (G::localPlayer->IsLayoutCompatible())
+            G::localPlayer->OnCharacterBodyDestroyed(instance);
     }
 
     originalFunc(instance);
 }
 
 void Hooks::hkRoR2CharacterMotorAddDisplacement(void* instance, Vector3* displacement) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, Vector3*)>(hooks["RoR2CharacterMotorAddDisplacement"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, Vector3*)>(GetOriginal(HookId::RoR2CharacterMotorAddDisplacement));
 
     if (!G::hooksInitialized) {
         originalFunc(instance, displacement);
@@ -653,7 +814,7 @@ void Hooks::hkRoR2CharacterMotorAddDisplacement(void* instance, Vector3* displac
 }
 
 void Hooks::hkRoR2CharacterMotorApplyForce(void* instance, Vector3* force, bool alwaysApply, bool disableAirControl) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, Vector3*, bool, bool)>(hooks["RoR2CharacterMotorApplyForce"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, Vector3*, bool, bool)>(GetOriginal(HookId::RoR2CharacterMotorApplyForce));
 
     if (!G::hooksInitialized) {
         originalFunc(instance, force, alwaysApply, disableAirControl);
@@ -670,18 +831,19 @@ void Hooks::hkRoR2CharacterMotorApplyForce(void* instance, Vector3* force, bool
 }
 
 void Hooks::hkRoR2HuntressTrackerStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2HuntressTrackerStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2HuntressTrackerStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("HuntressTracker::Start - instance=%p", instance);
-    G::localPlayer->OnHuntressTrackerStart(instance);
+    if (G::localPlayer->IsLayoutCompatible())
+        G::localPlayer->OnHuntressTrackerStart(instance);
 }
 
 void Hooks::hkRoR2BullseyeSearchRefreshCandidates(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2BullseyeSearchRefreshCandidates"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2BullseyeSearchRefreshCandidates));
 
     if (!G::hooksInitialized) {
         originalFunc(instance);
@@ -723,7 +885,7 @@ void Hooks::hkRoR2BullseyeSearchRefreshCandidates(void* instance) {
 }
 
 void* Hooks::hkRoR2BullseyeSearchGetResults(void* instance) {
-    static auto originalFunc = reinterpret_cast<void* (*)(void*)>(hooks["RoR2BullseyeSearchGetResults"]);
+    static auto originalFunc = reinterpret_cast<void* (*)(void*)>(GetOriginal(HookId::RoR2BullseyeSearchGetResults));
 
     if (!G::hooksInitialized) {
         return originalFunc(instance);
@@ -753,73 +915,79 @@ void* Hooks::hkRoR2BullseyeSearchGetResults(void* instance) {
 }
 
 void Hooks::hkRoR2PurchaseInteractionStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2PurchaseInteractionStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2PurchaseInteractionStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("PurchaseInteraction::Start - instance=%p", instance);
-    G::espModule->OnPurchaseInteractionSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnPurchaseInteractionSpawned(instance);
 }
 
 void Hooks::hkRoR2BarrelInteractionStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2BarrelInteractionStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2BarrelInteractionStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("BarrelInteraction::Start - instance=%p", instance);
-    G::espModule->OnBarrelInteractionSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnBarrelInteractionSpawned(instance);
 }
 
 void Hooks::hkRoR2GenericPickupControllerStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2GenericPickupControllerStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2GenericPickupControllerStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("GenericPickupController::Start - instance=%p", instance);
-    G::espModule->OnGenericPickupControllerSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnGenericPickupControllerSpawned(instance);
 }
 
 void Hooks::hkRoR2GenericPickupControllerOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2GenericPickupControllerOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2GenericPickupControllerOnDisable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("GenericPickupController::OnDisable - instance=%p", instance);
-    G::espModule->OnGenericPickupControllerDisabled(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnGenericPickupControllerDisabled(instance);
 }
 
 void Hooks::hkRoR2TimedChestControllerOnEnable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TimedChestControllerOnEnable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TimedChestControllerOnEnable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("TimedChestController::OnEnable - instance=%p", instance);
-    G::espModule->OnTimedChestControllerSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnTimedChestControllerSpawned(instance);
 }
 
 void Hooks::hkRoR2TimedChestControllerOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TimedChestControllerOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TimedChestControllerOnDisable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("TimedChestController::OnDisable - instance=%p", instance);
-    G::espModule->OnTimedChestControllerDespawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnTimedChestControllerDespawned(instance);
 }
 
 void Hooks::hkRoR2TeamManagerOnEnable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TeamManagerOnEnable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TeamManagerOnEnable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
@@ -830,7 +998,7 @@ void Hooks::hkRoR2TeamManagerOnEnable(void* instance) {
 }
 
 void Hooks::hkRoR2TeamManagerOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2TeamManagerOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2TeamManagerOnDisable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
@@ -841,31 +1009,33 @@ void Hooks::hkRoR2TeamManagerOnDisable(void* instance) {
 }
 
 void Hooks::hkRoR2GenericInteractionOnEnable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2GenericInteractionOnEnable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2GenericInteractionOnEnable));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("GenericInteraction::OnEnable - instance=%p", instance);
-    G::espModule->OnGenericInteractionSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnGenericInteractionSpawned(instance);
 }
 
 void Hooks::hkRoR2PickupPickerControllerAwake(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2PickupPickerControllerAwake"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2PickupPickerControllerAwake));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("PickupPickerController::Awake - instance=%p", instance);
-    G::espModule->OnPickupPickerControllerSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnPickupPickerControllerSpawned(instance);
 }
 
 void Hooks::hkRoR2PickupPickerControllerOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2PickupPickerControllerOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2PickupPickerControllerOnDisable));
 
-    if (!G::hooksInitialized) {
+    if (!G::hooksInitialized || !G::espModule->IsLayoutCompatible()) {
         originalFunc(instance);
         return;
     }
@@ -879,19 +1049,21 @@ void Hooks::hkRoR2PickupPickerControllerOnDisable(void* instance) {
 
 
 void Hooks::hkRoR2RunAdvanceStage(void* instance, void* nextScene) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*, void*)>(hooks["RoR2RunAdvanceStage"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*, void*)>(GetOriginal(HookId::RoR2RunAdvanceStage));
 
     if (G::hooksInitialized) {
         LOG_INFO("Run::AdvanceStage - instance=%p", instance);
-        G::espModule->OnStageAdvance(instance);
-        G::localPlayer->OnStageAdvance(instance);
+        if (G::espModule->IsLayoutCompatible())
+            G::espModule->OnStageAdvance(instance);
+        if (G::localPlayer->IsLayoutCompatible())
+            G::localPlayer->OnStageAdvance(instance);
     }
 
     originalFunc(instance, nextScene);
 }
 
 void Hooks::hkRoR2RunAwake(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2RunAwake"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2RunAwake));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
@@ -902,11 +1074,12 @@ void Hooks::hkRoR2RunAwake(void* instance) {
 }
 
 void Hooks::hkRoR2RunOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2RunOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2RunOnDisable));
 
     if (G::hooksInitialized && G::runInstance == instance) {
         LOG_INFO("Run::OnDisable - instance=%p");
-        G::espModule->OnRunExit();
+        if (G::espModule->IsLayoutCompatible())
+            G::espModule->OnRunExit();
         G::runInstance = nullptr;
     }
 
@@ -914,61 +1087,66 @@ void Hooks::hkRoR2RunOnDisable(void* instance) {
 }
 
 void Hooks::hkRoR2StageOnDisable(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2StageOnDisable"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2StageOnDisable));
 
     if (G::hooksInitialized) {
         LOG_INFO("Stage::OnDisable - instance=%p", instance);
-        G::espModule->OnStageDisable();
+        if (G::espModule->IsLayoutCompatible())
+            G::espModule->OnStageDisable();
     }
 
     return originalFunc(instance);
 }
 
 void Hooks::hkRoR2ChestBehaviorStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2ChestBehaviorStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2ChestBehaviorStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("ChestBehavior::Start - instance=%p", instance);
-    G::espModule->OnChestBehaviorSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnChestBehaviorSpawned(instance);
 }
 
 void Hooks::hkRoR2ShopTerminalBehaviorStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2ShopTerminalBehaviorStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2ShopTerminalBehaviorStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("ShopTerminalBehavior::Start - instance=%p", instance);
-    G::espModule->OnShopTerminalBehaviorSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnShopTerminalBehaviorSpawned(instance);
 }
 
 void Hooks::hkRoR2PressurePlateControllerStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2PressurePlateControllerStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2PressurePlateControllerStart));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
     LOG_INFO("PressurePlateController::Start - instance=%p", instance);
-    G::espModule->OnPressurePlateControllerSpawned(instance);
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnPressurePlateControllerSpawned(instance);
 }
 
 void Hooks::hkRoR2HoldoutZoneControllerUpdate(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2HoldoutZoneControllerUpdate"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2HoldoutZoneControllerUpdate));
     originalFunc(instance);
 
     if (!G::hooksInitialized)
         return;
 
-    G::worldModule->OnHoldoutZoneControllerUpdate(instance);
+    if (G::worldModule->IsLayoutCompatible())
+        G::worldModule->OnHoldoutZoneControllerUpdate(instance);
 }
 
 void Hooks::hkRoR2PortalSpawnerStart(void* instance) {
-    static auto originalFunc = reinterpret_cast<void (*)(void*)>(hooks["RoR2PortalSpawnerStart"]);
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2PortalSpawnerStart));
 
     originalFunc(instance);
 
@@ -980,19 +1158,20 @@ void Hooks::hkRoR2PortalSpawnerStart(void* instance) {
     if (!portalSpawner)
         return;
 
-    if (G::worldModule->GetForceAllPortalsControl()->IsEnabled()) {
+    if (G::worldModule->IsLayoutCompatible() && G::worldModule->GetForceAllPortalsControl()->IsEnabled()) {
         portalSpawner->willSpawn = true;
     }
 }
 
 int Hooks::hkRoR2TimedChestControllerGetInteractability(void* instance, void* activator) {
-    static auto originalFunc = reinterpret_cast<int (*)(void*, void*)>(hooks["RoR2TimedChestControllerGetInteractability"]);
+    static auto originalFunc = reinterpret_cast<int (*)(void*, void*)>(GetOriginal(HookId::RoR2TimedChestControllerGetInteractability));
     int result = originalFunc(instance, activator);
 
     if (!G::hooksInitialized)
         return result;
 
-    if (G::worldModule->GetOpenExpiredTimedChestsControl()->IsEnabled() && result == static_cast<int>(Interactability_Value::ConditionsNotMet)) {
+    if (G::worldModule->IsLayoutCompatible() && G::worldModule->GetOpenExpiredTimedChestsControl()->IsEnabled() &&
+        result == static_cast<int>(Interactability_Value::ConditionsNotMet)) {
 
         TimedChestController* tcc = static_cast<TimedChestController*>(instance);
         // Only override if it's expired (not purchased)
@@ -1005,13 +1184,14 @@ int Hooks::hkRoR2TimedChestControllerGetInteractability(void* instance, void* ac
 }
 
 int Hooks::hkRoR2PurchaseInteractionGetInteractability(void* instance, void* activator) {
-    static auto originalFunc = reinterpret_cast<int (*)(void*, void*)>(hooks["RoR2PurchaseInteractionGetInteractability"]);
+    static auto originalFunc = reinterpret_cast<int (*)(void*, void*)>(GetOriginal(HookId::RoR2PurchaseInteractionGetInteractability));
     int result = originalFunc(instance, activator);
 
     if (!G::hooksInitialized)
         return result;
 
-    if (G::worldModule->GetOpenLockedInteractablesControl()->IsEnabled() && result == static_cast<int>(Interactability_Value::Disabled)) {
+    if (G::worldModule->IsLayoutCompatible() && G::worldModule->GetOpenLockedInteractablesControl()->IsEnabled() &&
+        result == static_cast<int>(Interactability_Value::Disabled)) {
         PurchaseInteraction* pi = static_cast<PurchaseInteraction*>(instance);
 
         if (pi && pi->lockGameObject != nullptr && pi->available == true) {
@@ -1023,7 +1203,7 @@ int Hooks::hkRoR2PurchaseInteractionGetInteractability(void* instance, void* act
 }
 
 int Hooks::hkRoR2CharacterMasterGetDeployableSameSlotLimit(void* instance, int deployableSlot) {
-    static auto originalFunc = reinterpret_cast<int (*)(void*, int)>(hooks["RoR2CharacterMasterGetDeployableSameSlotLimit"]);
+    static auto originalFunc = reinterpret_cast<int (*)(void*, int)>(GetOriginal(HookId::RoR2CharacterMasterGetDeployableSameSlotLimit));
 
     if (!G::hooksInitialized) {
         return originalFunc(instance, deployableSlot);
@@ -1042,9 +1222,9 @@ int Hooks::hkRoR2CharacterMasterGetDeployableSameSlotLimit(void* instance, int d
 }
 
 void* Hooks::hkRoR2CharacterMasterSpawnBody(void* instance, Vector3 position, Quaternion rotation) {
-    static auto originalFunc = reinterpret_cast<void* (*)(void*, Vector3, Quaternion)>(hooks["RoR2CharacterMasterSpawnBody"]);
+    static auto originalFunc = reinterpret_cast<void* (*)(void*, Vector3, Quaternion)>(GetOriginal(HookId::RoR2CharacterMasterSpawnBody));
 
-    if (!G::hooksInitialized) {
+    if (!G::hooksInitialized || !G::localPlayer->IsLayoutCompatible()) {
         return originalFunc(instance, position, rotation);
     }
 
@@ -1069,6 +1249,17 @@ void* Hooks::hkRoR2CharacterMasterSpawnBody(void* instance, Vector3 position, Qu
     return originalFunc(instance, position, rotation);
 }
 
+void Hooks::hkRoR2LanguageSetCurrentLanguage(void* newCurrentLanguageName) {
+    static auto originalFunc = reinterpret_cast<void (*)(void*)>(GetOriginal(HookId::RoR2LanguageSetCurrentLanguage));
+
+    originalFunc(newCurrentLanguageName);
+
+    // Static method, can run before the mod finishes initializing
+    if (G::gameFunctions) {
+        G::gameFunctions->ClearLanguageCache();
+    }
+}
+
 LRESULT __stdcall WndProc(HWND hWnd, UINT uMsg, WPARAM wParam, LPARAM lParam) {
     ImGui_ImplWin32_WndProcHandler(hWnd, uMsg, wParam, lParam);
     if (G::showMenuControl->IsEnabled()) {
@@ -1120,11 +1311,16 @@ long __stdcall Hooks::hkPresent11(IDXGISwapChain* pSwapChain, UINT SyncInterval,
     G::showMenuControl->Update();
     G::runningButtonControl->Update();
 
-    G::localPlayer->Update();
-    G::espModule->Update();
-    G::enemySpawningModule->Update();
-    G::enemyModule->Update();
-    G::interactableSpawningModule->Update();
+    if (G::localPlayer->IsLayoutCompatible())
+        G::localPlayer->Update();
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->Update();
+    if (G::enemySpawningModule->IsLayoutCompatible())
+        G::enemySpawningModule->Update();
+    if (G::enemyModule->IsLayoutCompatible())
+        G::enemyModule->Update();
+    if (G::interactableSpawningModule->IsLayoutCompatible())
+        G::interactableSpawningModule->Update();
 
     ImGuiIO& io = ImGui::GetIO();
     io.MouseDrawCursor = G::showMenuControl->IsEnabled();
@@ -1151,7 +1347,8 @@ long __stdcall Hooks::hkPresent11(IDXGISwapChain* pSwapChain, UINT SyncInterval,
         ImGui::End();
     }
 
-    G::espModule->OnFrameRender();
+    if (G::espModule->IsLayoutCompatible())
+        G::espModule->OnFrameRender();
     NotificationManager::Render();
 
     if (G::showMenuControl->IsEnabled()) {
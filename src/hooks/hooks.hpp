@@ -67,6 +67,7 @@ void hkRoR2TeamManagerOnEnable(void*);
 void hkRoR2TeamManagerOnDisable(void*);
 int hkRoR2CharacterMasterGetDeployableSameSlotLimit(void*, int);
 void* hkRoR2CharacterMasterSpawnBody(void*, Vector3, Quaternion);
+void hkRoR2LanguageSetCurrentLanguage(void*);
 
 long __stdcall hkPresent11(IDXGISwapChain*, UINT, UINT);
 } // namespace Hooks
@@ -7,20 +7,29 @@
 #include <filesystem>
 #include <imgui.h>
 
-void DrawPlayerTab() { G::localPlayer->DrawUI(); }
+// Modules switched off by the startup layout check show why instead of their controls
+static void DrawModuleUI(ModuleBase* module) {
+    if (!module->IsLayoutCompatible()) {
+        ImGui::TextDisabled("Disabled: this game version changed structs this feature reads, see the log");
+        return;
+    }
+    module->DrawUI();
+}
+
+void DrawPlayerTab() { DrawModuleUI(G::localPlayer.get()); }
 
-void DrawWorldTab() { G::worldModule->DrawUI(); }
+void DrawWorldTab() { DrawModuleUI(G::worldModule.get()); }
 
-void DrawESPTab() { G::espModule->DrawUI(); }
+void DrawESPTab() { DrawModuleUI(G::espModule.get()); }
 
 void DrawAimbotTab() {}
 
 void DrawEnemiesTab() {
-    G::enemySpawningModule->DrawUI();
-    G::enemyModule->DrawUI();
+    DrawModuleUI(G::enemySpawningModule.get());
+    DrawModuleUI(G::enemyModule.get());
 }
 
-void DrawInteractablesTab() { G::interactableSpawningModule->DrawUI(); }
+void DrawInteractablesTab() { DrawModuleUI(G::interactableSpawningModule.get()); }
 
 void DumpGameToDirectory(std::string directoryName) {
     static bool initialized = false;
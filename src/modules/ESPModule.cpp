@@ -4,14 +4,24 @@
 #include "globals/globals.hpp"
 #include "hooks/hooks.hpp"
 #include "utils/RenderUtils.hpp"
+#include "utils/TokenMatcher.hpp"
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <imgui.h>
 #include <sstream>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 
+// Extrapolation horizon, beyond this the last sample is held rather than guessed further
+static constexpr double MaxExtrapolationSeconds = 0.1;
+// Anything faster between two samples is treated as a teleport
+static constexpr float MaxTrackedSpeed = 150.0f;
+
 // ESPRenderOrderManager implementation
 ESPRenderOrderManager::ESPRenderOrderManager() { ResetToDefault(); }
 
@@ -24,32 +34,42 @@ const std::vector<ESPSubCategory>& ESPRenderOrderManager::GetSubOrder(ESPMainCat
     return empty;
 }
 
-void ESPRenderOrderManager::SetSubOrder(ESPMainCategory mainCat, const std::vector<ESPSubCategory>& order) { m_subCategoryOrders[mainCat] = order; }
+void ESPRenderOrderManager::SetSubOrder(ESPMainCategory mainCat, const std::vector<ESPSubCategory>& order) {
+    m_subCategoryOrders[mainCat] = order;
+    PublishSlotTable();
+}
 
-std::vector<ESPCategoryInfo> ESPRenderOrderManager::GetRenderOrder() const {
-    std::vector<ESPCategoryInfo> renderOrder;
+void ESPRenderOrderManager::PublishSlotTable() {
+    auto table = std::make_shared<ESPRenderSlotTable>();
+    std::memset(table->slots, -1, sizeof(table->slots));
+    table->slotCount = 0;
 
     // Use main category order directly (lowest priority first for proper rendering)
     for (ESPMainCategory mainCat : m_mainCategoryOrder) {
         auto it = m_subCategoryOrders.find(mainCat);
-        if (it != m_subCategoryOrders.end()) {
-            for (ESPSubCategory subCat : it->second) {
-                std::string displayName = GetCategoryDisplayName(mainCat);
-                if (subCat != ESPSubCategory::Single) {
-                    displayName += " (" + GetSubCategoryDisplayName(subCat) + ")";
-                }
-                renderOrder.emplace_back(mainCat, subCat, displayName);
+        if (it == m_subCategoryOrders.end()) {
+            continue;
+        }
+        for (ESPSubCategory subCat : it->second) {
+            int8_t& slot = table->slots[static_cast<int>(mainCat)][static_cast<int>(subCat)];
+            if (slot >= 0 || table->slotCount >= ESPRenderSlotTable::MaxSlots) {
+                continue;
             }
+            slot = static_cast<int8_t>(table->slotCount);
+            table->slotMainCategory[table->slotCount] = mainCat;
+            table->slotSubCategory[table->slotCount] = subCat;
+            table->slotCount++;
         }
     }
 
-    return renderOrder;
+    std::atomic_store(&m_slotTable, std::shared_ptr<const ESPRenderSlotTable>(std::move(table)));
 }
 
 void ESPRenderOrderManager::MoveCategoryUp(ESPMainCategory category) {
     auto it = std::find(m_mainCategoryOrder.begin(), m_mainCategoryOrder.end(), category);
     if (it != m_mainCategoryOrder.end() && it != m_mainCategoryOrder.begin()) {
         std::swap(*it, *(it - 1));
+        PublishSlotTable();
     }
 }
 
@@ -57,6 +77,7 @@ void ESPRenderOrderManager::MoveCategoryDown(ESPMainCategory category) {
     auto it = std::find(m_mainCategoryOrder.begin(), m_mainCategoryOrder.end(), category);
     if (it != m_mainCategoryOrder.end() && it != m_mainCategoryOrder.end() - 1) {
         std::swap(*it, *(it + 1));
+        PublishSlotTable();
     }
 }
 
@@ -65,6 +86,7 @@ void ESPRenderOrderManager::MoveSubCategoryUp(ESPMainCategory mainCat, ESPSubCat
     auto it = std::find(subOrder.begin(), subOrder.end(), subCat);
     if (it != subOrder.end() && it != subOrder.begin()) {
         std::swap(*it, *(it - 1));
+        PublishSlotTable();
     }
 }
 
@@ -73,6 +95,7 @@ void ESPRenderOrderManager::MoveSubCategoryDown(ESPMainCategory mainCat, ESPSubC
     auto it = std::find(subOrder.begin(), subOrder.end(), subCat);
     if (it != subOrder.end() && it != subOrder.end() - 1) {
         std::swap(*it, *(it + 1));
+        PublishSlotTable();
     }
 }
 
@@ -96,6 +119,8 @@ void ESPRenderOrderManager::ResetToDefault() {
             m_subCategoryOrders[cat] = {ESPSubCategory::Single};
         }
     }
+
+    PublishSlotTable();
 }
 
 bool ESPRenderOrderManager::ValidateConfiguration() const {
@@ -321,15 +346,28 @@ void ESPRenderOrderManager::DeserializeFromString(const std::string& data) {
         // If any critical error occurs, reset to default
         ResetToDefault();
     }
+
+    PublishSlotTable();
 }
 
 ESPModule::ESPModule() : ModuleBase() {
     m_costFormatsInitialized = false;
     m_pickupCacheInitialized = false;
+    m_entities.SetRetireSink(&m_retiredEntities);
+    m_interactables.SetRetireSink(&m_retiredInteractables);
     Initialize();
 }
 
-ESPModule::~ESPModule() {}
+ESPModule::~ESPModule() {
+    // Free cold records of events that were never applied
+    ESPTrackingEvent event;
+    while (m_trackingEvents.TryPop(event)) {
+        DeleteTrackingRecord(event);
+    }
+    for (const ESPTrackingEvent& spilled : m_trackingOverflow) {
+        DeleteTrackingRecord(spilled);
+    }
+}
 
 void ESPModule::Initialize() {
     teleporterESPControl = std::make_unique<ESPControl>("Teleporter ESP", "teleporter_esp", false, 250.0f, 1000.0f, ImVec4(1.0f, 1.0f, 0.0f, 1.0f)); // Yellow
@@ -345,6 +383,13 @@ void ESPModule::Initialize() {
     itemPickupESPControl = std::make_unique<ChestESPControl>("Item Pickups", "item_pickup_esp");
     portalESPControl = std::make_unique<ChestESPControl>("Portals", "portal_esp");
 
+    visibilityBudgetControl = std::make_unique<IntControl>("Visibility Raycasts / Update", "esp_visibility_raycast_budget", 48, 1, 512, 8, false, false);
+    lodNearDistanceControl = std::make_unique<FloatControl>("LOD Near Distance", "esp_lod_near_distance", 60.0f, 0.0f, FLT_MAX, 5.0f, false, false);
+    lodFarDistanceControl = std::make_unique<FloatControl>("LOD Far Distance", "esp_lod_far_distance", 150.0f, 0.0f, FLT_MAX, 5.0f, false, false);
+    lodMinBoxHeightControl = std::make_unique<IntControl>("LOD Min Box Height (px)", "esp_lod_min_box_height", 16, 0, 200, 1, false, false);
+    lodMidIntervalControl = std::make_unique<IntControl>("LOD Mid Update Interval", "esp_lod_mid_interval", 2, 1, 30, 1, false, false);
+    lodFarIntervalControl = std::make_unique<IntControl>("LOD Far Update Interval", "esp_lod_far_interval", 6, 1, 60, 1, false, false);
+
     // Initialize render order configuration control for persistence
     m_renderOrderConfigControl = std::make_unique<RenderOrderConfigControl>(&m_renderOrderManager);
     ConfigManager::RegisterControl(m_renderOrderConfigControl.get());
@@ -356,6 +401,15 @@ void ESPModule::Initialize() {
     m_renderOrderManager.EnsureValidConfiguration();
 }
 
+std::vector<GameStructId> ESPModule::GetRequiredStructs() const {
+    return {GameStructId::CharacterBody, GameStructId::CharacterMaster, GameStructId::CharacterMotor, GameStructId::HealthComponent,
+            GameStructId::TeamComponent, GameStructId::ModelLocator, GameStructId::HurtBoxGroup, GameStructId::PlayerCharacterMasterController,
+            GameStructId::NetworkUser, GameStructId::PickupDef, GameStructId::TeleporterInteraction, GameStructId::PurchaseInteraction,
+            GameStructId::BarrelInteraction, GameStructId::GenericInteraction, GameStructId::GenericPickupController, GameStructId::PickupPickerController,
+            GameStructId::TimedChestController, GameStructId::PressurePlateController, GameStructId::ShopTerminalBehavior, GameStructId::ChestBehavior,
+            GameStructId::RouletteChestController};
+}
+
 void ESPModule::Update() {
     teleporterESPControl->Update();
     playerESPControl->Update();
@@ -366,28 +420,12 @@ void ESPModule::Update() {
     shrineESPControl->Update();
     specialESPControl->Update();
     barrelESPControl->Update();
-
-    // Clean up consumed item pickups and command cubes
-    {
-        std::lock_guard<std::mutex> lock(interactablesMutex);
-        trackedInteractables.erase(std::remove_if(trackedInteractables.begin(), trackedInteractables.end(),
-                                                  [](const std::unique_ptr<TrackedInteractable>& tracked) {
-                                                      if (tracked->category == InteractableCategory::ItemPickup && tracked->gameObject) {
-                                                          // Check if the pickup has been consumed or recycled
-                                                          GenericPickupController* gpc = static_cast<GenericPickupController*>(tracked->gameObject);
-                                                          if (gpc->Recycled || gpc->consumed) {
-                                                              return true;
-                                                          }
-                                                      } else if (tracked->category == InteractableCategory::CommandCube && tracked->gameObject) {
-                                                          PickupPickerController* ppc = static_cast<PickupPickerController*>(tracked->gameObject);
-                                                          if (!ppc->available_backing) {
-                                                              return true;
-                                                          }
-                                                      }
-                                                      return false;
-                                                  }),
-                                   trackedInteractables.end());
-    }
+    visibilityBudgetControl->Update();
+    lodNearDistanceControl->Update();
+    lodFarDistanceControl->Update();
+    lodMinBoxHeightControl->Update();
+    lodMidIntervalControl->Update();
+    lodFarIntervalControl->Update();
 }
 
 void ESPModule::InitializeCategoryMappings() {
@@ -435,6 +473,19 @@ void ESPModule::DrawUI() {
     if (ImGui::CollapsingHeader("ESP Rendering Order")) {
         DrawRenderOrderUI();
     }
+
+    if (ImGui::CollapsingHeader("Performance")) {
+        visibilityBudgetControl->Draw();
+        ImGui::TextDisabled("Tracked for occlusion: %d", static_cast<int>(m_visibilityCache.GetTrackedCount()));
+
+        ImGui::Separator();
+        ImGui::Text("Level of Detail (Near / Mid / Far):");
+        lodNearDistanceControl->Draw();
+        lodFarDistanceControl->Draw();
+        lodMinBoxHeightControl->Draw();
+        lodMidIntervalControl->Draw();
+        lodFarIntervalControl->Draw();
+    }
 }
 
 void ESPModule::DrawRenderOrderUI() {
@@ -536,126 +587,221 @@ void ESPModule::DrawRenderOrderUI() {
     }
 }
 
-void ESPModule::OnFrameRender() {
-    std::shared_ptr<std::vector<ESPHierarchicalRenderItem>> renderData = std::atomic_load(&collectedItemsBuffer);
-    std::vector<ESPHierarchicalRenderItem> allItems = renderData ? *renderData : std::vector<ESPHierarchicalRenderItem>();
+double ESPModule::GetClockSeconds() {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
 
-    if (allItems.empty())
+void ESPModule::OnFrameRender() {
+    const ESPRenderSnapshot& snapshot = m_renderSnapshots.Acquire();
+    if (snapshot.items.empty() || snapshot.clearGeneration != m_requestedClearGeneration.load(std::memory_order_acquire))
         return;
+    const CachedCameraData& camera = snapshot.camera;
+
+    // Project every item once up front with the frame's camera snapshot, moving entities along their velocity
+    // by the time since they were sampled so boxes don't lag behind when frames outpace game updates
+    double frameTime = GetClockSeconds();
+    size_t count = snapshot.items.size();
+    m_projectWorld.resize(count);
+    m_projectScreen.resize(count);
+    m_projectInFront.resize((count + 31) / 32);
+    for (size_t i = 0; i < count; i++) {
+        const ESPHierarchicalRenderItem& item = snapshot.items[i];
+        m_projectWorld[i] = item.worldPosition;
+        if (item.sampleTime > 0.0) {
+            float ahead = static_cast<float>(std::clamp(frameTime - item.sampleTime, 0.0, MaxExtrapolationSeconds));
+            m_projectWorld[i] = item.worldPosition + item.velocity * ahead;
+        }
+    }
+    RenderUtils::WorldToScreenBatch(camera, m_projectWorld.data(), count, m_projectScreen.data(), m_projectInFront.data());
 
-    std::vector<ESPCategoryInfo> renderOrder = m_renderOrderManager.GetRenderOrder();
+    for (const ESPRenderSpan& span : snapshot.spans) {
+        for (uint32_t i = span.begin; i < span.end; i++) {
+            if (!(m_projectInFront[i / 32] & (1u << (i % 32))))
+                continue;
 
-    // Group items by category and sub-category, then sort by distance within each group
-    for (const auto& categoryInfo : renderOrder) {
-        // Collect items for this specific category/sub-category
-        std::vector<ESPHierarchicalRenderItem> categoryItems;
-        for (const auto& item : allItems) {
-            if (item.mainCategory == categoryInfo.mainCategory && item.subCategory == categoryInfo.subCategory) {
-                categoryItems.push_back(item);
-            }
+            const ImVec2& screenPos = m_projectScreen[i];
+            RenderESPItem(snapshot.items[i], screenPos, RenderUtils::IsOnScreen(camera, screenPos));
         }
+    }
+}
 
-        if (categoryItems.empty())
-            continue;
+ESPLodTier ESPModule::GetLodTier(float distance) const {
+    if (distance < lodNearDistanceControl->GetValue())
+        return ESPLodTier::Near;
+    if (distance < lodFarDistanceControl->GetValue())
+        return ESPLodTier::Mid;
+    return ESPLodTier::Far;
+}
+
+ESPLodTier ESPModule::GetEntityLodTier(TrackedEntity* entity, float distance, const CachedCameraData& camera) const {
+    ESPLodTier tier = GetLodTier(distance);
+    if (!entity->hasLocalBounds || distance < 0.1f)
+        return tier;
+
+    // Approximate on-screen height from the cached model bounds: the length of the view-projection Y row is the
+    // projection's focal scale, and clip w is roughly the distance
+    const float* m = camera.viewProj.m16;
+    float focalY = std::sqrt(m[1] * m[1] + m[5] * m[5] + m[9] * m[9]);
+    float worldHeight = std::max(entity->localBoundsMax.y - entity->localBoundsMin.y, 1.0f);
+    float screenHeight = worldHeight * focalY / distance * camera.halfViewportY;
+
+    // Too small to read details drops to a dot, big bodies (bosses) stay boxed at range
+    float minHeight = static_cast<float>(lodMinBoxHeightControl->GetValue());
+    if (screenHeight < minHeight)
+        return ESPLodTier::Far;
+    if (tier == ESPLodTier::Far && screenHeight >= minHeight * 4.0f)
+        return ESPLodTier::Mid;
+    return tier;
+}
+
+bool ESPModule::ShouldRefreshLod(ESPLodTier tier, uint32_t lastRefreshTick) const {
+    if (lastRefreshTick == 0)
+        return true;
+
+    int interval = 1;
+    if (tier == ESPLodTier::Mid) {
+        interval = lodMidIntervalControl->GetValue();
+    } else if (tier == ESPLodTier::Far) {
+        interval = lodFarIntervalControl->GetValue();
+    }
+    return m_updateTick - lastRefreshTick >= static_cast<uint32_t>(std::max(interval, 1));
+}
+
+// Rotates v by unit quaternion q
+static Vector3 RotateVector(const Quaternion& q, const Vector3& v) {
+    Vector3 u(q.x, q.y, q.z);
+    Vector3 t = u.Cross(v) * 2.0f;
+    return v + t * q.w + u.Cross(t);
+}
+
+static Vector3 InverseRotateVector(const Quaternion& q, const Vector3& v) { return RotateVector(Quaternion{-q.x, -q.y, -q.z, q.w}, v); }
+
+void ESPModule::BuildHurtBoxCache(TrackedEntity* entity) {
+    CharacterBody* body = entity->body;
+    entity->hurtBoxTransforms.clear();
+    entity->hasLocalBounds = false;
+
+    if (!body->hurtBoxGroup_backing || !body->hurtBoxGroup_backing->hurtBoxes) {
+        return;
+    }
 
-        // Sort by distance within this category (far to near for proper depth)
-        std::sort(categoryItems.begin(), categoryItems.end(), [](const ESPHierarchicalRenderItem& a, const ESPHierarchicalRenderItem& b) {
-            return a.distance > b.distance; // Descending order (far to near)
-        });
+    MonoArray_Internal* hurtBoxes = reinterpret_cast<MonoArray_Internal*>(body->hurtBoxGroup_backing->hurtBoxes);
+    uint32_t len = static_cast<uint32_t>(hurtBoxes->max_length);
+    HurtBox** data = mono_array_addr<HurtBox*>(hurtBoxes);
 
-        // Render all items in this category
-        for (const auto& item : categoryItems) {
-            RenderESPItem(item);
+    entity->hurtBoxTransforms.reserve(len);
+    for (uint32_t i = 0; i < len; ++i) {
+        if (!data[i])
+            continue;
+        Transform* hurtBoxTransform = static_cast<Transform*>(Hooks::Component_get_transform(data[i]));
+        if (hurtBoxTransform) {
+            entity->hurtBoxTransforms.push_back(hurtBoxTransform);
         }
     }
+
+    if (entity->hurtBoxTransforms.empty()) {
+        return;
+    }
+
+    // Hurtboxes follow the model root, which is what gets rotated to face the aim direction
+    entity->boundsTransform = nullptr;
+    if (body->modelLocator_backing && body->modelLocator_backing->_modelTransform) {
+        entity->boundsTransform = body->modelLocator_backing->_modelTransform;
+    } else {
+        entity->boundsTransform = body->transform;
+    }
+
+    if (!entity->boundsTransform) {
+        return;
+    }
+
+    Vector3 origin;
+    Quaternion rotation;
+    Hooks::Transform_get_position_Injected(entity->boundsTransform, &origin);
+    Hooks::Transform_get_rotation_Injected(entity->boundsTransform, &rotation);
+
+    Vector3 minBounds(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vector3 maxBounds(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+    for (Transform* hurtBoxTransform : entity->hurtBoxTransforms) {
+        Vector3 hurtBoxPos;
+        Hooks::Transform_get_position_Injected(hurtBoxTransform, &hurtBoxPos);
+
+        Vector3 local = InverseRotateVector(rotation, hurtBoxPos - origin);
+        minBounds.x = std::min(minBounds.x, local.x);
+        minBounds.y = std::min(minBounds.y, local.y);
+        minBounds.z = std::min(minBounds.z, local.z);
+        maxBounds.x = std::max(maxBounds.x, local.x);
+        maxBounds.y = std::max(maxBounds.y, local.y);
+        maxBounds.z = std::max(maxBounds.z, local.z);
+    }
+
+    entity->localBoundsMin = minBounds;
+    entity->localBoundsMax = maxBounds;
+    entity->hasLocalBounds = true;
 }
 
-bool ESPModule::CalcEntityBounds(TrackedEntity* entity, ImVec2& outMin, ImVec2& outMax) {
-    if (entity->nameToken == "JELLYFISH_BODY_NAME") {
+bool ESPModule::CalcEntityBounds(TrackedEntity* entity, const CachedCameraData& camera, ImVec2& outMin, ImVec2& outMax) {
+    // Bodies whose hurtboxes weren't set up yet at Start get another try here
+    if (!entity->hasLocalBounds) {
+        BuildHurtBoxCache(entity);
+        if (!entity->hasLocalBounds) {
+            return false;
+        }
+    }
+
+    Vector3 origin;
+    Quaternion rotation;
+    Hooks::Transform_get_position_Injected(entity->boundsTransform, &origin);
+    Hooks::Transform_get_rotation_Injected(entity->boundsTransform, &rotation);
+
+    const Vector3& minBounds = entity->localBoundsMin;
+    const Vector3& maxBounds = entity->localBoundsMax;
+    Vector3 corners[8] = {Vector3(minBounds.x, minBounds.y, minBounds.z), Vector3(maxBounds.x, minBounds.y, minBounds.z),
+                          Vector3(minBounds.x, maxBounds.y, minBounds.z), Vector3(maxBounds.x, maxBounds.y, minBounds.z),
+                          Vector3(minBounds.x, minBounds.y, maxBounds.z), Vector3(maxBounds.x, minBounds.y, maxBounds.z),
+                          Vector3(minBounds.x, maxBounds.y, maxBounds.z), Vector3(maxBounds.x, maxBounds.y, maxBounds.z)};
+    for (Vector3& corner : corners) {
+        corner = origin + RotateVector(rotation, corner);
+    }
+
+    ImVec2 cornersScreen[8];
+    uint32_t inFront = RenderUtils::WorldToScreen4(camera, &corners[0], &cornersScreen[0]);
+    inFront |= RenderUtils::WorldToScreen4(camera, &corners[4], &cornersScreen[4]) << 4;
+
+    if (!inFront) {
         return false;
     }
 
     ImVec2 screenMin(FLT_MAX, FLT_MAX);
     ImVec2 screenMax(-FLT_MAX, -FLT_MAX);
-    bool boundsFound = false;
-
-    if (entity->body->hurtBoxGroup_backing && entity->body->hurtBoxGroup_backing->hurtBoxes) {
-        Vector3 minBounds(FLT_MAX, FLT_MAX, FLT_MAX);
-        Vector3 maxBounds(-FLT_MAX, -FLT_MAX, -FLT_MAX);
-
-        uint32_t len = static_cast<uint32_t>((reinterpret_cast<MonoArray_Internal*>(entity->body->hurtBoxGroup_backing->hurtBoxes))->max_length);
-        HurtBox** data = mono_array_addr<HurtBox*>(reinterpret_cast<MonoArray_Internal*>(entity->body->hurtBoxGroup_backing->hurtBoxes));
-
-        for (uint32_t i = 0; i < len; ++i) {
-            HurtBox* hurtBox = data[i];
-            if (hurtBox) {
-                Transform* hurtBoxTransform = static_cast<Transform*>(Hooks::Component_get_transform(hurtBox));
-
-                if (hurtBoxTransform) {
-                    Vector3 hurtBoxPos;
-                    Hooks::Transform_get_position_Injected(hurtBoxTransform, &hurtBoxPos);
-
-                    if (!boundsFound) {
-                        minBounds = hurtBoxPos;
-                        maxBounds = hurtBoxPos;
-                        boundsFound = true;
-                    } else {
-                        minBounds.x = std::min(minBounds.x, hurtBoxPos.x);
-                        minBounds.y = std::min(minBounds.y, hurtBoxPos.y);
-                        minBounds.z = std::min(minBounds.z, hurtBoxPos.z);
-                        maxBounds.x = std::max(maxBounds.x, hurtBoxPos.x);
-                        maxBounds.y = std::max(maxBounds.y, hurtBoxPos.y);
-                        maxBounds.z = std::max(maxBounds.z, hurtBoxPos.z);
-                    }
-                }
-            }
-        }
-
-        if (boundsFound) {
-            Vector3 corners[8] = {Vector3(minBounds.x, minBounds.y, minBounds.z), Vector3(maxBounds.x, minBounds.y, minBounds.z),
-                                  Vector3(minBounds.x, maxBounds.y, minBounds.z), Vector3(maxBounds.x, maxBounds.y, minBounds.z),
-                                  Vector3(minBounds.x, minBounds.y, maxBounds.z), Vector3(maxBounds.x, minBounds.y, maxBounds.z),
-                                  Vector3(minBounds.x, maxBounds.y, maxBounds.z), Vector3(maxBounds.x, maxBounds.y, maxBounds.z)};
-
-            int visibleCorners = 0;
-
-            for (int i = 0; i < 8; i++) {
-                ImVec2 cornerScreen;
-                if (RenderUtils::WorldToScreen(cameraCache, corners[i], cornerScreen)) {
-                    if (visibleCorners == 0) {
-                        screenMin = cornerScreen;
-                        screenMax = cornerScreen;
-                    } else {
-                        screenMin.x = std::min(screenMin.x, cornerScreen.x);
-                        screenMin.y = std::min(screenMin.y, cornerScreen.y);
-                        screenMax.x = std::max(screenMax.x, cornerScreen.x);
-                        screenMax.y = std::max(screenMax.y, cornerScreen.y);
-                    }
-                    visibleCorners++;
-                }
-            }
-
-            if (visibleCorners == 0) {
-                boundsFound = false;
-            }
+    for (int i = 0; i < 8; i++) {
+        if (inFront & (1u << i)) {
+            const ImVec2& cornerScreen = cornersScreen[i];
+            screenMin.x = std::min(screenMin.x, cornerScreen.x);
+            screenMin.y = std::min(screenMin.y, cornerScreen.y);
+            screenMax.x = std::max(screenMax.x, cornerScreen.x);
+            screenMax.y = std::max(screenMax.y, cornerScreen.y);
         }
     }
 
     outMin = screenMin;
     outMax = screenMax;
-    return boundsFound;
+    return true;
 }
 
-void ESPModule::CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items) {
+void ESPModule::CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items, const CachedCameraData& camera) {
     if (!G::runInstance || !mainCamera || !G::localPlayer->GetPlayerPosition()) {
         return;
     }
 
     Vector3 localPlayerPos = G::localPlayer->GetPlayerPosition();
+    m_visibilityCache.BeginUpdate();
+    m_updateTick++;
+    double sampleTime = GetClockSeconds();
 
     // Collect teleporter ESP
     if (teleporterESPControl->IsEnabled()) {
-        std::lock_guard<std::mutex> lock(teleportersMutex);
         for (const auto& teleporter : trackedTeleporters) {
             if (!teleporter)
                 continue;
@@ -664,76 +810,132 @@ void ESPModule::CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items
             if (distance > teleporterESPControl->GetDistance())
                 continue;
 
-            bool isVisible = IsVisible(teleporter->position);
+            bool isVisible = IsVisible(teleporter.get(), teleporter->position, distance, camera);
             items.emplace_back(ESPMainCategory::Teleporter, ESPSubCategory::Single, teleporter.get(), teleporter->position, distance, isVisible);
         }
     }
 
-    // Collect player ESP
-    if (playerESPControl->IsMasterEnabled()) {
-        std::lock_guard<std::mutex> lock(entitiesMutex);
-        for (const auto& entity : trackedPlayers) {
-            if (!entity->body || !entity->body->transform || !entity->body->healthComponent_backing)
+    // Collect player and enemy ESP
+    bool playersEnabled = playerESPControl->IsMasterEnabled();
+    bool enemiesEnabled = enemyESPControl->IsMasterEnabled();
+    if (playersEnabled || enemiesEnabled) {
+        CharacterBody* localBody = G::localPlayer->GetLocalPlayerBody();
+
+        for (uint32_t i = 0; i < m_entities.Size(); i++) {
+            ESPMainCategory mainCategory = static_cast<ESPMainCategory>(m_entities.Category(i));
+            bool isPlayer = mainCategory == ESPMainCategory::Players;
+            if (isPlayer ? !playersEnabled : !enemiesEnabled)
                 continue;
-            if (entity->body == G::localPlayer->GetLocalPlayerBody())
+
+            CharacterBody* body = static_cast<CharacterBody*>(m_entities.GetObject(i));
+            if (!body || !body->transform || !body->healthComponent_backing)
+                continue;
+            if (isPlayer && body == localBody)
                 continue;
-            if (entity->body->healthComponent_backing->health <= 0)
+            if (body->healthComponent_backing->health <= 0)
                 continue;
 
-            Vector3 playerWorldPos;
-            Hooks::Transform_get_position_Injected(entity->body->transform, &playerWorldPos);
-            float distance = playerWorldPos.Distance(localPlayerPos);
-            bool isVisible = IsVisible(playerWorldPos);
+            TrackedEntity* entity = m_entities.Cold(i);
+            Vector3& worldPos = m_entities.Position(i);
+
+            // Far entities keep their last position and visibility between refreshes
+            ESPLodTier lodTier = GetEntityLodTier(entity, worldPos.Distance(localPlayerPos), camera);
+            bool refresh = ShouldRefreshLod(lodTier, entity->lodRefreshTick);
+            if (refresh || lodTier != ESPLodTier::Far) {
+                Vector3 previousPos = worldPos;
+                Hooks::Transform_get_position_Injected(body->transform, &worldPos);
+
+                double elapsed = sampleTime - entity->sampleTime;
+                if (entity->sampleTime > 0.0 && elapsed > 0.0001) {
+                    entity->velocity = (worldPos - previousPos) / static_cast<float>(elapsed);
+                    // Teleports and respawns would otherwise fling the box across the screen
+                    if (entity->velocity.LengthSquared() > MaxTrackedSpeed * MaxTrackedSpeed) {
+                        entity->velocity = Vector3();
+                    }
+                }
+                entity->sampleTime = sampleTime;
+            }
+            float distance = worldPos.Distance(localPlayerPos);
+
+            bool isVisible;
+            if (refresh) {
+                entity->lodRefreshTick = m_updateTick;
+                isVisible = IsVisible(entity, worldPos, distance, camera);
+            } else {
+                isVisible = m_visibilityCache.Touch(entity);
+            }
 
-            EntityESPSubControl* control = isVisible ? playerESPControl->GetVisibleControl() : playerESPControl->GetNonVisibleControl();
+            EntityESPControl* entityControl = isPlayer ? playerESPControl.get() : enemyESPControl.get();
+            EntityESPSubControl* control = isVisible ? entityControl->GetVisibleControl() : entityControl->GetNonVisibleControl();
 
             if (!control->IsEnabled() || distance > control->GetMaxDistance())
                 continue;
 
             ImVec2 boundsMin, boundsMax;
-            bool foundBounds = CalcEntityBounds(entity.get(), boundsMin, boundsMax);
+            bool foundBounds = lodTier == ESPLodTier::Near && !(m_entities.Flags(i) & TrackedFlag_NoBounds) &&
+                               CalcEntityBounds(entity, camera, boundsMin, boundsMax);
+
+            // Store the box relative to the anchor so the render thread can move it with the extrapolated position
+            ImVec2 anchor;
+            if (foundBounds && RenderUtils::WorldToScreen(camera, worldPos, anchor)) {
+                boundsMin = ImVec2(boundsMin.x - anchor.x, boundsMin.y - anchor.y);
+                boundsMax = ImVec2(boundsMax.x - anchor.x, boundsMax.y - anchor.y);
+            } else {
+                foundBounds = false;
+            }
 
             ESPSubCategory subCat = isVisible ? ESPSubCategory::Visible : ESPSubCategory::NonVisible;
-            items.emplace_back(ESPMainCategory::Players, subCat, entity.get(), playerWorldPos, distance, isVisible, foundBounds, boundsMin, boundsMax);
+            items.emplace_back(mainCategory, subCat, entity, worldPos, distance, isVisible, foundBounds, boundsMin, boundsMax);
+            ESPHierarchicalRenderItem& item = items.back();
+            item.lodTier = lodTier;
+            item.velocity = entity->velocity;
+            item.sampleTime = entity->sampleTime;
         }
     }
 
-    // Collect enemy ESP
-    if (enemyESPControl->IsMasterEnabled()) {
-        std::lock_guard<std::mutex> lock(entitiesMutex);
-        for (const auto& entity : trackedEnemies) {
-            if (!entity->body || !entity->body->transform || !entity->body->healthComponent_backing)
-                continue;
-            if (entity->body->healthComponent_backing->health <= 0)
+    // Collect interactable ESP
+    {
+        // Portals move, keep their grid cells current before querying
+        for (uint32_t i = 0; i < m_interactables.Size(); i++) {
+            if (!(m_interactables.Flags(i) & TrackedFlag_DynamicPosition) || !Hooks::Component_get_transform || !Hooks::Transform_get_position_Injected)
                 continue;
 
-            Vector3 enemyWorldPos;
-            Hooks::Transform_get_position_Injected(entity->body->transform, &enemyWorldPos);
-            float distance = enemyWorldPos.Distance(localPlayerPos);
-            bool isVisible = IsVisible(enemyWorldPos);
-
-            EntityESPSubControl* control = isVisible ? enemyESPControl->GetVisibleControl() : enemyESPControl->GetNonVisibleControl();
+            void* transform = Hooks::Component_get_transform(m_interactables.GetObject(i));
+            if (transform) {
+                Vector3& position = m_interactables.Position(i);
+                Hooks::Transform_get_position_Injected(transform, &position);
+                m_interactableGrid.Move(m_interactables.GetHandle(i), position);
+            }
+        }
 
-            if (!control->IsEnabled() || distance > control->GetMaxDistance())
+        // Anything behind the camera is never drawn; off-screen objects in front are only needed for tracelines
+        float maxDistance = 0.0f;
+        bool anyTracelines = false;
+        for (const CategoryMapping& mapping : m_categoryMappings) {
+            if (!mapping.control || !mapping.control->IsMasterEnabled() || !mapping.control->GetSubControl()->IsEnabled())
                 continue;
+            maxDistance = std::max(maxDistance, mapping.control->GetSubControl()->GetMaxDistance());
+            anyTracelines |= mapping.control->GetSubControl()->ShouldShowTraceline();
+        }
 
-            ImVec2 boundsMin, boundsMax;
-            bool foundBounds = CalcEntityBounds(entity.get(), boundsMin, boundsMax);
-
-            ESPSubCategory subCat = isVisible ? ESPSubCategory::Visible : ESPSubCategory::NonVisible;
-            items.emplace_back(ESPMainCategory::Enemies, subCat, entity.get(), enemyWorldPos, distance, isVisible, foundBounds, boundsMin, boundsMax);
+        Plane frustum[5];
+        RenderUtils::ExtractFrustumPlanes(camera, frustum);
+        m_gridCandidates.clear();
+        if (maxDistance > 0.0f) {
+            m_interactableGrid.QueryFrustum(localPlayerPos, maxDistance, frustum, anyTracelines ? 1 : 5, m_gridCandidates);
         }
-    }
 
-    // Collect interactable ESP
-    {
-        std::lock_guard<std::mutex> lock(interactablesMutex);
-        for (const auto& interactable : trackedInteractables) {
-            if (!interactable || !interactable->gameObject)
+        for (SlotHandle handle : m_gridCandidates) {
+            uint32_t i = m_interactables.GetDenseIndex(handle);
+            if (i == UINT32_MAX)
+                continue;
+
+            void* gameObject = m_interactables.GetObject(i);
+            if (!gameObject)
                 continue;
 
             // Map interactable categories to main categories using lookup table
-            int categoryIndex = static_cast<int>(interactable->category);
+            int categoryIndex = m_interactables.Category(i);
             if (categoryIndex < 0 || categoryIndex > static_cast<int>(InteractableCategory::Unknown)) {
                 categoryIndex = static_cast<int>(InteractableCategory::Unknown);
             }
@@ -745,37 +947,29 @@ void ESPModule::CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items
             if (!categoryControl || !categoryControl->IsMasterEnabled())
                 continue;
 
-            // Get current position of portals
-            Vector3 currentPosition = interactable->position;
-            if (interactable->category == InteractableCategory::Portal && interactable->gameObject) {
-                if (Hooks::Component_get_transform && Hooks::Transform_get_position_Injected) {
-                    void* transform = Hooks::Component_get_transform(interactable->gameObject);
-                    if (transform) {
-                        Hooks::Transform_get_position_Injected(transform, &currentPosition);
-                    }
-                }
-            }
-
+            const Vector3& currentPosition = m_interactables.Position(i);
             float distance = currentPosition.Distance(localPlayerPos);
             ChestESPSubControl* control = categoryControl->GetSubControl();
             if (!control->IsEnabled() || distance > control->GetMaxDistance())
                 continue;
 
             // Check availability
+            TrackedInteractable* interactable = m_interactables.Cold(i);
+            InteractableCategory category = static_cast<InteractableCategory>(categoryIndex);
             bool isAvailable = true;
-            if (interactable->category == InteractableCategory::Barrel && interactable->gameObject) {
+            if (category == InteractableCategory::Barrel) {
                 if (interactable->purchaseInteraction) {
                     PurchaseInteraction* pi = static_cast<PurchaseInteraction*>(interactable->purchaseInteraction);
                     isAvailable = pi->available;
                 } else {
-                    BarrelInteraction* barrel = static_cast<BarrelInteraction*>(interactable->gameObject);
+                    BarrelInteraction* barrel = static_cast<BarrelInteraction*>(gameObject);
                     isAvailable = !barrel->opened;
                 }
-            } else if (interactable->category == InteractableCategory::ItemPickup && interactable->gameObject) {
-                GenericPickupController* gpc = static_cast<GenericPickupController*>(interactable->gameObject);
+            } else if (category == InteractableCategory::ItemPickup) {
+                GenericPickupController* gpc = static_cast<GenericPickupController*>(gameObject);
                 isAvailable = !gpc->consumed && !gpc->Recycled;
-            } else if (interactable->category == InteractableCategory::CommandCube) {
-                PickupPickerController* pcc = static_cast<PickupPickerController*>(interactable->gameObject);
+            } else if (category == InteractableCategory::CommandCube) {
+                PickupPickerController* pcc = static_cast<PickupPickerController*>(gameObject);
                 isAvailable = pcc->available_backing;
             } else if (interactable->purchaseInteraction) {
                 PurchaseInteraction* pi = static_cast<PurchaseInteraction*>(interactable->purchaseInteraction);
@@ -785,32 +979,111 @@ void ESPModule::CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items
             if (!isAvailable && !control->ShouldShowUnavailable())
                 continue;
 
-            bool isVisible = IsVisible(currentPosition);
-            items.emplace_back(mainCategory, ESPSubCategory::Single, interactable.get(), currentPosition, distance, isVisible, isAvailable);
+            ESPLodTier lodTier = GetLodTier(distance);
+            bool isVisible;
+            if (ShouldRefreshLod(lodTier, interactable->lodRefreshTick)) {
+                interactable->lodRefreshTick = m_updateTick;
+                isVisible = IsVisible(interactable, currentPosition, distance, camera);
+            } else {
+                isVisible = m_visibilityCache.Touch(interactable);
+            }
+
+            items.emplace_back(mainCategory, ESPSubCategory::Single, interactable, currentPosition, distance, isVisible, isAvailable);
+            items.back().lodTier = lodTier;
+        }
+    }
+
+    // Results of this update's raycasts are picked up by the next collection pass
+    m_visibilityCache.EndUpdate(visibilityBudgetControl->GetValue());
+}
+
+// LSD radix sort on the low 24 bits of the key (8 bits per pass), stable so equal keys keep collection order
+static void RadixSortKeys(std::vector<ESPRenderSortKey>& keys, std::vector<ESPRenderSortKey>& scratch) {
+    scratch.resize(keys.size());
+
+    for (uint32_t shift = 0; shift < 24; shift += 8) {
+        uint32_t counts[256] = {};
+        for (const auto& entry : keys) {
+            counts[(entry.key >> shift) & 0xFF]++;
+        }
+
+        // Every key shares this byte, nothing to reorder
+        if (counts[(keys[0].key >> shift) & 0xFF] == keys.size()) {
+            continue;
+        }
+
+        uint32_t offset = 0;
+        for (uint32_t& count : counts) {
+            uint32_t bucketSize = count;
+            count = offset;
+            offset += bucketSize;
+        }
+
+        for (const auto& entry : keys) {
+            scratch[counts[(entry.key >> shift) & 0xFF]++] = entry;
         }
+        keys.swap(scratch);
     }
 }
 
-void ESPModule::RenderESPItem(const ESPHierarchicalRenderItem& item) {
+void ESPModule::BuildRenderSnapshot(const std::vector<ESPHierarchicalRenderItem>& items, ESPRenderSnapshot& snapshot) {
+    snapshot.items.clear();
+    snapshot.spans.clear();
+
+    std::shared_ptr<const ESPRenderSlotTable> slotTable = m_renderOrderManager.GetSlotTable();
+    if (!slotTable || items.empty()) {
+        return;
+    }
+
+    // Key = render slot in the high bits, inverted distance in the low 16 bits so each slot sorts far to near.
+    // Distances are quantised to 1/16 m and clamp at ~4 km, which is well past any ESP max distance.
+    m_sortKeys.clear();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(items.size()); i++) {
+        const ESPHierarchicalRenderItem& item = items[i];
+        int8_t slot = slotTable->slots[static_cast<int>(item.mainCategory)][static_cast<int>(item.subCategory)];
+        if (slot < 0)
+            continue;
+
+        uint32_t quantizedDistance = static_cast<uint32_t>(std::clamp(item.distance * 16.0f, 0.0f, 65535.0f));
+        m_sortKeys.push_back({(static_cast<uint32_t>(slot) << 16) | (0xFFFFu - quantizedDistance), i});
+    }
+
+    if (m_sortKeys.empty()) {
+        return;
+    }
+
+    RadixSortKeys(m_sortKeys, m_sortScratch);
+
+    snapshot.items.reserve(m_sortKeys.size());
+    uint32_t currentSlot = UINT32_MAX;
+    for (const ESPRenderSortKey& sortKey : m_sortKeys) {
+        uint32_t slot = sortKey.key >> 16;
+        if (slot != currentSlot) {
+            uint32_t begin = static_cast<uint32_t>(snapshot.items.size());
+            snapshot.spans.push_back({slotTable->slotMainCategory[slot], slotTable->slotSubCategory[slot], begin, begin});
+            currentSlot = slot;
+        }
+        snapshot.items.push_back(items[sortKey.index]);
+        snapshot.spans.back().end++;
+    }
+}
+
+void ESPModule::RenderESPItem(const ESPHierarchicalRenderItem& item, ImVec2 screenPos, bool onScreen) {
     // Render based on category type
     if (item.mainCategory == ESPMainCategory::Teleporter) {
         // Render teleporter
         if (!item.teleporterData || !G::localPlayer->GetPlayerPosition())
             return;
 
-        ImVec2 screenPos;
-        bool onScreen = false;
-        if (!RenderUtils::WorldToScreen(cameraCache, item.worldPosition, screenPos, onScreen))
-            return;
-
         TrackedTeleporter* teleporter = static_cast<TrackedTeleporter*>(item.teleporterData);
-        const char* baseName = teleporter->displayName.empty() ? "Teleporter" : teleporter->displayName.c_str();
-
-        char teleporterText[256];
-        snprintf(teleporterText, sizeof(teleporterText), "%s (%dm)", baseName, static_cast<int>(item.distance));
+        int meters = static_cast<int>(item.distance);
+        if (teleporter->label.Changed(meters)) {
+            const char* baseName = teleporter->displayName.empty() ? "Teleporter" : teleporter->displayName.c_str();
+            RenderUtils::SetLabelText(teleporter->label, "%s (%dm)", baseName, meters);
+        }
 
-        RenderUtils::RenderText(screenPos, teleporterESPControl->GetColorU32(), teleporterESPControl->GetOutlineColorU32(),
-                                teleporterESPControl->IsOutlineEnabled(), true, "%s", teleporterText);
+        RenderUtils::RenderLabel(screenPos, teleporterESPControl->GetColorU32(), teleporterESPControl->GetOutlineColorU32(),
+                                 teleporterESPControl->IsOutlineEnabled(), true, teleporter->label);
 
     } else if (item.mainCategory == ESPMainCategory::Players || item.mainCategory == ESPMainCategory::Enemies) {
         // Render entity
@@ -818,12 +1091,9 @@ void ESPModule::RenderESPItem(const ESPHierarchicalRenderItem& item) {
 
         EntityESPSubControl* subControl = item.isVisible ? control->GetVisibleControl() : control->GetNonVisibleControl();
 
-        ImVec2 screenPos;
-        bool onScreen = false;
-        if (!RenderUtils::WorldToScreen(cameraCache, item.worldPosition, screenPos, onScreen))
-            return;
-
-        RenderEntityESP(item.entity, screenPos, item.distance, subControl, item.isVisible, onScreen, item.foundBounds, item.boundsMin, item.boundsMax);
+        ImVec2 boundsMin(screenPos.x + item.boundsMin.x, screenPos.y + item.boundsMin.y);
+        ImVec2 boundsMax(screenPos.x + item.boundsMax.x, screenPos.y + item.boundsMax.y);
+        RenderEntityESP(item.entity, screenPos, item.distance, subControl, item.isVisible, onScreen, item.foundBounds, boundsMin, boundsMax, item.lodTier);
 
     } else {
         // Render interactable using lookup table
@@ -842,11 +1112,7 @@ void ESPModule::RenderESPItem(const ESPHierarchicalRenderItem& item) {
 
         if (categoryControl) {
             ChestESPSubControl* control = categoryControl->GetSubControl();
-            ImVec2 screenPos;
-            bool onScreen = false;
-            if (!RenderUtils::WorldToScreen(cameraCache, item.worldPosition, screenPos, onScreen))
-                return;
-            RenderInteractableESP(item.interactable, screenPos, item.distance, control, item.isVisible, onScreen, item.isAvailable);
+            RenderInteractableESP(item.interactable, *item.text, screenPos, item.distance, control, item.isVisible, onScreen, item.isAvailable, item.lodTier);
         }
     }
 }
@@ -857,20 +1123,21 @@ void ESPModule::OnGameUpdate() {
         LOG_ERROR("Camera_get_main returned null");
     }
 
-    std::shared_ptr<CachedCameraData> newCache = std::make_shared<CachedCameraData>();
-    RenderUtils::PrecomputeViewProjection(mainCamera, newCache.get());
-    std::shared_ptr<CachedCameraData> curCache = std::atomic_load(&cameraCache);
-    while (!std::atomic_compare_exchange_weak(&cameraCache, &curCache, newCache)) {
-    }
+    // Camera and items are built straight into the free triple buffer slot, reusing its storage
+    ESPRenderSnapshot& snapshot = m_renderSnapshots.GetWriteBuffer();
+    RenderUtils::PrecomputeViewProjection(mainCamera, &snapshot.camera);
 
+    ApplyTrackingEvents();
+    RemoveConsumedPickups();
     UpdateShrineCosts();
 
-    std::shared_ptr<std::vector<ESPHierarchicalRenderItem>> curBuffer = std::atomic_load(&collectedItemsBuffer);
-    std::shared_ptr<std::vector<ESPHierarchicalRenderItem>> newBuffer = std::make_shared<std::vector<ESPHierarchicalRenderItem>>();
-    CollectAllESPItems(*newBuffer);
+    m_collectScratch.clear();
+    CollectAllESPItems(m_collectScratch, snapshot.camera);
 
-    while (!std::atomic_compare_exchange_weak(&collectedItemsBuffer, &curBuffer, newBuffer)) {
-    }
+    BuildRenderSnapshot(m_collectScratch, snapshot);
+    snapshot.clearGeneration = m_appliedClearGeneration;
+    ReleaseRetiredRecords();
+    m_renderSnapshots.Publish();
 }
 
 void ESPModule::OnTeleporterAwake(void* teleporter) {
@@ -884,15 +1151,18 @@ void ESPModule::OnTeleporterAwake(void* teleporter) {
     Vector3 position = {0, 0, 0};
     Hooks::Transform_get_position_Injected(teleporter_ptr->teleporterPositionIndicator->targetTransform, &position);
 
-    std::string displayName = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("TELEPORTER_NAME"));
+    std::string displayName(G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("TELEPORTER_NAME")));
 
     auto trackedTeleporter = std::make_unique<TrackedTeleporter>();
     trackedTeleporter->teleporterInteraction = teleporter;
     trackedTeleporter->position = position;
     trackedTeleporter->displayName = displayName;
 
-    std::lock_guard<std::mutex> lock(teleportersMutex);
-    trackedTeleporters.push_back(std::move(trackedTeleporter));
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::AddTeleporter;
+    event.object = teleporter;
+    event.record = trackedTeleporter.release();
+    PushTrackingEvent(event);
 
     LOG_INFO("Tracked new teleporter at position (%.1f, %.1f, %.1f)", position.x, position.y, position.z);
 }
@@ -901,11 +1171,10 @@ void ESPModule::OnTeleporterDestroyed(void* teleporter) {
     if (!teleporter)
         return;
 
-    std::lock_guard<std::mutex> lock(teleportersMutex);
-    trackedTeleporters.erase(
-        std::remove_if(trackedTeleporters.begin(), trackedTeleporters.end(),
-                       [teleporter](const std::unique_ptr<TrackedTeleporter>& tracked) { return tracked->teleporterInteraction == teleporter; }),
-        trackedTeleporters.end());
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::RemoveTeleporter;
+    event.object = teleporter;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnTeleporterFixedUpdate(void* teleporter) {
@@ -916,21 +1185,14 @@ void ESPModule::OnTeleporterFixedUpdate(void* teleporter) {
     if (!teleporter_ptr || !teleporter_ptr->teleporterPositionIndicator)
         return;
 
-    std::lock_guard<std::mutex> lock(teleportersMutex);
-
-    // Find the tracked teleporter and update its position
-    for (auto& tracked : trackedTeleporters) {
-        if (tracked->teleporterInteraction == teleporter) {
-            Vector3 newPosition = {0, 0, 0};
-            Hooks::Transform_get_position_Injected(teleporter_ptr->teleporterPositionIndicator->targetTransform, &newPosition);
-            tracked->position = newPosition;
-            break;
-        }
-    }
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::MoveTeleporter;
+    event.object = teleporter;
+    Hooks::Transform_get_position_Injected(teleporter_ptr->teleporterPositionIndicator->targetTransform, &event.position);
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnCharacterBodySpawned(void* characterBody) {
-    std::lock_guard<std::mutex> lock(entitiesMutex);
     CharacterBody* body = static_cast<CharacterBody*>(characterBody);
 
     if (!body)
@@ -956,40 +1218,64 @@ void ESPModule::OnCharacterBodySpawned(void* characterBody) {
         }
     }
 
+    uint8_t flags = TrackedFlag_None;
+    if (newEntity->nameToken == "JELLYFISH_BODY_NAME") {
+        flags |= TrackedFlag_NoBounds;
+    } else {
+        BuildHurtBoxCache(newEntity.get());
+    }
+
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::AddEntity;
+    event.object = body;
+    event.flags = flags;
+
     // Categorize by team
     switch (teamIndex) {
     case TeamIndex_Value::Monster:
     case TeamIndex_Value::Lunar:
     case TeamIndex_Value::Void:
-        trackedEnemies.push_back(std::move(newEntity));
+        event.category = static_cast<uint8_t>(ESPMainCategory::Enemies);
         break;
     case TeamIndex_Value::Player:
-        trackedPlayers.push_back(std::move(newEntity));
+        event.category = static_cast<uint8_t>(ESPMainCategory::Players);
         break;
 
     default:
-        break;
+        return;
     }
+
+    event.record = newEntity.release();
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnCharacterBodyDestroyed(void* characterBody) {
-    std::lock_guard<std::mutex> lock(entitiesMutex);
-    CharacterBody* body = static_cast<CharacterBody*>(characterBody);
-
-    trackedEnemies.erase(
-        std::remove_if(trackedEnemies.begin(), trackedEnemies.end(), [body](const std::unique_ptr<TrackedEntity>& enemy) { return enemy->body == body; }),
-        trackedEnemies.end());
-
-    trackedPlayers.erase(
-        std::remove_if(trackedPlayers.begin(), trackedPlayers.end(), [body](const std::unique_ptr<TrackedEntity>& player) { return player->body == body; }),
-        trackedPlayers.end());
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::RemoveEntity;
+    event.object = characterBody;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::RenderEntityESP(TrackedEntity* entity, ImVec2 screenPos, float distance, EntityESPSubControl* control, bool isVisible, bool onScreen,
-                                bool hasBounds, ImVec2 screenMin, ImVec2 screenMax) {
+                                bool hasBounds, ImVec2 screenMin, ImVec2 screenMax, ESPLodTier lodTier) {
     if (!entity || !control)
         return;
 
+    // Far tier: dot and name only
+    if (lodTier == ESPLodTier::Far) {
+        if (!onScreen)
+            return;
+
+        RenderUtils::RenderDot(screenPos, 3.0f, control->GetBoxColorU32());
+        if (control->ShouldShowName() && !entity->displayName.empty()) {
+            if (entity->nameLabel.Changed(0)) {
+                RenderUtils::SetLabelText(entity->nameLabel, "%s", entity->displayName.c_str());
+            }
+            RenderUtils::RenderLabel(ImVec2(screenPos.x, screenPos.y + 5), control->GetNameColorU32(), IM_COL32(0, 0, 0, 255), true, true, entity->nameLabel);
+        }
+        return;
+    }
+
     // If off-screen, only draw traceline and return
     if (!onScreen) {
         if (control->ShouldShowTraceline()) {
@@ -1039,58 +1325,60 @@ void ESPModule::RenderEntityESP(TrackedEntity* entity, ImVec2 screenPos, float d
     }
 
     if (control->ShouldShowName() && !entity->displayName.empty()) {
-        RenderUtils::RenderText(textPos, control->GetNameColorU32(), IM_COL32(0, 0, 0, 255), true, true, "%s", entity->displayName.c_str());
+        if (entity->nameLabel.Changed(0)) {
+            RenderUtils::SetLabelText(entity->nameLabel, "%s", entity->displayName.c_str());
+        }
+        RenderUtils::RenderLabel(textPos, control->GetNameColorU32(), IM_COL32(0, 0, 0, 255), true, true, entity->nameLabel);
         textPos.y += lineHeight;
     }
 
     if (entity->body->healthComponent_backing) {
         bool showHealth = control->ShouldShowHealth();
         bool showMaxHealth = control->ShouldShowMaxHealth();
+        int health = static_cast<int>(entity->body->healthComponent_backing->health);
+        int maxHealth = static_cast<int>(entity->body->maxHealth_backing);
+
+        if (showHealth && entity->healthLabel.Changed(health)) {
+            RenderUtils::SetLabelText(entity->healthLabel, "HP: %d", health);
+        }
+        // Max health is shown as "/max" next to the health part, or on its own line
+        if (showMaxHealth && entity->maxHealthLabel.Changed(maxHealth, showHealth)) {
+            RenderUtils::SetLabelText(entity->maxHealthLabel, showHealth ? "/%d" : "Max HP: %d", maxHealth);
+        }
 
         if (showHealth && showMaxHealth) {
-            char healthPart[64];
-            char maxHealthPart[32];
-            snprintf(healthPart, sizeof(healthPart), "HP: %d", static_cast<int>(entity->body->healthComponent_backing->health));
-            snprintf(maxHealthPart, sizeof(maxHealthPart), "/%d", static_cast<int>(entity->body->maxHealth_backing));
-
-            ImFont* font = FontManager::GetESPFont();
-            float scale = FontManager::ESPFontSize / font->FontSize;
-            ImVec2 healthPartSize = ImGui::CalcTextSize(healthPart);
-            ImVec2 maxHealthPartSize = ImGui::CalcTextSize(maxHealthPart);
-            healthPartSize.x *= scale;
-            maxHealthPartSize.x *= scale;
+            ImVec2 healthPartSize = RenderUtils::MeasureLabel(entity->healthLabel);
+            ImVec2 maxHealthPartSize = RenderUtils::MeasureLabel(entity->maxHealthLabel);
             float totalWidth = healthPartSize.x + maxHealthPartSize.x;
 
             // Render health part (left side, adjusted for centering)
             ImVec2 healthPartPos = ImVec2(textPos.x - totalWidth / 2, textPos.y);
-            RenderUtils::RenderText(healthPartPos, control->GetHealthColorU32(), IM_COL32(0, 0, 0, 255), true, false, healthPart);
+            RenderUtils::RenderLabel(healthPartPos, control->GetHealthColorU32(), IM_COL32(0, 0, 0, 255), true, false, entity->healthLabel);
 
             // Render max health part (right side)
             ImVec2 maxHealthPartPos = ImVec2(healthPartPos.x + healthPartSize.x, textPos.y);
-            RenderUtils::RenderText(maxHealthPartPos, control->GetMaxHealthColorU32(), IM_COL32(0, 0, 0, 255), true, false, maxHealthPart);
+            RenderUtils::RenderLabel(maxHealthPartPos, control->GetMaxHealthColorU32(), IM_COL32(0, 0, 0, 255), true, false, entity->maxHealthLabel);
 
             textPos.y += lineHeight;
         } else if (showHealth) {
-            char healthText[64];
-            snprintf(healthText, sizeof(healthText), "HP: %d", static_cast<int>(entity->body->healthComponent_backing->health));
-            RenderUtils::RenderText(textPos, control->GetHealthColorU32(), IM_COL32(0, 0, 0, 255), true, true, healthText);
+            RenderUtils::RenderLabel(textPos, control->GetHealthColorU32(), IM_COL32(0, 0, 0, 255), true, true, entity->healthLabel);
             textPos.y += lineHeight;
         } else if (showMaxHealth) {
-            char maxHealthText[64];
-            snprintf(maxHealthText, sizeof(maxHealthText), "Max HP: %d", static_cast<int>(entity->body->maxHealth_backing));
-            RenderUtils::RenderText(textPos, control->GetMaxHealthColorU32(), IM_COL32(0, 0, 0, 255), true, true, maxHealthText);
+            RenderUtils::RenderLabel(textPos, control->GetMaxHealthColorU32(), IM_COL32(0, 0, 0, 255), true, true, entity->maxHealthLabel);
             textPos.y += lineHeight;
         }
     }
 
     if (control->ShouldShowDistance()) {
-        char distanceText[32];
-        snprintf(distanceText, sizeof(distanceText), "%dm", static_cast<int>(distance));
-        RenderUtils::RenderText(textPos, control->GetDistanceColorU32(), IM_COL32(0, 0, 0, 255), true, true, distanceText);
+        int meters = static_cast<int>(distance);
+        if (entity->distanceLabel.Changed(meters)) {
+            RenderUtils::SetLabelText(entity->distanceLabel, "%dm", meters);
+        }
+        RenderUtils::RenderLabel(textPos, control->GetDistanceColorU32(), IM_COL32(0, 0, 0, 255), true, true, entity->distanceLabel);
         textPos.y += lineHeight;
     }
 
-    if (control->ShouldShowHealthbar() && entity->body->healthComponent_backing) {
+    if (control->ShouldShowHealthbar() && lodTier == ESPLodTier::Near && entity->body->healthComponent_backing) {
         ImVec2 healthbarPos(screenMin.x - 8, screenMin.y - boxBorderThickness / 2);
         ImVec2 healthbarSize(8, boxSize.y + boxBorderThickness);
         float health = entity->body->healthComponent_backing->health;
@@ -1105,122 +1393,122 @@ void ESPModule::RenderEntityESP(TrackedEntity* entity, ImVec2 screenPos, float d
     }
 }
 
-Vector3 ESPModule::GetCameraPosition() {
-    Camera* camera = Hooks::Camera_get_main();
-    if (!camera || !Hooks::Component_get_transform) {
-        return Vector3{0, 0, 0};
-    }
-
-    void* transform = Hooks::Component_get_transform(static_cast<void*>(camera));
-    if (!transform) {
-        return Vector3{0, 0, 0};
-    }
-
-    Vector3 position;
-    Hooks::Transform_get_position_Injected(transform, &position);
-    return position;
+bool ESPModule::IsVisible(const void* key, const Vector3& position, float distance, const CachedCameraData& camera) {
+    ImVec2 screenPos;
+    bool onScreen = false;
+    RenderUtils::WorldToScreen(camera, position, screenPos, onScreen);
+    return m_visibilityCache.Query(key, position, distance, onScreen);
 }
 
-bool ESPModule::IsVisible(const Vector3& position) {
-    if (!Hooks::Physics_get_defaultPhysicsScene_Injected || !Hooks::PhysicsScene_Internal_Raycast_Injected) {
-        return true;
-    }
+// Substring patterns of the language-independent name tokens, matched in one pass by a compile-time automaton
+static constexpr std::array<std::string_view, 37> InteractableTokenPatterns = {
+    // Shops
+    "SHRINE_CLEANSE_", "DUPLICATOR_", "MULTISHOP_TERMINAL_", "BAZAAR_CAULDRON_", "SCRAPPER_",
+    // Shrines
+    "SHRINE_",
+    // Drones
+    "DRONE_", "TURRET1_",
+    // Portals
+    "PORTAL_", "PORTAL_DIALER",
+    // Chests - CHEST covers all variants (LUNAR_CHEST_, TIMEDCHEST_, etc.)
+    "CHEST", "LOCKBOX", "SCAVBACKPACK_",
+    // Barrels
+    "BARREL",
+    // Special interactables
+    "NEWT_STATUE_",               // Newt Altar
+    "MOON_BATTERY_",              // Pillars
+    "FROG_", "BAZAAR_SEER_",      // Lunar Seer
+    "TELEPORTER_", "GOLDTOTEM_",  // Halcyon Beacon
+    "MSOBELISK_",                 // Obelisk
+    "DEEPVOIDBATTERY_",           // Deep Void Signal
+    "NULL_WARD_",                 // Cell Vent
+    "RADIOTOWER_",                // Radio Scanner
+    "FAN_", "LOCKEDTREEBOT_",     // Broken Robot
+    "PORTAL_DIALER_",             // Compound Generator
+    "ARTIFACT_TRIAL_",            // Artifact Reliquary
+    "LUNAR_TERMINAL_",            // Lunar Buds
+    "LUNAR_REROLL_",              // Lunar Shop Refresher
+    "LOCKEDMAGE_",                // Survivor Suspended In Time
+    "ZIPLINE_",                   // Quantum Tunnel
+    "VENDING_MACHINE_", "GEODE_", // Aurelionite Geode
+    "INFINITE_TOWER_SAFE_WARD_",  // Assessment Focus (Simulacrum)
+    "VOID_SUPPRESSOR_",           // Void Suppressor
+    "VOID_TRIPLE_",               // Void Potential
+};
+
+static constexpr size_t CountTrieStates(const std::array<std::string_view, InteractableTokenPatterns.size()>& patterns) {
+    size_t states = 1;
+    for (std::string_view pattern : patterns) {
+        states += pattern.size();
+    }
+    return states;
+}
 
-    Vector3 cameraPos = GetCameraPosition();
-    Vector3 direction = position - cameraPos;
-    float distance = direction.Length();
+static constexpr TokenMatcher<InteractableTokenPatterns.size(), CountTrieStates(InteractableTokenPatterns)> InteractableTokenMatcher(InteractableTokenPatterns);
 
-    if (distance < 0.1f) {
-        return true;
+static constexpr uint64_t TokenPatternMask(std::initializer_list<std::string_view> names) {
+    uint64_t mask = 0;
+    for (std::string_view name : names) {
+        for (size_t i = 0; i < InteractableTokenPatterns.size(); i++) {
+            if (InteractableTokenPatterns[i] == name) {
+                mask |= uint64_t(1) << i;
+            }
+        }
     }
-
-    direction.Normalize();
-
-    PhysicsScene_Value defaultScene = {};
-    Hooks::Physics_get_defaultPhysicsScene_Injected(&defaultScene);
-
-    Ray_Value ray;
-    ray.m_Origin = cameraPos;
-    ray.m_Direction = direction;
-
-    RaycastHit_Value hitInfo = {};
-
-    int32_t layerMask = 0;
-    if (G::worldLayer >= 0)
-        layerMask |= (1 << G::worldLayer);
-    if (G::ignoreRaycastLayer >= 0)
-        layerMask |= (1 << G::ignoreRaycastLayer);
-
-    bool hitSomething =
-        Hooks::PhysicsScene_Internal_Raycast_Injected(&defaultScene, &ray, distance - 1.0f, &hitInfo, layerMask, QueryTriggerInteraction_Value::UseGlobal);
-
-    return !hitSomething;
+    return mask;
 }
 
-InteractableCategory ESPModule::DetermineInteractableCategory(PurchaseInteraction* pi, MonoString* nameToken) {
-    // Check for shrines first
-    if (pi->isShrine || pi->isGoldShrine) {
-        return InteractableCategory::Shrine;
-    }
-
-    std::string token = "";
-    if (nameToken) {
-        token = G::g_monoRuntime->StringToUtf8(nameToken);
+// Evaluated in order, the first rule with a required pattern present and no excluded pattern present wins
+struct InteractableTokenRule {
+    uint64_t required;
+    uint64_t excluded;
+    InteractableCategory category;
+};
+
+static constexpr InteractableTokenRule InteractableTokenRules[] = {
+    {TokenPatternMask({"SHRINE_CLEANSE_", "DUPLICATOR_", "MULTISHOP_TERMINAL_", "BAZAAR_CAULDRON_", "SCRAPPER_"}), 0, InteractableCategory::Shop},
+    {TokenPatternMask({"SHRINE_"}), 0, InteractableCategory::Shrine},
+    {TokenPatternMask({"DRONE_", "TURRET1_"}), 0, InteractableCategory::Drone},
+    {TokenPatternMask({"PORTAL_"}), TokenPatternMask({"PORTAL_DIALER"}), InteractableCategory::Portal},
+    {TokenPatternMask({"CHEST", "LOCKBOX", "SCAVBACKPACK_"}), 0, InteractableCategory::Chest},
+    {TokenPatternMask({"BARREL"}), 0, InteractableCategory::Barrel},
+    {TokenPatternMask({"NEWT_STATUE_", "MOON_BATTERY_", "FROG_", "BAZAAR_SEER_", "TELEPORTER_", "GOLDTOTEM_", "MSOBELISK_", "DEEPVOIDBATTERY_",
+                       "NULL_WARD_", "RADIOTOWER_", "FAN_", "LOCKEDTREEBOT_", "PORTAL_DIALER_", "ARTIFACT_TRIAL_", "LUNAR_TERMINAL_", "LUNAR_REROLL_",
+                       "LOCKEDMAGE_", "ZIPLINE_", "VENDING_MACHINE_", "GEODE_", "INFINITE_TOWER_SAFE_WARD_", "VOID_SUPPRESSOR_", "VOID_TRIPLE_"}),
+     0, InteractableCategory::Special},
+};
+
+static constexpr InteractableCategory ClassifyInteractableToken(std::string_view token) {
+    uint64_t matches = InteractableTokenMatcher.Match(token);
+    for (const InteractableTokenRule& rule : InteractableTokenRules) {
+        if ((matches & rule.required) && !(matches & rule.excluded)) {
+            return rule.category;
+        }
     }
+    // Everything else is unknown
+    return InteractableCategory::Unknown;
+}
 
-    if (token.find("SHRINE_CLEANSE_") != std::string::npos || // Cleansing Pool
-        token.find("DUPLICATOR_") != std::string::npos ||     // 3D Printer variants
-        token.find("MULTISHOP_TERMINAL_") != std::string::npos || token.find("BAZAAR_CAULDRON_") != std::string::npos ||
-        token.find("SCRAPPER_") != std::string::npos) {
-        return InteractableCategory::Shop;
-    }
+static_assert(ClassifyInteractableToken("SHRINE_CLEANSE_NAME") == InteractableCategory::Shop);
+static_assert(ClassifyInteractableToken("SHRINE_CHANCE_NAME") == InteractableCategory::Shrine);
+static_assert(ClassifyInteractableToken("PORTAL_DIALER_NAME") == InteractableCategory::Special);
+static_assert(ClassifyInteractableToken("LUNAR_CHEST_NAME") == InteractableCategory::Chest);
 
-    if (token.find("SHRINE_") != std::string::npos) {
+InteractableCategory ESPModule::DetermineInteractableCategory(PurchaseInteraction* pi, const std::string& token) {
+    // Check for shrines first
+    if (pi->isShrine || pi->isGoldShrine) {
         return InteractableCategory::Shrine;
     }
 
-    if (token.find("DRONE_") != std::string::npos || token.find("TURRET1_") != std::string::npos) {
-        return InteractableCategory::Drone;
-    }
-
-    if (token.find("PORTAL_") != std::string::npos && token.find("PORTAL_DIALER") == std::string::npos) {
-        return InteractableCategory::Portal;
-    }
-
-    // Chests - CHEST covers all variants (LUNAR_CHEST_, TIMEDCHEST_, etc.)
-    if (token.find("CHEST") != std::string::npos || token.find("LOCKBOX") != std::string::npos || token.find("SCAVBACKPACK_") != std::string::npos) {
-        return InteractableCategory::Chest;
-    }
-
-    if (token.find("BARREL") != std::string::npos) {
-        return InteractableCategory::Barrel;
-    }
-
-    // Special interactables
-    if (token.find("NEWT_STATUE_") != std::string::npos ||                                                  // Newt Altar
-        token.find("MOON_BATTERY_") != std::string::npos ||                                                 // Pillars
-        token.find("FROG_") != std::string::npos || token.find("BAZAAR_SEER_") != std::string::npos ||      // Lunar Seer
-        token.find("TELEPORTER_") != std::string::npos || token.find("GOLDTOTEM_") != std::string::npos ||  // Halcyon Beacon
-        token.find("MSOBELISK_") != std::string::npos ||                                                    // Obelisk
-        token.find("DEEPVOIDBATTERY_") != std::string::npos ||                                              // Deep Void Signal
-        token.find("NULL_WARD_") != std::string::npos ||                                                    // Cell Vent
-        token.find("RADIOTOWER_") != std::string::npos ||                                                   // Radio Scanner
-        token.find("FAN_") != std::string::npos || token.find("LOCKEDTREEBOT_") != std::string::npos ||     // Broken Robot
-        token.find("PORTAL_DIALER_") != std::string::npos ||                                                // Compound Generator
-        token.find("ARTIFACT_TRIAL_") != std::string::npos ||                                               // Artifact Reliquary
-        token.find("LUNAR_TERMINAL_") != std::string::npos ||                                               // Lunar Buds
-        token.find("LUNAR_REROLL_") != std::string::npos ||                                                 // Lunar Shop Refresher
-        token.find("LOCKEDMAGE_") != std::string::npos ||                                                   // Survivor Suspended In Time
-        token.find("ZIPLINE_") != std::string::npos ||                                                      // Quantum Tunnel
-        token.find("VENDING_MACHINE_") != std::string::npos || token.find("GEODE_") != std::string::npos || // Aurelionite Geode
-        token.find("INFINITE_TOWER_SAFE_WARD_") != std::string::npos ||                                     // Assessment Focus (Simulacrum)
-        token.find("VOID_SUPPRESSOR_") != std::string::npos ||                                              // Void Suppressor
-        token.find("VOID_TRIPLE_") != std::string::npos) {                                                  // Void Potential
-        return InteractableCategory::Special;
+    // Stage loads register the same few dozen tokens over and over, so results are kept for the whole session
+    auto it = m_tokenCategoryCache.find(token);
+    if (it != m_tokenCategoryCache.end()) {
+        return it->second;
     }
 
-    // Everything else is unknown
-    return InteractableCategory::Unknown;
+    InteractableCategory category = ClassifyInteractableToken(token);
+    m_tokenCategoryCache.emplace(token, category);
+    return category;
 }
 
 void ESPModule::OnPurchaseInteractionSpawned(void* purchaseInteraction) {
@@ -1239,22 +1527,23 @@ void ESPModule::OnPurchaseInteractionSpawned(void* purchaseInteraction) {
         }
     }
 
-    std::string displayName = G::gameFunctions->Language_GetString(static_cast<MonoString*>(pi->displayNameToken));
+    std::string displayName(G::gameFunctions->Language_GetString(static_cast<MonoString*>(pi->displayNameToken)));
 
     // Skip interactables with empty or whitespace-only names
     if (displayName.empty() || displayName.find_first_not_of(" \t\r\n") == std::string::npos) {
         return;
     }
 
+    std::string token = "";
+    if (pi->displayNameToken) {
+        token = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(pi->displayNameToken));
+    }
+
     // Determine category using language-independent token
-    InteractableCategory category = DetermineInteractableCategory(pi, static_cast<MonoString*>(pi->displayNameToken));
+    InteractableCategory category = DetermineInteractableCategory(pi, token);
 
     // Log error if unknown interactable found
     if (category == InteractableCategory::Unknown) {
-        std::string token = "";
-        if (pi->displayNameToken) {
-            token = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(pi->displayNameToken));
-        }
         LOG_ERROR("Unknown PurchaseInteraction detected: token=\"%s\" display=\"%s\" cost=%d isShrine=%d - Please report this to the developers!", token,
                   displayName, pi->cost, pi->isShrine);
         displayName += " (UNKNOWN)";
@@ -1264,28 +1553,21 @@ void ESPModule::OnPurchaseInteractionSpawned(void* purchaseInteraction) {
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = gameObject;
     trackedInteractable->purchaseInteraction = purchaseInteraction;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
-    trackedInteractable->nameToken = "";
-    if (pi->displayNameToken) {
-        trackedInteractable->nameToken = G::g_monoRuntime->StringToUtf8(static_cast<MonoString*>(pi->displayNameToken));
-    }
+    trackedInteractable->nameToken = token;
     trackedInteractable->category = category;
     trackedInteractable->specialType = SpecialInteractableType::None;
-    trackedInteractable->consumed = false;
-    trackedInteractable->pickupIndex = -1;
-    trackedInteractable->itemName = "";
 
     // Get the localized cost string
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = pi->cost;
+    auto text = std::make_shared<InteractableText>();
+    text->cost = pi->cost;
     if (pi->cost > 0) {
-        trackedInteractable->costString = GetCostString(pi->costType, pi->cost);
+        text->costString = GetCostString(pi->costType, pi->cost);
     }
+    trackedInteractable->text = std::move(text);
 
     // Add to tracked interactables
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
 
     const char* categoryName = "";
     switch (category) {
@@ -1323,11 +1605,10 @@ void ESPModule::OnPurchaseInteractionDestroyed(void* purchaseInteraction) {
     if (!purchaseInteraction)
         return;
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.erase(
-        std::remove_if(trackedInteractables.begin(), trackedInteractables.end(),
-                       [purchaseInteraction](const std::unique_ptr<TrackedInteractable>& tracked) { return tracked->gameObject == purchaseInteraction; }),
-        trackedInteractables.end());
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::RemoveInteractable;
+    event.object = purchaseInteraction;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnBarrelInteractionSpawned(void* barrelInteraction) {
@@ -1344,12 +1625,11 @@ void ESPModule::OnBarrelInteractionSpawned(void* barrelInteraction) {
         }
     }
 
-    std::string displayName = G::gameFunctions->Language_GetString(static_cast<MonoString*>(barrel->displayNameToken));
+    std::string displayName(G::gameFunctions->Language_GetString(static_cast<MonoString*>(barrel->displayNameToken)));
     // Create interactable tracking info for barrels
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = barrelInteraction;
     trackedInteractable->purchaseInteraction = nullptr; // Barrels don't use PurchaseInteraction
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = "";
     if (barrel->displayNameToken) {
@@ -1357,13 +1637,9 @@ void ESPModule::OnBarrelInteractionSpawned(void* barrelInteraction) {
     }
     trackedInteractable->category = InteractableCategory::Barrel;
     trackedInteractable->specialType = SpecialInteractableType::None;
-    trackedInteractable->consumed = false;
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
 
     // Add to tracked interactables
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
 }
 
 void ESPModule::OnGenericInteractionSpawned(void* genericInteraction) {
@@ -1417,17 +1693,12 @@ void ESPModule::OnGenericInteractionSpawned(void* genericInteraction) {
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = gameObject;
     trackedInteractable->purchaseInteraction = nullptr;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = token;
     trackedInteractable->category = category;
     trackedInteractable->specialType = SpecialInteractableType::None;
-    trackedInteractable->consumed = false;
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
 }
 
 void ESPModule::OnGenericPickupControllerSpawned(void* genericPickupController) {
@@ -1462,30 +1733,25 @@ void ESPModule::OnGenericPickupControllerSpawned(void* genericPickupController)
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = gameObject;
     trackedInteractable->purchaseInteraction = nullptr;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = ""; // Item pickups don't have name tokens
     trackedInteractable->category = InteractableCategory::ItemPickup;
     trackedInteractable->specialType = SpecialInteractableType::None;
-    trackedInteractable->consumed = false;
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
-    trackedInteractable->pickupIndex = gpc->_pickupState.pickupIndex;
+    auto text = std::make_shared<InteractableText>();
+    text->pickupIndex = gpc->_pickupState.pickupIndex;
+    trackedInteractable->text = std::move(text);
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
 }
 
 void ESPModule::OnGenericPickupControllerDisabled(void* genericPickupController) {
     if (!genericPickupController)
         return;
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.erase(std::remove_if(trackedInteractables.begin(), trackedInteractables.end(),
-                                              [genericPickupController](const std::unique_ptr<TrackedInteractable>& tracked) {
-                                                  return tracked->gameObject == genericPickupController;
-                                              }),
-                               trackedInteractables.end());
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::RemoveInteractable;
+    event.object = genericPickupController;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnTimedChestControllerSpawned(void* timedChestController) {
@@ -1502,37 +1768,29 @@ void ESPModule::OnTimedChestControllerSpawned(void* timedChestController) {
         }
     }
 
-    std::string displayName = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("TIMEDCHEST_NAME"));
+    std::string displayName(G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("TIMEDCHEST_NAME")));
     void* purchaseInteraction = nullptr;
 
     // Create tracking info
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = gameObject;
     trackedInteractable->purchaseInteraction = purchaseInteraction;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = "TIMEDCHEST_NAME";
     trackedInteractable->category = InteractableCategory::Chest;
     trackedInteractable->specialType = SpecialInteractableType::TimedChest;
-    trackedInteractable->consumed = false;
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
 
-    {
-        std::lock_guard<std::mutex> lock(interactablesMutex);
-        trackedInteractables.push_back(std::move(trackedInteractable));
-    }
+    TrackInteractable(std::move(trackedInteractable), position);
 }
 
 void ESPModule::OnTimedChestControllerDespawned(void* timedChestController) {
     if (!timedChestController)
         return;
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.erase(
-        std::remove_if(trackedInteractables.begin(), trackedInteractables.end(),
-                       [timedChestController](const std::unique_ptr<TrackedInteractable>& tracked) { return tracked->gameObject == timedChestController; }),
-        trackedInteractables.end());
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::RemoveInteractable;
+    event.object = timedChestController;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnPickupPickerControllerSpawned(void* pickupPickerController) {
@@ -1572,50 +1830,224 @@ void ESPModule::OnPickupPickerControllerSpawned(void* pickupPickerController) {
         }
     }
 
-    MonoString* nameTokenMono = G::g_monoRuntime->CreateString(nameToken.c_str());
-    std::string displayName = G::gameFunctions->Language_GetString(nameTokenMono);
+    MonoString* nameTokenMono = G::g_monoRuntime->GetConstantString(nameToken);
+    std::string displayName(G::gameFunctions->Language_GetString(nameTokenMono));
 
     bool isScrapper = (contextToken == "SCRAPPER_CONTEXT");
 
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = pickupPickerController;
     trackedInteractable->purchaseInteraction = nullptr;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = nameToken;
     trackedInteractable->category = isScrapper ? InteractableCategory::Shop : InteractableCategory::CommandCube;
     trackedInteractable->specialType = SpecialInteractableType::None;
-    trackedInteractable->consumed = false;
-    trackedInteractable->pickupIndex = -1;
-    trackedInteractable->itemName = "";
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
 
-    {
-        std::lock_guard<std::mutex> lock(interactablesMutex);
-        trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
+}
+
+void ESPModule::TrackInteractable(std::unique_ptr<TrackedInteractable> interactable, const Vector3& position) {
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::AddInteractable;
+    event.object = interactable->gameObject;
+    event.category = static_cast<uint8_t>(interactable->category);
+    event.flags = TrackedFlag_None;
+    if (interactable->category == InteractableCategory::Portal) {
+        event.flags |= TrackedFlag_DynamicPosition;
+    }
+    event.position = position;
+    event.record = interactable.release();
+    PushTrackingEvent(event);
+}
+
+void ESPModule::PushTrackingEvent(const ESPTrackingEvent& event) {
+    // Once anything has spilled, keep spilling until the next drain so events from one thread stay in order
+    if (!m_trackingOverflowActive.load(std::memory_order_acquire) && m_trackingEvents.TryPush(event))
+        return;
+
+    std::lock_guard<std::mutex> lock(m_trackingOverflowMutex);
+    if (!m_trackingOverflowActive.load(std::memory_order_relaxed)) {
+        LOG_WARNING("ESP tracking event ring full, spilling to the overflow queue");
+        m_trackingOverflowActive.store(true, std::memory_order_release);
     }
+    m_trackingOverflow.push_back(event);
 }
 
-void ESPModule::ClearData() {
-    {
-        std::lock_guard<std::mutex> lock(interactablesMutex);
-        trackedInteractables.clear();
+void ESPModule::ApplyTrackingEvents() {
+    ESPTrackingEvent event;
+    while (m_trackingEvents.TryPop(event)) {
+        ApplyTrackingEvent(event);
     }
 
+    if (!m_trackingOverflowActive.load(std::memory_order_acquire))
+        return;
+
+    // Spilled events are newer than everything drained from the ring above; anything pushed after the flag clears waits for the next update
     {
-        std::lock_guard<std::mutex> lock(entitiesMutex);
-        trackedEnemies.clear();
-        trackedPlayers.clear();
+        std::lock_guard<std::mutex> lock(m_trackingOverflowMutex);
+        m_trackingOverflowScratch.swap(m_trackingOverflow);
+        m_trackingOverflowActive.store(false, std::memory_order_release);
     }
+    for (const ESPTrackingEvent& spilled : m_trackingOverflowScratch) {
+        ApplyTrackingEvent(spilled);
+    }
+    m_trackingOverflowScratch.clear();
+}
 
-    {
-        std::lock_guard<std::mutex> lock(teleportersMutex);
+void ESPModule::ApplyTrackingEvent(const ESPTrackingEvent& event) {
+    switch (event.type) {
+    case ESPTrackingEventType::AddEntity:
+        m_entities.Insert(event.object, Vector3(), event.category, event.flags, std::unique_ptr<TrackedEntity>(static_cast<TrackedEntity*>(event.record)));
+        break;
+
+    case ESPTrackingEventType::RemoveEntity:
+        m_entities.RemoveObject(event.object);
+        break;
+
+    case ESPTrackingEventType::AddInteractable: {
+        UntrackInteractable(event.object);
+        SlotHandle handle = m_interactables.Insert(event.object, event.position, event.category, event.flags,
+                                                   std::unique_ptr<TrackedInteractable>(static_cast<TrackedInteractable*>(event.record)));
+        m_interactableGrid.Insert(handle, event.position, event.category);
+        break;
+    }
+
+    case ESPTrackingEventType::RemoveInteractable:
+        UntrackInteractable(event.object);
+        break;
+
+    case ESPTrackingEventType::AddTeleporter:
+        trackedTeleporters.emplace_back(static_cast<TrackedTeleporter*>(event.record));
+        break;
+
+    case ESPTrackingEventType::RemoveTeleporter:
+        for (size_t i = 0; i < trackedTeleporters.size(); i++) {
+            if (trackedTeleporters[i]->teleporterInteraction == event.object) {
+                m_retiredTeleporters.push_back(std::move(trackedTeleporters[i]));
+                trackedTeleporters.erase(trackedTeleporters.begin() + i);
+                break;
+            }
+        }
+        break;
+
+    case ESPTrackingEventType::MoveTeleporter:
+        for (auto& tracked : trackedTeleporters) {
+            if (tracked->teleporterInteraction == event.object) {
+                tracked->position = event.position;
+                break;
+            }
+        }
+        break;
+
+    case ESPTrackingEventType::SetShopPickup:
+        // Find the corresponding tracked interactable by position
+        for (uint32_t i = 0; i < m_interactables.Size(); i++) {
+            if (m_interactables.Position(i) == event.position && static_cast<InteractableCategory>(m_interactables.Category(i)) == InteractableCategory::Shop) {
+                TrackedInteractable* tracked = m_interactables.Cold(i);
+                auto text = std::make_shared<InteractableText>(*tracked->text);
+                text->pickupIndex = event.pickupIndex;
+                // Get pickup name from pickup index using PickupCatalog
+                PickupDef* pickupDef = G::gameFunctions->GetPickupDef(event.pickupIndex);
+                if (pickupDef && pickupDef->nameToken) {
+                    text->itemName = G::gameFunctions->Language_GetString(static_cast<MonoString*>(pickupDef->nameToken));
+                } else {
+                    text->itemName = "Unknown [" + std::to_string(event.pickupIndex) + "]";
+                }
+                tracked->text = std::move(text);
+                break;
+            }
+        }
+        break;
+
+    case ESPTrackingEventType::Clear:
+        m_interactables.Clear();
+        m_interactableGrid.Clear();
+        m_entities.Clear();
+        for (std::unique_ptr<TrackedTeleporter>& tracked : trackedTeleporters) {
+            m_retiredTeleporters.push_back(std::move(tracked));
+        }
         trackedTeleporters.clear();
+        m_visibilityCache.Clear();
+        m_appliedClearGeneration++;
+        break;
+    }
+}
+
+void ESPModule::DeleteTrackingRecord(const ESPTrackingEvent& event) {
+    switch (event.type) {
+    case ESPTrackingEventType::AddEntity:
+        delete static_cast<TrackedEntity*>(event.record);
+        break;
+    case ESPTrackingEventType::AddInteractable:
+        delete static_cast<TrackedInteractable*>(event.record);
+        break;
+    case ESPTrackingEventType::AddTeleporter:
+        delete static_cast<TrackedTeleporter*>(event.record);
+        break;
+    default:
+        break;
+    }
+}
+
+void ESPModule::ReleaseRetiredRecords() {
+    // Everything removed during this update may still be drawn from the last published snapshot or an older one
+    if (!m_retiredEntities.empty() || !m_retiredInteractables.empty() || !m_retiredTeleporters.empty()) {
+        RetiredRecordBatch& batch = m_retiredBatches.emplace_back();
+        batch.sequence = m_renderSnapshots.PublishedSequence();
+        batch.entities.swap(m_retiredEntities);
+        batch.interactables.swap(m_retiredInteractables);
+        batch.teleporters.swap(m_retiredTeleporters);
+    }
+
+    uint64_t acknowledged = m_renderSnapshots.AcknowledgedSequence();
+    while (!m_retiredBatches.empty() && m_retiredBatches.front().sequence < acknowledged) {
+        m_retiredBatches.pop_front();
     }
+}
+
+void ESPModule::RemoveConsumedPickups() {
+    // Walk backwards so swap-removal only moves entries that were already checked
+    for (uint32_t i = m_interactables.Size(); i-- > 0;) {
+        void* gameObject = m_interactables.GetObject(i);
+        if (!gameObject)
+            continue;
+
+        InteractableCategory category = static_cast<InteractableCategory>(m_interactables.Category(i));
+        bool remove = false;
+        if (category == InteractableCategory::ItemPickup) {
+            // Check if the pickup has been consumed or recycled
+            GenericPickupController* gpc = static_cast<GenericPickupController*>(gameObject);
+            remove = gpc->Recycled || gpc->consumed;
+        } else if (category == InteractableCategory::CommandCube) {
+            PickupPickerController* ppc = static_cast<PickupPickerController*>(gameObject);
+            remove = !ppc->available_backing;
+        }
+
+        if (remove) {
+            UntrackInteractableAt(i);
+        }
+    }
+}
+
+void ESPModule::UntrackInteractable(const void* gameObject) {
+    SlotHandle handle = m_interactables.Find(gameObject);
+    m_interactableGrid.Remove(handle);
+    m_interactables.Remove(handle);
+}
 
-    auto emptyBuffer = std::make_shared<std::vector<ESPHierarchicalRenderItem>>();
-    std::atomic_store(&collectedItemsBuffer, emptyBuffer);
+void ESPModule::UntrackInteractableAt(uint32_t dense) {
+    m_interactableGrid.Remove(m_interactables.GetHandle(dense));
+    m_interactables.RemoveAt(dense);
+}
+
+void ESPModule::ClearData() {
+    // Hide the current snapshot right away, the game thread clears the stores and the visibility cache
+    // in order with the other tracking events and the next snapshot it publishes is drawn again
+    m_requestedClearGeneration.fetch_add(1, std::memory_order_release);
+
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::Clear;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnStageAdvance(void* stage) {
@@ -1633,45 +2065,69 @@ void ESPModule::OnRunExit() {
     LOG_INFO("ESP data cleared due to run exit");
 }
 
-std::string ESPModule::GetTimedChestTime(TimedChestController* timedChestController) {
-    std::string nameTime = "";
+int64_t ESPModule::GetTimedChestTimeKey(TimedChestController* timedChestController) {
     if (!timedChestController)
-        return nameTime;
+        return INT64_MIN;
 
-    // Calculate time remaining
-    if (timedChestController->lockTime > 0 && !timedChestController->purchased) {
-        float currentTime = G::gameFunctions->GetRunStopwatch();
-        float timeRemaining = timedChestController->lockTime - currentTime;
+    // Update if purchased
+    if (timedChestController->purchased) {
+        return INT64_MAX;
+    }
 
-        // Format time as MM:SS (can be negative)
-        bool isNegative = timeRemaining < 0;
-        float absTime = isNegative ? -timeRemaining : timeRemaining;
+    if (timedChestController->lockTime <= 0) {
+        return INT64_MIN;
+    }
 
-        int minutes = static_cast<int>(absTime) / 60;
-        int seconds = static_cast<int>(absTime) % 60;
+    // Whole seconds remaining as displayed, negative times map to -(seconds + 1) so -00:00 stays distinct from 00:00
+    float currentTime = G::gameFunctions->GetRunStopwatch();
+    float timeRemaining = timedChestController->lockTime - currentTime;
+    int64_t seconds = static_cast<int64_t>(timeRemaining < 0 ? -timeRemaining : timeRemaining);
+    return timeRemaining < 0 ? -seconds - 1 : seconds;
+}
 
-        char timeStr[16];
-        if (isNegative) {
-            snprintf(timeStr, sizeof(timeStr), " [-%02d:%02d]", minutes, seconds);
-        } else {
-            snprintf(timeStr, sizeof(timeStr), " [%02d:%02d]", minutes, seconds);
-        }
-        nameTime += timeStr;
-    }
+std::string ESPModule::GetTimedChestTime(int64_t timeKey) {
+    if (timeKey == INT64_MIN)
+        return "";
+    if (timeKey == INT64_MAX)
+        return " [OPENED]";
 
-    // Update if purchased
-    if (timedChestController->purchased) {
-        nameTime += " [OPENED]";
-    }
+    // Format time as MM:SS (can be negative)
+    bool isNegative = timeKey < 0;
+    int64_t absTime = isNegative ? -(timeKey + 1) : timeKey;
+
+    int minutes = static_cast<int>(absTime / 60);
+    int seconds = static_cast<int>(absTime % 60);
 
-    return nameTime;
+    char timeStr[32];
+    if (isNegative) {
+        snprintf(timeStr, sizeof(timeStr), " [-%02d:%02d]", minutes, seconds);
+    } else {
+        snprintf(timeStr, sizeof(timeStr), " [%02d:%02d]", minutes, seconds);
+    }
+    return timeStr;
 }
 
-void ESPModule::RenderInteractableESP(TrackedInteractable* interactable, ImVec2 screenPos, float distance, ChestESPSubControl* control, bool isVisible,
-                                      bool onScreen, bool isAvailable) {
+void ESPModule::RenderInteractableESP(TrackedInteractable* interactable, const InteractableText& text, ImVec2 screenPos, float distance,
+                                      ChestESPSubControl* control, bool isVisible, bool onScreen, bool isAvailable, ESPLodTier lodTier) {
     if (!interactable || !control->IsEnabled())
         return;
 
+    // Far tier: dot and name only
+    if (lodTier == ESPLodTier::Far) {
+        if (!onScreen)
+            return;
+
+        RenderUtils::RenderDot(screenPos, 3.0f, control->GetNameColorU32());
+        if (control->ShouldShowName()) {
+            if (interactable->shortLabel.Changed(0)) {
+                RenderUtils::SetLabelText(interactable->shortLabel, "%s", interactable->displayName.c_str());
+            }
+            RenderUtils::RenderLabel(ImVec2(screenPos.x, screenPos.y + 5), control->GetNameColorU32(),
+                                     control->GetNameShadowColorU32(), control->IsNameShadowEnabled(), true, interactable->shortLabel);
+        }
+        return;
+    }
+
     // If off-screen, only draw traceline and return
     if (!onScreen) {
         if (control->ShouldShowTraceline()) {
@@ -1689,81 +2145,88 @@ void ESPModule::RenderInteractableESP(TrackedInteractable* interactable, ImVec2
     }
 
     float yOffset = 0;
-    std::string displayName = interactable->displayName;
-    if (interactable->category == InteractableCategory::Special && interactable->specialType == SpecialInteractableType::PressurePlate) {
-        PressurePlateController* ppc = static_cast<PressurePlateController*>(interactable->gameObject);
-        if (ppc->switchDown) {
-            displayName += " (Active)";
-        } else {
-            displayName += " (Inactive)";
-        }
-    } else if (interactable->category == InteractableCategory::Chest && interactable->specialType == SpecialInteractableType::TimedChest) {
-        TimedChestController* tcc = static_cast<TimedChestController*>(interactable->gameObject);
-        displayName += GetTimedChestTime(tcc);
-    }
 
     // Draw interactable name with optional distance
     if (control->ShouldShowName()) {
-        char nameText[512];
-
-        if (control->ShouldShowDistance() && !isAvailable) {
-            snprintf(nameText, sizeof(nameText), "%s (%dm) (Unavailable)", displayName.c_str(), static_cast<int>(distance));
-        } else if (control->ShouldShowDistance()) {
-            snprintf(nameText, sizeof(nameText), "%s (%dm)", displayName.c_str(), static_cast<int>(distance));
-        } else if (!isAvailable) {
-            snprintf(nameText, sizeof(nameText), "%s (Unavailable)", displayName.c_str());
-        } else {
-            snprintf(nameText, sizeof(nameText), "%s", displayName.c_str());
+        bool showDistance = control->ShouldShowDistance();
+        int64_t stateKey = (showDistance ? static_cast<uint32_t>(static_cast<int>(distance)) : 0xFFFFFFFFull) | (static_cast<int64_t>(!isAvailable) << 32);
+        int64_t suffixKey = 0;
+        if (interactable->category == InteractableCategory::Special && interactable->specialType == SpecialInteractableType::PressurePlate) {
+            PressurePlateController* ppc = static_cast<PressurePlateController*>(interactable->gameObject);
+            suffixKey = ppc->switchDown ? 1 : 0;
+        } else if (interactable->category == InteractableCategory::Chest && interactable->specialType == SpecialInteractableType::TimedChest) {
+            suffixKey = GetTimedChestTimeKey(static_cast<TimedChestController*>(interactable->gameObject));
         }
 
-        ImVec2 textPos = RenderUtils::RenderText(ImVec2(screenPos.x, screenPos.y - yOffset), control->GetNameColorU32(), control->GetNameShadowColorU32(),
-                                                 control->IsNameShadowEnabled(),
-                                                 true, // Center text
-                                                 "%s", nameText);
+        if (interactable->nameLabel.Changed(stateKey, suffixKey)) {
+            std::string displayName = interactable->displayName;
+            if (interactable->category == InteractableCategory::Special && interactable->specialType == SpecialInteractableType::PressurePlate) {
+                displayName += suffixKey ? " (Active)" : " (Inactive)";
+            } else if (interactable->category == InteractableCategory::Chest && interactable->specialType == SpecialInteractableType::TimedChest) {
+                displayName += GetTimedChestTime(suffixKey);
+            }
+
+            if (showDistance && !isAvailable) {
+                RenderUtils::SetLabelText(interactable->nameLabel, "%s (%dm) (Unavailable)", displayName.c_str(), static_cast<int>(distance));
+            } else if (showDistance) {
+                RenderUtils::SetLabelText(interactable->nameLabel, "%s (%dm)", displayName.c_str(), static_cast<int>(distance));
+            } else if (!isAvailable) {
+                RenderUtils::SetLabelText(interactable->nameLabel, "%s (Unavailable)", displayName.c_str());
+            } else {
+                RenderUtils::SetLabelText(interactable->nameLabel, "%s", displayName.c_str());
+            }
+        }
+
+        RenderUtils::RenderLabel(ImVec2(screenPos.x, screenPos.y - yOffset), control->GetNameColorU32(), control->GetNameShadowColorU32(),
+                                 control->IsNameShadowEnabled(),
+                                 true, // Center text
+                                 interactable->nameLabel);
         yOffset += fontSize + 2;
 
         // Show item name for chests and shops if available
-        if (!interactable->itemName.empty() &&
-            (interactable->category == InteractableCategory::Chest || interactable->category == InteractableCategory::Shop)) {
-            std::string itemText = "[" + interactable->itemName + "]";
-            RenderUtils::RenderText(ImVec2(screenPos.x, screenPos.y - yOffset), IM_COL32(255, 215, 0, 255), // Gold color for items
-                                    control->GetNameShadowColorU32(), control->IsNameShadowEnabled(),
-                                    true, // Center text
-                                    "%s", itemText.c_str());
+        if (!text.itemName.empty() && (interactable->category == InteractableCategory::Chest || interactable->category == InteractableCategory::Shop)) {
+            if (interactable->itemLabel.Changed(text.pickupIndex)) {
+                RenderUtils::SetLabelText(interactable->itemLabel, "[%s]", text.itemName.c_str());
+            }
+            RenderUtils::RenderLabel(ImVec2(screenPos.x, screenPos.y - yOffset), IM_COL32(255, 215, 0, 255), // Gold color for items
+                                     control->GetNameShadowColorU32(), control->IsNameShadowEnabled(),
+                                     true, // Center text
+                                     interactable->itemLabel);
             yOffset += fontSize + 2;
         }
     }
 
     // Draw cost/reward info
     if (control->ShouldShowCost()) {
-        std::string rewardText;
-
         // Special handling for barrels
-        if (interactable->category == InteractableCategory::Barrel) {
-            if (interactable->purchaseInteraction) {
-                // Equipment barrels - show cost
-                if (!interactable->costString.empty()) {
-                    rewardText = interactable->costString;
-                }
-            } else if (interactable->gameObject) {
+        BarrelInteraction* barrel = nullptr;
+        if (interactable->category == InteractableCategory::Barrel && !interactable->purchaseInteraction && interactable->gameObject) {
+            barrel = static_cast<BarrelInteraction*>(interactable->gameObject);
+        }
+
+        bool changed = barrel ? interactable->costLabel.Changed(barrel->goldReward, barrel->expReward)
+                              : interactable->costLabel.Changed(text.cost, static_cast<int64_t>(text.costString.size()));
+        if (changed) {
+            if (barrel) {
                 // Regular barrels - show gold and XP rewards
-                BarrelInteraction* barrel = static_cast<BarrelInteraction*>(interactable->gameObject);
                 if (barrel->goldReward > 0 || barrel->expReward > 0) {
-                    rewardText = "$" + std::to_string(barrel->goldReward) + " + " + std::to_string(barrel->expReward) + " XP";
+                    RenderUtils::SetLabelText(interactable->costLabel, "$%d + %u XP", barrel->goldReward, barrel->expReward);
+                } else {
+                    RenderUtils::SetLabelText(interactable->costLabel, "%s", "");
                 }
-            }
-        } else if (interactable->purchaseInteraction) {
-            // Use the cached cost string that was localized when the interactable was created
-            if (!interactable->costString.empty()) {
-                rewardText = interactable->costString;
+            } else if (interactable->purchaseInteraction) {
+                // Equipment barrels and everything else use the cached cost string that was localized when the interactable was created
+                RenderUtils::SetLabelText(interactable->costLabel, "%s", text.costString.c_str());
+            } else {
+                RenderUtils::SetLabelText(interactable->costLabel, "%s", "");
             }
         }
 
-        if (!rewardText.empty()) {
-            ImVec2 textPos = RenderUtils::RenderText(ImVec2(screenPos.x, screenPos.y - yOffset), control->GetCostColorU32(), control->GetCostShadowColorU32(),
-                                                     control->IsCostShadowEnabled(),
-                                                     true, // Center text
-                                                     "%s", rewardText.c_str());
+        if (!interactable->costLabel.text.empty()) {
+            RenderUtils::RenderLabel(ImVec2(screenPos.x, screenPos.y - yOffset), control->GetCostColorU32(), control->GetCostShadowColorU32(),
+                                     control->IsCostShadowEnabled(),
+                                     true, // Center text
+                                     interactable->costLabel);
             yOffset += fontSize + 2;
         }
     }
@@ -1788,25 +2251,16 @@ void ESPModule::OnShopTerminalBehaviorSpawned(void* shopTerminalBehavior) {
         }
     }
 
-    // Find the corresponding tracked interactable by position
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    for (auto& tracked : trackedInteractables) {
-        // Check if positions match
-        if (tracked->position == shopPos && tracked->category == InteractableCategory::Shop) {
-            // Get the pickup index from the shop
-            if (shop->pickup.pickupIndex != -1) {
-                tracked->pickupIndex = shop->pickup.pickupIndex;
-                // Get pickup name from pickup index using PickupCatalog
-                PickupDef* pickupDef = G::gameFunctions->GetPickupDef(shop->pickup.pickupIndex);
-                if (pickupDef && pickupDef->nameToken) {
-                    tracked->itemName = G::gameFunctions->Language_GetString(static_cast<MonoString*>(pickupDef->nameToken));
-                } else {
-                    tracked->itemName = "Unknown [" + std::to_string(shop->pickup.pickupIndex) + "]";
-                }
-            }
-            break;
-        }
-    }
+    // Get the pickup index from the shop, the matching tracked shop is looked up by position when the event is applied
+    if (shop->pickup.pickupIndex == -1)
+        return;
+
+    ESPTrackingEvent event{};
+    event.type = ESPTrackingEventType::SetShopPickup;
+    event.object = shopTerminalBehavior;
+    event.position = shopPos;
+    event.pickupIndex = shop->pickup.pickupIndex;
+    PushTrackingEvent(event);
 }
 
 void ESPModule::OnPressurePlateControllerSpawned(void* pressurePlateController) {
@@ -1830,19 +2284,12 @@ void ESPModule::OnPressurePlateControllerSpawned(void* pressurePlateController)
     auto trackedInteractable = std::make_unique<TrackedInteractable>();
     trackedInteractable->gameObject = pressurePlateController;
     trackedInteractable->purchaseInteraction = nullptr;
-    trackedInteractable->position = position;
     trackedInteractable->displayName = displayName;
     trackedInteractable->nameToken = "PRESSURE_PLATE_DYNAMIC"; // Mark as dynamic
     trackedInteractable->category = InteractableCategory::Special;
     trackedInteractable->specialType = SpecialInteractableType::PressurePlate;
-    trackedInteractable->consumed = false;
-    trackedInteractable->pickupIndex = -1;
-    trackedInteractable->itemName = "";
-    trackedInteractable->costString = "";
-    trackedInteractable->cachedCost = 0;
 
-    std::lock_guard<std::mutex> lock(interactablesMutex);
-    trackedInteractables.push_back(std::move(trackedInteractable));
+    TrackInteractable(std::move(trackedInteractable), position);
 }
 
 void ESPModule::InitializeCostFormats() {
@@ -1851,18 +2298,18 @@ void ESPModule::InitializeCostFormats() {
 
     LOG_INFO("Initializing cost formats...");
 
-    m_moneyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_MONEY_FORMAT"));
-    m_percentHealthFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_PERCENTHEALTH_FORMAT"));
-    m_itemFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_ITEM_FORMAT"));
-    m_lunarFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_LUNAR_FORMAT"));
-    m_equipmentFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_EQUIPMENT_FORMAT"));
-    m_volatileBatteryFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_VOLATILEBATTERY_FORMAT"));
-    m_artifactKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_ARTIFACTSHELLKILLERITEM_FORMAT"));
-    m_rustedKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_TREASURECACHEITEM_FORMAT"));
-    m_encrustedKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_TREASURECACHEVOIDITEM_FORMAT"));
-    m_lunarCoinName = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("PICKUP_LUNAR_COIN"));
-    m_voidCoinName = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("PICKUP_VOID_COIN"));
-    m_soulCostFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->CreateString("COST_SOULCOST_FORMAT"));
+    m_moneyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_MONEY_FORMAT"));
+    m_percentHealthFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_PERCENTHEALTH_FORMAT"));
+    m_itemFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_ITEM_FORMAT"));
+    m_lunarFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_LUNAR_FORMAT"));
+    m_equipmentFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_EQUIPMENT_FORMAT"));
+    m_volatileBatteryFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_VOLATILEBATTERY_FORMAT"));
+    m_artifactKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_ARTIFACTSHELLKILLERITEM_FORMAT"));
+    m_rustedKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_TREASURECACHEITEM_FORMAT"));
+    m_encrustedKeyFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_TREASURECACHEVOIDITEM_FORMAT"));
+    m_lunarCoinName = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("PICKUP_LUNAR_COIN"));
+    m_voidCoinName = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("PICKUP_VOID_COIN"));
+    m_soulCostFormat = G::gameFunctions->Language_GetString(G::g_monoRuntime->GetConstantString("COST_SOULCOST_FORMAT"));
 
     m_costFormatsInitialized = true;
     LOG_INFO("Cost formats initialized successfully");
@@ -1955,10 +2402,13 @@ std::string ESPModule::GetCostString(CostTypeIndex_Value costType, int cost) {
 }
 
 void ESPModule::UpdateShrineCosts() {
-    std::lock_guard<std::mutex> lock(interactablesMutex);
+    for (uint32_t i = 0; i < m_interactables.Size(); i++) {
+        if (static_cast<InteractableCategory>(m_interactables.Category(i)) != InteractableCategory::Shrine) {
+            continue;
+        }
 
-    for (auto& interactable : trackedInteractables) {
-        if (interactable->category != InteractableCategory::Shrine || !interactable->purchaseInteraction) {
+        TrackedInteractable* interactable = m_interactables.Cold(i);
+        if (!interactable->purchaseInteraction) {
             continue;
         }
 
@@ -1967,14 +2417,16 @@ void ESPModule::UpdateShrineCosts() {
             continue;
         }
 
-        if (pi->cost != interactable->cachedCost) {
-            LOG_INFO("Shrine cost updated: %d -> %d - instance=%p", interactable->cachedCost, pi->cost, interactable->gameObject);
+        if (pi->cost != interactable->text->cost) {
+            LOG_INFO("Shrine cost updated: %d -> %d - instance=%p", interactable->text->cost, pi->cost, interactable->gameObject);
 
-            interactable->cachedCost = pi->cost;
-            interactable->costString = "";
+            auto text = std::make_shared<InteractableText>(*interactable->text);
+            text->cost = pi->cost;
+            text->costString = "";
             if (pi->cost > 0) {
-                interactable->costString = GetCostString(pi->costType, pi->cost);
+                text->costString = GetCostString(pi->costType, pi->cost);
             }
+            interactable->text = std::move(text);
         }
     }
 }
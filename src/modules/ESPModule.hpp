@@ -4,17 +4,51 @@
 #include "game/GameStructs.hpp"
 #include "menu/InputControls.hpp"
 #include "utils/ModStructs.hpp"
+#include "utils/MpscRing.hpp"
+#include "utils/RenderUtils.hpp"
+#include "utils/SlotMapStore.hpp"
+#include "utils/SpatialGrid.hpp"
+#include "utils/TripleBuffer.hpp"
+#include "utils/VisibilityCache.hpp"
 #include <atomic>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
 
+// Level of detail picked per object each update from its distance (and on-screen size for entities)
+enum class ESPLodTier : uint8_t {
+    Near = 0, // Full detail, refreshed every update
+    Mid,      // Fallback box without hurtbox bounds or healthbar, visibility refreshed every Nth update
+    Far,      // Dot and short label only, position and visibility refreshed every Nth update
+};
+
+// Cold per-entity data, hot fields live in the ESPModule entity store
 struct TrackedEntity {
     CharacterBody* body;
     std::string displayName;
     std::string nameToken;
+
+    // Hurtbox cache built at spawn, bounds are stored relative to boundsTransform (model root, or the body if it has no model)
+    Transform* boundsTransform = nullptr;
+    std::vector<Transform*> hurtBoxTransforms;
+    Vector3 localBoundsMin;
+    Vector3 localBoundsMax;
+    bool hasLocalBounds = false;
+
+    uint32_t lodRefreshTick = 0; // Update tick of the last full refresh, 0 if never refreshed
+
+    // Motion estimate from the last two position samples, used by the render thread to extrapolate
+    Vector3 velocity;
+    double sampleTime = 0.0; // ESP clock time of the last position sample, 0 if never sampled
+
+    // Render thread label cache
+    CachedLabel nameLabel;
+    CachedLabel healthLabel;
+    CachedLabel maxHealthLabel;
+    CachedLabel distanceLabel;
 };
 
 enum class InteractableCategory { Chest, Shop, Drone, Shrine, Special, Barrel, ItemPickup, Portal, CommandCube, Unknown };
@@ -24,21 +58,65 @@ struct TrackedTeleporter {
     void* teleporterInteraction;
     Vector3 position;
     std::string displayName;
+    CachedLabel label; // Render thread label cache
+};
+
+// Interactable text that changes after tracking starts. The game thread swaps in a new copy instead of editing a published
+// one, so a render snapshot keeps reading the version it was built with.
+struct InteractableText {
+    std::string itemName;     // Name of the item in chest/shop
+    std::string costString;   // Store the localized cost string
+    int32_t cost = 0;         // Store the cost value used to generate costString
+    int32_t pickupIndex = -1; // Store the pickup index
 };
 
+// Cold per-interactable data, position and flags live in the ESPModule interactable store
 struct TrackedInteractable {
     void* gameObject;
     void* purchaseInteraction;
     std::string displayName;
-    std::string itemName;   // Name of the item in chest/shop
-    std::string nameToken;  // Store the language-independent token
-    std::string costString; // Store the localized cost string
-    int32_t cachedCost;     // Store the cost value used to generate costString
-    Vector3 position;
+    std::string nameToken; // Store the language-independent token
+    std::shared_ptr<const InteractableText> text = std::make_shared<const InteractableText>();
     InteractableCategory category;
     SpecialInteractableType specialType;
-    bool consumed;       // For item pickups
-    int32_t pickupIndex; // Store the pickup index
+
+    uint32_t lodRefreshTick = 0; // Update tick of the last full refresh, 0 if never refreshed
+
+    // Render thread label cache
+    CachedLabel nameLabel;
+    CachedLabel shortLabel; // Name only, used by the far LOD tier
+    CachedLabel itemLabel;
+    CachedLabel costLabel;
+};
+
+// Flags kept in the hot column of the tracked object stores
+enum TrackedObjectFlags : uint8_t {
+    TrackedFlag_None = 0,
+    TrackedFlag_NoBounds = 1 << 0,        // Don't calculate hurtbox bounds for this entity
+    TrackedFlag_DynamicPosition = 1 << 1, // Re-read the transform position every update (portals)
+};
+
+// Tracking changes pushed by the game hooks, applied by ESPModule::ApplyTrackingEvents on the game thread
+enum class ESPTrackingEventType : uint8_t {
+    AddEntity,          // record is a TrackedEntity, category holds ESPMainCategory
+    RemoveEntity,
+    AddInteractable,    // record is a TrackedInteractable
+    RemoveInteractable,
+    AddTeleporter,      // record is a TrackedTeleporter
+    RemoveTeleporter,
+    MoveTeleporter,
+    SetShopPickup,      // Shop at position now offers pickupIndex
+    Clear,
+};
+
+struct ESPTrackingEvent {
+    ESPTrackingEventType type;
+    uint8_t category;
+    uint8_t flags;
+    int32_t pickupIndex;
+    void* object;
+    Vector3 position;
+    void* record; // Cold record owned by the event until applied
 };
 
 // Hierarchical ESP ordering system
@@ -51,12 +129,14 @@ enum class ESPSubCategory {
     COUNT
 };
 
-struct ESPCategoryInfo {
-    ESPMainCategory mainCategory;
-    ESPSubCategory subCategory;
-    std::string displayName;
+// Flattened render order: each (main, sub) pair gets a slot index, lowest slot is drawn first
+struct ESPRenderSlotTable {
+    static constexpr int MaxSlots = static_cast<int>(ESPMainCategory::COUNT) * static_cast<int>(ESPSubCategory::COUNT);
 
-    ESPCategoryInfo(ESPMainCategory main, ESPSubCategory sub, const std::string& name) : mainCategory(main), subCategory(sub), displayName(name) {}
+    int8_t slots[static_cast<int>(ESPMainCategory::COUNT)][static_cast<int>(ESPSubCategory::COUNT)]; // -1 if not rendered
+    ESPMainCategory slotMainCategory[MaxSlots];
+    ESPSubCategory slotSubCategory[MaxSlots];
+    int slotCount;
 };
 
 // Unified render item for hierarchical rendering
@@ -75,11 +155,19 @@ struct ESPHierarchicalRenderItem {
 
     bool isVisible;
     bool isAvailable; // For interactables
+    ESPLodTier lodTier = ESPLodTier::Near;
 
     bool foundBounds;
-    ImVec2 boundsMin;
+    ImVec2 boundsMin; // Relative to the projected worldPosition, so the box follows extrapolation
     ImVec2 boundsMax;
 
+    // Entities only: worldPosition was sampled at sampleTime and moves at velocity
+    Vector3 velocity;
+    double sampleTime = 0.0;
+
+    // Interactables only: text as of collection, the render thread never reads it through the record
+    std::shared_ptr<const InteractableText> text;
+
     // Constructor for entities
     ESPHierarchicalRenderItem(ESPMainCategory main, ESPSubCategory sub, TrackedEntity* ent, Vector3 worldPos, float dist, bool visible, bool foundBounds,
                               ImVec2 boundsMin, ImVec2 boundsMax)
@@ -88,30 +176,62 @@ struct ESPHierarchicalRenderItem {
 
     // Constructor for interactables
     ESPHierarchicalRenderItem(ESPMainCategory main, ESPSubCategory sub, TrackedInteractable* inter, Vector3 worldPos, float dist, bool visible, bool available)
-        : mainCategory(main), subCategory(sub), distance(dist), interactable(inter), worldPosition(worldPos), isVisible(visible), isAvailable(available) {}
+        : mainCategory(main), subCategory(sub), distance(dist), interactable(inter), worldPosition(worldPos), isVisible(visible), isAvailable(available),
+          text(inter->text) {}
 
     // Constructor for teleporter
     ESPHierarchicalRenderItem(ESPMainCategory main, ESPSubCategory sub, void* tele, Vector3 worldPos, float dist, bool visible)
         : mainCategory(main), subCategory(sub), distance(dist), teleporterData(tele), worldPosition(worldPos), isVisible(visible), isAvailable(true) {}
 };
 
+// Contiguous run of snapshot items sharing one render slot
+struct ESPRenderSpan {
+    ESPMainCategory mainCategory;
+    ESPSubCategory subCategory;
+    uint32_t begin;
+    uint32_t end;
+};
+
+// Radix sort entry: render slot and inverted distance packed into key, index into the collected items
+struct ESPRenderSortKey {
+    uint32_t key;
+    uint32_t index;
+};
+
+// Render-ready ESP data built on the game thread: items are grouped into spans in render order
+// and sorted far to near within each span, so the render thread only iterates.
+// Snapshots live in a triple buffer and are rebuilt in place, so the vectors keep their capacity between updates.
+struct ESPRenderSnapshot {
+    CachedCameraData camera{}; // Camera the items were collected with
+    std::vector<ESPHierarchicalRenderItem> items;
+    std::vector<ESPRenderSpan> spans;
+    uint32_t clearGeneration = 0; // Number of ClearData calls applied before this snapshot was built
+};
+
 // Manager for ESP rendering order hierarchy
 class ESPRenderOrderManager {
   private:
     std::vector<ESPMainCategory> m_mainCategoryOrder;
     std::map<ESPMainCategory, std::vector<ESPSubCategory>> m_subCategoryOrders;
 
+    // Republished on every order change so the game thread can read it without locking
+    std::shared_ptr<const ESPRenderSlotTable> m_slotTable;
+    void PublishSlotTable();
+
   public:
     ESPRenderOrderManager();
 
     const std::vector<ESPMainCategory>& GetMainOrder() const { return m_mainCategoryOrder; }
-    void SetMainOrder(const std::vector<ESPMainCategory>& order) { m_mainCategoryOrder = order; }
+    void SetMainOrder(const std::vector<ESPMainCategory>& order) {
+        m_mainCategoryOrder = order;
+        PublishSlotTable();
+    }
 
     const std::vector<ESPSubCategory>& GetSubOrder(ESPMainCategory mainCat) const;
     void SetSubOrder(ESPMainCategory mainCat, const std::vector<ESPSubCategory>& order);
 
-    // Get all categories in hierarchical render order (reverse of priority for rendering)
-    std::vector<ESPCategoryInfo> GetRenderOrder() const;
+    // Slot table for the current hierarchical render order (reverse of priority for rendering)
+    std::shared_ptr<const ESPRenderSlotTable> GetSlotTable() const { return std::atomic_load(&m_slotTable); }
 
     void MoveCategoryUp(ESPMainCategory category);
     void MoveCategoryDown(ESPMainCategory category);
@@ -161,7 +281,9 @@ class ESPModule : public ModuleBase {
         }
     };
 
-    std::shared_ptr<std::vector<ESPHierarchicalRenderItem>> collectedItemsBuffer = std::make_shared<std::vector<ESPHierarchicalRenderItem>>();
+    TripleBuffer<ESPRenderSnapshot> m_renderSnapshots; // Written by OnGameUpdate, read by OnFrameRender
+    std::atomic<uint32_t> m_requestedClearGeneration{0}; // Bumped by ClearData, snapshots from before the clear are not drawn
+    uint32_t m_appliedClearGeneration = 0;               // Game thread count of applied Clear events
     std::unique_ptr<RenderOrderConfigControl> m_renderOrderConfigControl;
     std::unique_ptr<ESPControl> teleporterESPControl;
     std::unique_ptr<EntityESPControl> playerESPControl;
@@ -174,18 +296,57 @@ class ESPModule : public ModuleBase {
     std::unique_ptr<ChestESPControl> barrelESPControl;
     std::unique_ptr<ChestESPControl> itemPickupESPControl;
     std::unique_ptr<ChestESPControl> portalESPControl;
+    std::unique_ptr<IntControl> visibilityBudgetControl;
+    std::unique_ptr<FloatControl> lodNearDistanceControl;
+    std::unique_ptr<FloatControl> lodFarDistanceControl;
+    std::unique_ptr<IntControl> lodMinBoxHeightControl;
+    std::unique_ptr<IntControl> lodMidIntervalControl;
+    std::unique_ptr<IntControl> lodFarIntervalControl;
 
     Vector3 playerPosition;
     Camera* mainCamera;
-    std::shared_ptr<CachedCameraData> cameraCache = std::make_shared<CachedCameraData>();
 
-    std::vector<std::unique_ptr<TrackedEntity>> trackedEnemies;
-    std::vector<std::unique_ptr<TrackedEntity>> trackedPlayers;
-    std::vector<std::unique_ptr<TrackedInteractable>> trackedInteractables;
+    // Occlusion results, only touched from the game thread
+    VisibilityCache m_visibilityCache;
+    uint32_t m_updateTick = 0;
+
+    // Game thread scratch for building render snapshots
+    std::vector<ESPHierarchicalRenderItem> m_collectScratch;
+    std::vector<ESPRenderSortKey> m_sortKeys;
+    std::vector<ESPRenderSortKey> m_sortScratch;
+
+    // Render thread scratch for batched projection
+    std::vector<Vector3> m_projectWorld;
+    std::vector<ImVec2> m_projectScreen;
+    std::vector<uint32_t> m_projectInFront;
+
+    SlotMapStore<TrackedEntity> m_entities;             // Category column holds ESPMainCategory::Players / Enemies
+    SlotMapStore<TrackedInteractable> m_interactables; // Category column holds InteractableCategory
+    SpatialGrid m_interactableGrid;                    // Kept in sync with m_interactables
+    std::vector<SlotHandle> m_gridCandidates;
     std::vector<std::unique_ptr<TrackedTeleporter>> trackedTeleporters;
-    std::mutex entitiesMutex;
-    std::mutex interactablesMutex;
-    std::mutex teleportersMutex;
+
+    // Snapshots point at cold records, so records removed on the game thread are kept until the render thread
+    // has acknowledged a snapshot built after their removal. Removals collect in the retired vectors during an update
+    // and are moved into a batch tagged with the last published sequence before the next publish.
+    struct RetiredRecordBatch {
+        uint64_t sequence; // Newest snapshot that may still reference the records
+        std::vector<std::unique_ptr<TrackedEntity>> entities;
+        std::vector<std::unique_ptr<TrackedInteractable>> interactables;
+        std::vector<std::unique_ptr<TrackedTeleporter>> teleporters;
+    };
+    std::vector<std::unique_ptr<TrackedEntity>> m_retiredEntities;
+    std::vector<std::unique_ptr<TrackedInteractable>> m_retiredInteractables;
+    std::vector<std::unique_ptr<TrackedTeleporter>> m_retiredTeleporters;
+    std::deque<RetiredRecordBatch> m_retiredBatches;
+
+    // The stores above are owned by the game thread, hooks only push events that ApplyTrackingEvents drains before collection.
+    // When the ring fills up, events spill into the overflow queue until the next drain so none are lost or reordered.
+    MpscRing<ESPTrackingEvent, 4096> m_trackingEvents;
+    std::atomic<bool> m_trackingOverflowActive{false};
+    std::mutex m_trackingOverflowMutex;
+    std::vector<ESPTrackingEvent> m_trackingOverflow;
+    std::vector<ESPTrackingEvent> m_trackingOverflowScratch;
 
     // Cached cost format strings
     std::string m_moneyFormat;
@@ -202,6 +363,9 @@ class ESPModule : public ModuleBase {
     std::string m_soulCostFormat;
     bool m_costFormatsInitialized;
 
+    // Name token -> category, persists across stages
+    std::unordered_map<std::string, InteractableCategory> m_tokenCategoryCache;
+
     // Pickup name cache
     std::unordered_map<int32_t, std::string> m_pickupIdToNameCache;
     bool m_pickupCacheInitialized;
@@ -219,15 +383,29 @@ class ESPModule : public ModuleBase {
     // Main category to control lookup table
     ChestESPControl* m_mainCategoryControls[static_cast<int>(ESPMainCategory::COUNT)];
 
-    bool CalcEntityBounds(TrackedEntity* entity, ImVec2& outMin, ImVec2& outMax);
+    void BuildHurtBoxCache(TrackedEntity* entity);
+    bool CalcEntityBounds(TrackedEntity* entity, const CachedCameraData& camera, ImVec2& outMin, ImVec2& outMax);
+    ESPLodTier GetLodTier(float distance) const;
+    ESPLodTier GetEntityLodTier(TrackedEntity* entity, float distance, const CachedCameraData& camera) const;
+    bool ShouldRefreshLod(ESPLodTier tier, uint32_t lastRefreshTick) const;
     void RenderEntityESP(TrackedEntity* entity, ImVec2 screenPos, float distance, EntityESPSubControl* control, bool isVisible, bool onScreen, bool hasBounds,
-                         ImVec2 screenMin, ImVec2 screenMax);
-    std::string GetTimedChestTime(TimedChestController* timedChestController);
-    void RenderInteractableESP(TrackedInteractable* interactable, ImVec2 screenPos, float distance, ChestESPSubControl* control, bool isVisible, bool onScreen,
-                               bool isAvailable);
-    Vector3 GetCameraPosition();
-    bool IsVisible(const Vector3& position);
-    InteractableCategory DetermineInteractableCategory(PurchaseInteraction* pi, MonoString* nameToken);
+                         ImVec2 screenMin, ImVec2 screenMax, ESPLodTier lodTier);
+    int64_t GetTimedChestTimeKey(TimedChestController* timedChestController);
+    std::string GetTimedChestTime(int64_t timeKey);
+    void RenderInteractableESP(TrackedInteractable* interactable, const InteractableText& text, ImVec2 screenPos, float distance, ChestESPSubControl* control,
+                               bool isVisible, bool onScreen, bool isAvailable, ESPLodTier lodTier);
+    bool IsVisible(const void* key, const Vector3& position, float distance, const CachedCameraData& camera);
+    InteractableCategory DetermineInteractableCategory(PurchaseInteraction* pi, const std::string& token);
+    void PushTrackingEvent(const ESPTrackingEvent& event);
+    void ApplyTrackingEvents();
+    void ApplyTrackingEvent(const ESPTrackingEvent& event);
+    static void DeleteTrackingRecord(const ESPTrackingEvent& event);
+    void RemoveConsumedPickups();
+    void ReleaseRetiredRecords();
+    void TrackInteractable(std::unique_ptr<TrackedInteractable> interactable, const Vector3& position);
+    // Game thread only, modify the interactable store and grid directly
+    void UntrackInteractable(const void* gameObject);
+    void UntrackInteractableAt(uint32_t dense);
     void InitializeCostFormats();
     void InitializeCategoryMappings();
     std::string GetPickupName(int32_t pickupIndex);
@@ -242,8 +420,12 @@ class ESPModule : public ModuleBase {
     void Initialize() override;
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
     void OnFrameRender();
 
+    // Monotonic clock shared by game thread samples and render thread extrapolation
+    static double GetClockSeconds();
+
     void OnGameUpdate();
     void OnTeleporterAwake(void* teleporter);
     void OnTeleporterDestroyed(void* teleporter);
@@ -269,6 +451,7 @@ class ESPModule : public ModuleBase {
     void CachePickupName(int32_t pickupIndex, const std::string& name);
 
     void DrawRenderOrderUI();
-    void CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items);
-    void RenderESPItem(const ESPHierarchicalRenderItem& item);
+    void CollectAllESPItems(std::vector<ESPHierarchicalRenderItem>& items, const CachedCameraData& camera);
+    void BuildRenderSnapshot(const std::vector<ESPHierarchicalRenderItem>& items, ESPRenderSnapshot& snapshot);
+    void RenderESPItem(const ESPHierarchicalRenderItem& item, ImVec2 screenPos, bool onScreen);
 };
@@ -21,6 +21,9 @@ EnemyModule::~EnemyModule() {}
 
 void EnemyModule::Initialize() {}
 
+// Team levels are read from TeamManager.teamLevels by GameFunctions::GetTeamLevel
+std::vector<GameStructId> EnemyModule::GetRequiredStructs() const { return {GameStructId::TeamManager}; }
+
 void EnemyModule::Update() {
     monsterLevelControl->Update();
     lunarLevelControl->Update();
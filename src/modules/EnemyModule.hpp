@@ -17,6 +17,7 @@ class EnemyModule : public ModuleBase {
     void Initialize() override;
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
 
     void OnLocalUserUpdate(void* localUser);
 
@@ -39,6 +39,10 @@ EnemySpawningModule::EnemySpawningModule() : ModuleBase() {
 
 EnemySpawningModule::~EnemySpawningModule() { itemControls.clear(); }
 
+// Spawning only goes through GameFunctions, and its crosshair position falls back to field reads when LocalUser or
+// CameraRigController no longer match
+std::vector<GameStructId> EnemySpawningModule::GetRequiredStructs() const { return {}; }
+
 void EnemySpawningModule::Update() {
     // Controls handle their own hotkey updates
     enemySelectControl->Update();
@@ -81,7 +85,8 @@ void EnemySpawningModule::DrawUI() {
 
 void EnemySpawningModule::OnLocalUserUpdate(void* localUser) {
     LocalUser* localUser_ptr = static_cast<LocalUser*>(localUser);
-    if (!localUser_ptr->_cameraRigController) {
+    Vector3 spawnPosition;
+    if (!G::gameFunctions->GetCrosshairWorldPosition(localUser_ptr, spawnPosition)) {
         return;
     }
 
@@ -95,7 +100,6 @@ void EnemySpawningModule::OnLocalUserUpdate(void* localUser) {
         bool matchDifficulty = std::get<3>(spawn);
         int eliteBuffIndex = std::get<4>(spawn);
         std::vector<std::pair<int, int>> items = std::get<5>(spawn);
-        Vector3 spawnPosition = localUser_ptr->_cameraRigController->crosshairWorldPosition_backing;
 
         // Find elite name from buff index
         std::string eliteType = "None";
@@ -37,6 +37,7 @@ class EnemySpawningModule : public ModuleBase {
     void Initialize() override {}
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
 
     void OnLocalUserUpdate(void* localUser);
     void InitializeEnemies();
@@ -22,6 +22,9 @@ void InteractableSpawningModule::Initialize() {
     LOG_INFO("InteractableSpawningModule initialized with %zu interactables", interactableNames.size());
 }
 
+// Spawn positions are the player position PlayerModule reads through LocalUser.cachedBody and CharacterBody.transform
+std::vector<GameStructId> InteractableSpawningModule::GetRequiredStructs() const { return {GameStructId::LocalUser, GameStructId::CharacterBody}; }
+
 void InteractableSpawningModule::Update() {
     interactableSelectControl->Update();
     spawnButtonControl->Update();
@@ -22,6 +22,7 @@ class InteractableSpawningModule : public ModuleBase {
     void Initialize() override;
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
 
   private:
     void SetupInteractables();
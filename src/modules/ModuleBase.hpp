@@ -1,7 +1,13 @@
 #pragma once
+#include "game/GameStructLayouts.hpp"
+#include <atomic>
 #include <string>
+#include <vector>
 
 class ModuleBase {
+  private:
+    std::atomic<bool> m_layoutCompatible{true}; // Set during startup, read from hooks and the render thread
+
   public:
     ModuleBase() {};
     virtual ~ModuleBase() {};
@@ -9,4 +15,10 @@ class ModuleBase {
     virtual void Initialize() = 0;
     virtual void Update() = 0;
     virtual void DrawUI() = 0;
+
+    // GameStructs.hpp structs the module dereferences directly. If any of them no longer matches the game the module is
+    // switched off at startup instead of reading through stale offsets.
+    virtual std::vector<GameStructId> GetRequiredStructs() const { return {}; }
+    bool IsLayoutCompatible() const { return m_layoutCompatible.load(std::memory_order_acquire); }
+    void SetLayoutCompatible(bool compatible) { m_layoutCompatible.store(compatible, std::memory_order_release); }
 };
@@ -178,9 +178,9 @@ void PlayerModule::Initialize() {
 
     teleportToCursorControl = std::make_unique<ToggleButtonControl>("Teleport to Cursor", "teleportToCursor", "Teleport", false);
     teleportToCursorControl->SetOnAction([this]() {
-        if (localUser_cached && localUser_cached->cachedBody_backing && localUser_cached->_cameraRigController) {
-            G::gameFunctions->TeleportHelper_TeleportBody(localUser_cached->cachedBody_backing,
-                                                          localUser_cached->_cameraRigController->crosshairWorldPosition_backing);
+        Vector3 crosshair;
+        if (localUser_cached && localUser_cached->cachedBody_backing && G::gameFunctions->GetCrosshairWorldPosition(localUser_cached, crosshair)) {
+            G::gameFunctions->TeleportHelper_TeleportBody(localUser_cached->cachedBody_backing, crosshair);
         }
     });
 
@@ -383,6 +383,12 @@ void PlayerModule::Initialize() {
     });
 }
 
+std::vector<GameStructId> PlayerModule::GetRequiredStructs() const {
+    return {GameStructId::LocalUser, GameStructId::CharacterMaster, GameStructId::CharacterBody, GameStructId::CharacterMotor, GameStructId::HealthComponent,
+            GameStructId::Inventory, GameStructId::SkillLocator, GameStructId::GenericSkill, GameStructId::NetworkUser, GameStructId::TeamManager,
+            GameStructId::HuntressTracker, GameStructId::BullseyeSearch};
+}
+
 void PlayerModule::Update() {
     godModeControl->Update();
     baseMoveSpeedControl->Update();
@@ -522,9 +528,7 @@ void PlayerModule::OnLocalUserUpdate(void* localUser) {
     localUser_cached = localUser_ptr;
 
     Hooks::Transform_get_position_Injected(localUser_ptr->cachedBody_backing->transform, &playerPosition);
-    if (localUser_cached->_cameraRigController) {
-        crosshairPosition = localUser_cached->_cameraRigController->crosshairWorldPosition_backing;
-    }
+    G::gameFunctions->GetCrosshairWorldPosition(localUser_cached, crosshairPosition);
 
     localUser_ptr->cachedMaster_backing->godMode = godModeControl->IsEnabled();
     localUser_ptr->cachedBody_backing->healthComponent_backing->godMode_backing = godModeControl->IsEnabled();
@@ -104,6 +104,7 @@ class PlayerModule : public ModuleBase {
     void Initialize() override;
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
 
     void OnLocalUserUpdate(void* localUser);
     void OnInventoryChanged(void* inventory);
@@ -29,6 +29,11 @@ void WorldModule::Initialize() {
     fixedTimeControl->SetOnChange([](float newValue) { G::gameFunctions->SetFixedTime(newValue); });
 }
 
+std::vector<GameStructId> WorldModule::GetRequiredStructs() const {
+    return {GameStructId::TeleporterInteraction, GameStructId::HoldoutZoneController, GameStructId::PortalSpawner, GameStructId::TimedChestController,
+            GameStructId::PurchaseInteraction};
+}
+
 void WorldModule::Update() {
     instantTeleporterControl->Update();
     instantHoldoutZoneControl->Update();
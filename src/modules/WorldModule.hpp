@@ -25,6 +25,7 @@ class WorldModule : public ModuleBase {
     void Initialize() override;
     void Update() override;
     void DrawUI() override;
+    std::vector<GameStructId> GetRequiredStructs() const override;
 
     ToggleControl* GetOpenExpiredTimedChestsControl() const { return openExpiredTimedChestsControl.get(); }
     ToggleControl* GetOpenLockedInteractablesControl() const { return openLockedInteractablesControl.get(); }
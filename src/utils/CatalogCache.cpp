@@ -0,0 +1,265 @@
+#include "CatalogCache.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace CatalogCache {
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;
+    uint64_t payloadSize;
+    uint64_t payloadHash;
+};
+static_assert(sizeof(Header) == 32, "Header layout is part of the file format");
+
+// Item flags packed into one byte, bit positions are part of the format
+enum ItemFlags : uint8_t {
+    IsDroppable = 1 << 0,
+    CanScrap = 1 << 1,
+    CanRestack = 1 << 2,
+    CanRemove = 1 << 3,
+    IsConsumed = 1 << 4,
+    Hidden = 1 << 5,
+};
+
+uint64_t Hash(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ull;
+    }
+    return hash;
+}
+
+class Writer {
+  private:
+    std::vector<uint8_t>& m_out;
+
+  public:
+    explicit Writer(std::vector<uint8_t>& out) : m_out(out) {}
+
+    template <typename T> void Put(T value) {
+        static_assert(std::is_arithmetic_v<T>, "Only fixed-size scalars are written directly");
+        uint8_t bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        m_out.insert(m_out.end(), bytes, bytes + sizeof(T));
+    }
+
+    void PutString(const std::string& text) {
+        Put(static_cast<uint32_t>(text.size()));
+        m_out.insert(m_out.end(), text.begin(), text.end());
+    }
+};
+
+// Every read is bounds-checked, the first failure sticks so callers can check once per record
+class Reader {
+  private:
+    const uint8_t* m_pos;
+    const uint8_t* m_end;
+    bool m_ok = true;
+
+  public:
+    Reader(const uint8_t* data, size_t size) : m_pos(data), m_end(data + size) {}
+
+    bool Ok() const { return m_ok; }
+    bool AtEnd() const { return m_pos == m_end; }
+
+    template <typename T> T Get() {
+        T value{};
+        if (!m_ok || static_cast<size_t>(m_end - m_pos) < sizeof(T)) {
+            m_ok = false;
+            return value;
+        }
+        std::memcpy(&value, m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+
+    std::string GetString() {
+        uint32_t length = Get<uint32_t>();
+        if (!m_ok || static_cast<size_t>(m_end - m_pos) < length) {
+            m_ok = false;
+            return {};
+        }
+        std::string text(reinterpret_cast<const char*>(m_pos), length);
+        m_pos += length;
+        return text;
+    }
+
+    // Element count of the next array, rejected up front if the remaining bytes can't hold that many minimal elements
+    uint32_t GetCount(size_t minElementSize) {
+        uint32_t count = Get<uint32_t>();
+        if (m_ok && count > static_cast<size_t>(m_end - m_pos) / minElementSize)
+            m_ok = false;
+        return m_ok ? count : 0;
+    }
+};
+
+static void WriteItem(Writer& writer, const RoR2Item& item) {
+    writer.Put<int32_t>(item.index);
+    writer.PutString(item.displayName);
+    writer.PutString(item.name);
+    writer.PutString(item.nameToken);
+    writer.PutString(item.pickupToken);
+    writer.PutString(item.descriptionToken);
+    writer.PutString(item.loreToken);
+    writer.Put<int32_t>(static_cast<int32_t>(item.tier));
+    writer.PutString(item.tierName);
+
+    uint8_t flags = 0;
+    flags |= item.isDroppable ? IsDroppable : 0;
+    flags |= item.canScrap ? CanScrap : 0;
+    flags |= item.canRestack ? CanRestack : 0;
+    flags |= item.canRemove ? CanRemove : 0;
+    flags |= item.isConsumed ? IsConsumed : 0;
+    flags |= item.hidden ? Hidden : 0;
+    writer.Put(flags);
+
+    writer.Put(static_cast<uint32_t>(item.tags.size()));
+    for (int32_t tag : item.tags) {
+        writer.Put(tag);
+    }
+}
+
+static RoR2Item ReadItem(Reader& reader) {
+    RoR2Item item;
+    item.index = reader.Get<int32_t>();
+    item.displayName = reader.GetString();
+    item.name = reader.GetString();
+    item.nameToken = reader.GetString();
+    item.pickupToken = reader.GetString();
+    item.descriptionToken = reader.GetString();
+    item.loreToken = reader.GetString();
+    item.tier = static_cast<ItemTier_Value>(reader.Get<int32_t>());
+    item.tierName = reader.GetString();
+
+    uint8_t flags = reader.Get<uint8_t>();
+    item.isDroppable = (flags & IsDroppable) != 0;
+    item.canScrap = (flags & CanScrap) != 0;
+    item.canRestack = (flags & CanRestack) != 0;
+    item.canRemove = (flags & CanRemove) != 0;
+    item.isConsumed = (flags & IsConsumed) != 0;
+    item.hidden = (flags & Hidden) != 0;
+
+    uint32_t tagCount = reader.GetCount(sizeof(int32_t));
+    item.tags.reserve(tagCount);
+    for (uint32_t i = 0; i < tagCount; i++) {
+        item.tags.push_back(reader.Get<int32_t>());
+    }
+    return item;
+}
+
+std::vector<uint8_t> Serialize(const CatalogSnapshot& snapshot, uint64_t key) {
+    std::vector<uint8_t> file(sizeof(Header));
+    Writer writer(file);
+
+    writer.Put(snapshot.itemDefCount);
+    writer.Put(static_cast<uint32_t>(snapshot.items.size()));
+    for (const RoR2Item& item : snapshot.items) {
+        WriteItem(writer, item);
+    }
+    writer.Put(static_cast<uint32_t>(snapshot.specialItems.size()));
+    for (const auto& [name, index] : snapshot.specialItems) {
+        writer.PutString(name);
+        writer.Put(index);
+    }
+
+    writer.Put(snapshot.masterCount);
+    writer.Put(static_cast<uint32_t>(snapshot.enemies.size()));
+    for (const RoR2Enemy& enemy : snapshot.enemies) {
+        writer.Put<int32_t>(enemy.masterIndex);
+        writer.PutString(enemy.masterName);
+        writer.PutString(enemy.displayName);
+    }
+
+    writer.Put(snapshot.buffCount);
+    writer.Put(static_cast<uint32_t>(snapshot.elites.size()));
+    for (const auto& [name, buffIndex] : snapshot.elites) {
+        writer.PutString(name);
+        writer.Put(buffIndex);
+    }
+
+    writer.Put(snapshot.pickupCount);
+    writer.Put(static_cast<uint32_t>(snapshot.pickupNames.size()));
+    for (const auto& [pickupIndex, name] : snapshot.pickupNames) {
+        writer.Put(pickupIndex);
+        writer.PutString(name);
+    }
+
+    Header header{};
+    header.magic = Magic;
+    header.version = Version;
+    header.key = key;
+    header.payloadSize = file.size() - sizeof(Header);
+    header.payloadHash = Hash(file.data() + sizeof(Header), header.payloadSize);
+    std::memcpy(file.data(), &header, sizeof(Header));
+    return file;
+}
+
+bool Deserialize(const uint8_t* data, size_t size, uint64_t key, CatalogSnapshot& snapshot) {
+    if (!data || size < sizeof(Header))
+        return false;
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (header.magic != Magic || header.version != Version || header.key != key)
+        return false;
+
+    const uint8_t* payload = data + sizeof(Header);
+    if (header.payloadSize != size - sizeof(Header) || header.payloadHash != Hash(payload, header.payloadSize))
+        return false;
+
+    // Smallest encodings of each record, used to bound counts before reserving
+    constexpr size_t MinItemSize = sizeof(int32_t) * 2 + sizeof(uint32_t) * 8 + sizeof(uint8_t);
+    constexpr size_t MinNamedIndexSize = sizeof(uint32_t) + sizeof(int32_t);
+    constexpr size_t MinEnemySize = sizeof(int32_t) + sizeof(uint32_t) * 2;
+
+    Reader reader(payload, header.payloadSize);
+    CatalogSnapshot result;
+
+    result.itemDefCount = reader.Get<int32_t>();
+    uint32_t itemCount = reader.GetCount(MinItemSize);
+    result.items.reserve(itemCount);
+    for (uint32_t i = 0; i < itemCount && reader.Ok(); i++) {
+        result.items.push_back(ReadItem(reader));
+    }
+    uint32_t specialCount = reader.GetCount(MinNamedIndexSize);
+    for (uint32_t i = 0; i < specialCount && reader.Ok(); i++) {
+        std::string name = reader.GetString();
+        result.specialItems.emplace_back(std::move(name), reader.Get<int32_t>());
+    }
+
+    result.masterCount = reader.Get<int32_t>();
+    uint32_t enemyCount = reader.GetCount(MinEnemySize);
+    result.enemies.reserve(enemyCount);
+    for (uint32_t i = 0; i < enemyCount && reader.Ok(); i++) {
+        RoR2Enemy enemy;
+        enemy.masterIndex = reader.Get<int32_t>();
+        enemy.masterName = reader.GetString();
+        enemy.displayName = reader.GetString();
+        result.enemies.push_back(std::move(enemy));
+    }
+
+    result.buffCount = reader.Get<int32_t>();
+    uint32_t eliteCount = reader.GetCount(MinNamedIndexSize);
+    for (uint32_t i = 0; i < eliteCount && reader.Ok(); i++) {
+        std::string name = reader.GetString();
+        result.elites.emplace_back(std::move(name), reader.Get<int32_t>());
+    }
+
+    result.pickupCount = reader.Get<int32_t>();
+    uint32_t pickupNameCount = reader.GetCount(MinNamedIndexSize);
+    result.pickupNames.reserve(pickupNameCount);
+    for (uint32_t i = 0; i < pickupNameCount && reader.Ok(); i++) {
+        int32_t pickupIndex = reader.Get<int32_t>();
+        result.pickupNames.emplace_back(pickupIndex, reader.GetString());
+    }
+
+    if (!reader.Ok() || !reader.AtEnd())
+        return false;
+
+    snapshot = std::move(result);
+    return true;
+}
+} // namespace CatalogCache
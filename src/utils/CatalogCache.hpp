@@ -0,0 +1,44 @@
+#pragma once
+#include "utils/ModStructs.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The resolved game catalogs as stored in the on-disk cache. Each section keeps the length of the live catalog array it was
+// built from, so a loader can check it against the running game before trusting the rest. A count of -1 marks a section that
+// wasn't recorded.
+struct CatalogSnapshot {
+    int32_t itemDefCount = -1; // ContentManager._itemDefs length, what LoadItems returns
+    std::vector<RoR2Item> items;
+    std::vector<std::pair<std::string, int32_t>> specialItems; // name -> item index
+
+    int32_t masterCount = -1; // MasterCatalog.masterPrefabs length
+    std::vector<RoR2Enemy> enemies;
+
+    int32_t buffCount = -1;                              // BuffCatalog.buffDefs length
+    std::vector<std::pair<std::string, int32_t>> elites; // name -> buff index, in dropdown order without "None"
+
+    int32_t pickupCount = -1; // PickupCatalog.entries length
+    std::vector<std::pair<int32_t, std::string>> pickupNames;
+};
+
+// Versioned binary format of CatalogSnapshot. A fixed header (magic, version, key, payload size and payload hash) is followed
+// by the sections in declaration order, strings as a 32-bit length and the UTF-8 bytes. Values are stored in host byte order,
+// which is little-endian on the x86 and x64 builds that read and write the file.
+// Nothing here touches Windows or Mono so the format can be exercised on its own.
+namespace CatalogCache {
+constexpr uint32_t Magic = 0x43324D52; // "RM2C"
+constexpr uint32_t Version = 1;        // Bump whenever the payload layout changes
+constexpr uint64_t HashSeed = 0xCBF29CE484222325ull;
+
+// 64-bit FNV-1a, pass a previous result as seed to hash several buffers as one
+uint64_t Hash(const void* data, size_t size, uint64_t seed = HashSeed);
+
+std::vector<uint8_t> Serialize(const CatalogSnapshot& snapshot, uint64_t key);
+
+// False for a different magic, version or key, a payload that fails its hash, or anything that would read past size.
+// snapshot is only written on success.
+bool Deserialize(const uint8_t* data, size_t size, uint64_t key, CatalogSnapshot& snapshot);
+} // namespace CatalogCache
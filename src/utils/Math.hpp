@@ -82,8 +82,15 @@ struct alignas(16) Matrix4x4 {
 
     Matrix4x4() : m00(1), m01(0), m02(0), m03(0), m10(0), m11(1), m12(0), m13(0), m20(0), m21(0), m22(1), m23(0), m30(0), m31(0), m32(0), m33(1) {}
 };
+
+// Half-space dot(normal, p) + distance >= 0, normal is not necessarily unit length
+struct Plane {
+    Vector3 normal;
+    float distance;
+};
 } // namespace Math
 
 using Vector2 = Math::Vector2;
 using Vector3 = Math::Vector3;
 using Matrix4x4 = Math::Matrix4x4;
+using Plane = Math::Plane;
@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Bounded lock-free multi-producer single-consumer ring.
+// Each slot carries a sequence number: producers claim a position with one CAS and publish by bumping the slot's sequence,
+// the consumer only reads slots whose sequence says they are published. Push fails instead of blocking when the ring is full.
+template <typename T, size_t Capacity> class MpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "MpscRing capacity must be a power of two");
+
+  private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static constexpr size_t Mask = Capacity - 1;
+
+    std::unique_ptr<Slot[]> m_slots;
+    alignas(64) std::atomic<size_t> m_enqueuePos{0};
+    alignas(64) size_t m_dequeuePos = 0; // Consumer only
+
+  public:
+    MpscRing() : m_slots(new Slot[Capacity]) {
+        for (size_t i = 0; i < Capacity; i++) {
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // Safe from any thread, returns false when the ring is full
+    bool TryPush(const T& value) {
+        size_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot;
+        for (;;) {
+            slot = &m_slots[pos & Mask];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false; // Consumer has not freed this slot yet
+            } else {
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->value = value;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only, returns false when no published entry is waiting
+    bool TryPop(T& out) {
+        Slot& slot = m_slots[m_dequeuePos & Mask];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_dequeuePos + 1) < 0)
+            return false;
+
+        out = slot.value;
+        slot.sequence.store(m_dequeuePos + Capacity, std::memory_order_release);
+        m_dequeuePos++;
+        return true;
+    }
+};
@@ -0,0 +1,106 @@
+#include "PhaseGraph.hpp"
+#include "Logger.hpp"
+#include <thread>
+
+PhaseGraph::PhaseId PhaseGraph::Add(const char* name, std::vector<PhaseId> dependencies, std::function<bool()> run) {
+    PhaseId id = m_phases.size();
+    m_phases.push_back({name, std::move(run), {}, dependencies.size(), false, State::Pending, {}, {}});
+    for (PhaseId dependency : dependencies) {
+        m_phases[dependency].dependents.push_back(id);
+    }
+    return id;
+}
+
+// Called with m_mutex held
+void PhaseGraph::Finish(PhaseId id, State state) {
+    Phase& phase = m_phases[id];
+    phase.state = state;
+    phase.end = std::chrono::steady_clock::now();
+    m_finished++;
+
+    for (PhaseId dependentId : phase.dependents) {
+        Phase& dependent = m_phases[dependentId];
+        dependent.dependencyFailed |= state != State::Done;
+        if (--dependent.waitingOn != 0)
+            continue;
+
+        if (dependent.dependencyFailed) {
+            dependent.start = phase.end;
+            Finish(dependentId, State::Skipped);
+        } else {
+            m_ready.push_back(dependentId);
+        }
+    }
+}
+
+void PhaseGraph::WorkLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_readyChanged.wait(lock, [this]() { return !m_ready.empty() || m_finished == m_phases.size(); });
+        if (m_ready.empty())
+            return; // Everything finished
+
+        PhaseId id = m_ready.back();
+        m_ready.pop_back();
+        Phase& phase = m_phases[id];
+        phase.state = State::Running;
+        phase.start = std::chrono::steady_clock::now();
+
+        lock.unlock();
+        bool succeeded = phase.run();
+        lock.lock();
+
+        if (!succeeded) {
+            LOG_ERROR("Startup phase '%s' failed, skipping the phases that depend on it", phase.name);
+        }
+        Finish(id, succeeded ? State::Done : State::Failed);
+        m_readyChanged.notify_all();
+    }
+}
+
+void PhaseGraph::Run(size_t extraWorkers, const std::function<void()>& onWorkerStart, const std::function<void()>& onWorkerExit) {
+    m_start = std::chrono::steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (PhaseId id = 0; id < m_phases.size(); id++) {
+            if (m_phases[id].waitingOn == 0)
+                m_ready.push_back(id);
+        }
+    }
+
+    std::vector<std::thread> workers;
+    for (size_t i = 0; i < extraWorkers; i++) {
+        workers.emplace_back([&]() {
+            if (onWorkerStart)
+                onWorkerStart();
+            WorkLoop();
+            if (onWorkerExit)
+                onWorkerExit();
+        });
+    }
+
+    WorkLoop();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    m_end = std::chrono::steady_clock::now();
+}
+
+void PhaseGraph::LogReport() const {
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+    static const char* stateNames[] = {"pending", "running", "done", "FAILED", "skipped"};
+
+    LOG_INFO("Startup finished in %.1f ms", Milliseconds(m_end - m_start).count());
+    for (const Phase& phase : m_phases) {
+        LOG_INFO("  %-24s %-8s start +%9.1f ms  took %9.1f ms", phase.name, stateNames[static_cast<int>(phase.state)],
+                 Milliseconds(phase.start - m_start).count(), Milliseconds(phase.end - phase.start).count());
+    }
+}
+
+bool PhaseGraph::AllSucceeded() const {
+    for (const Phase& phase : m_phases) {
+        if (phase.state != State::Done)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+// Dependency graph of startup phases. Run() executes every phase once its dependencies have finished, spreading ready phases
+// over the calling thread plus a few workers. Workers sleep on a condition variable until a phase becomes ready, nothing polls.
+// A phase returning false fails it, and everything that depends on it is skipped.
+class PhaseGraph {
+  public:
+    using PhaseId = size_t;
+
+  private:
+    enum class State : uint8_t { Pending, Running, Done, Failed, Skipped };
+
+    struct Phase {
+        const char* name;
+        std::function<bool()> run;
+        std::vector<PhaseId> dependents;
+        size_t waitingOn; // Unfinished dependencies
+        bool dependencyFailed;
+        State state;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+    };
+
+    std::vector<Phase> m_phases;
+    std::mutex m_mutex;
+    std::condition_variable m_readyChanged;
+    std::vector<PhaseId> m_ready;
+    size_t m_finished = 0;
+    std::chrono::steady_clock::time_point m_start;
+    std::chrono::steady_clock::time_point m_end;
+
+    void Finish(PhaseId id, State state);
+    void WorkLoop();
+
+  public:
+    // Dependencies must already be added, which also keeps the graph acyclic
+    PhaseId Add(const char* name, std::vector<PhaseId> dependencies, std::function<bool()> run);
+
+    // Blocks until every phase has finished or been skipped. Extra worker threads call onWorkerStart/onWorkerExit around their work.
+    void Run(size_t extraWorkers, const std::function<void()>& onWorkerStart = nullptr, const std::function<void()>& onWorkerExit = nullptr);
+
+    // Per-phase wall-clock breakdown of the last Run, written to the log
+    void LogReport() const;
+    bool AllSucceeded() const;
+};
@@ -3,8 +3,11 @@
 #include "fonts/FontManager.hpp"
 #include "game/GameStructs.hpp"
 #include "hooks/hooks.hpp"
+#include <algorithm>
+#include <cfloat>
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <xmmintrin.h>
 
 namespace RenderUtils {
@@ -43,14 +46,13 @@ void PrecomputeViewProjection(Camera* camera, CachedCameraData* cachedCameraData
     cachedCameraData->viewProj.m33 = proj.m03 * view.m30 + proj.m13 * view.m31 + proj.m23 * view.m32 + proj.m33 * view.m33;
 }
 
-bool WorldToScreen(const std::shared_ptr<CachedCameraData>& cameraData, const Vector3& worldPos, ImVec2& screenPos, bool& onScreen) {
-    std::shared_ptr<CachedCameraData> cachedCameraData = std::atomic_load(&cameraData);
+bool WorldToScreen(const CachedCameraData& camera, const Vector3& worldPos, ImVec2& screenPos, bool& onScreen) {
     __m128 world = _mm_set_ps(1.0f, worldPos.z, worldPos.y, worldPos.x);
 
-    __m128 col0 = _mm_load_ps(&cachedCameraData->viewProj.m16[0]);
-    __m128 col1 = _mm_load_ps(&cachedCameraData->viewProj.m16[4]);
-    __m128 col2 = _mm_load_ps(&cachedCameraData->viewProj.m16[8]);
-    __m128 col3 = _mm_load_ps(&cachedCameraData->viewProj.m16[12]);
+    __m128 col0 = _mm_load_ps(&camera.viewProj.m16[0]);
+    __m128 col1 = _mm_load_ps(&camera.viewProj.m16[4]);
+    __m128 col2 = _mm_load_ps(&camera.viewProj.m16[8]);
+    __m128 col3 = _mm_load_ps(&camera.viewProj.m16[12]);
 
     __m128 x = _mm_shuffle_ps(world, world, _MM_SHUFFLE(0, 0, 0, 0));
     __m128 y = _mm_shuffle_ps(world, world, _MM_SHUFFLE(1, 1, 1, 1));
@@ -67,46 +69,180 @@ bool WorldToScreen(const std::shared_ptr<CachedCameraData>& cameraData, const Ve
     }
 
     const float inv_w = 1.0f / clip[3];
-    screenPos.x = (clip[0] * inv_w * 0.5f + 0.5f) * cachedCameraData->displayWidth;
-    screenPos.y = (1.0f - (clip[1] * inv_w * 0.5f + 0.5f)) * cachedCameraData->displayHeight;
+    screenPos.x = (clip[0] * inv_w * 0.5f + 0.5f) * camera.displayWidth;
+    screenPos.y = (1.0f - (clip[1] * inv_w * 0.5f + 0.5f)) * camera.displayHeight;
 
-    onScreen = (screenPos.x >= 0 && screenPos.x <= cachedCameraData->displayWidth && screenPos.y >= 0 && screenPos.y <= cachedCameraData->displayHeight);
+    onScreen = IsOnScreen(camera, screenPos);
 
     return true;
 }
 
-bool WorldToScreen(const std::shared_ptr<CachedCameraData>& cachedCameraData, const Vector3& worldPos, ImVec2& screenPos) {
+bool WorldToScreen(const CachedCameraData& camera, const Vector3& worldPos, ImVec2& screenPos) {
     bool onScreen = false;
-    return WorldToScreen(cachedCameraData, worldPos, screenPos, onScreen);
+    return WorldToScreen(camera, worldPos, screenPos, onScreen);
+}
+
+uint32_t WorldToScreen4(const CachedCameraData& camera, const Vector3* worldPos, ImVec2* screenPos) {
+    // Transpose the 4 points to SoA so each lane projects one point
+    __m128 x = _mm_setr_ps(worldPos[0].x, worldPos[1].x, worldPos[2].x, worldPos[3].x);
+    __m128 y = _mm_setr_ps(worldPos[0].y, worldPos[1].y, worldPos[2].y, worldPos[3].y);
+    __m128 z = _mm_setr_ps(worldPos[0].z, worldPos[1].z, worldPos[2].z, worldPos[3].z);
+
+    const float* m = camera.viewProj.m16;
+    __m128 clipX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[0]), x), _mm_mul_ps(_mm_set1_ps(m[4]), y)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[8]), z), _mm_set1_ps(m[12])));
+    __m128 clipY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[1]), x), _mm_mul_ps(_mm_set1_ps(m[5]), y)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[9]), z), _mm_set1_ps(m[13])));
+    __m128 clipZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[2]), x), _mm_mul_ps(_mm_set1_ps(m[6]), y)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[10]), z), _mm_set1_ps(m[14])));
+    __m128 clipW = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[3]), x), _mm_mul_ps(_mm_set1_ps(m[7]), y)),
+                              _mm_add_ps(_mm_mul_ps(_mm_set1_ps(m[11]), z), _mm_set1_ps(m[15])));
+
+    uint32_t behind = static_cast<uint32_t>(_mm_movemask_ps(_mm_cmplt_ps(clipZ, _mm_setzero_ps())));
+
+    __m128 half = _mm_set1_ps(0.5f);
+    __m128 invW = _mm_div_ps(_mm_set1_ps(1.0f), clipW);
+    __m128 ndcX = _mm_mul_ps(_mm_mul_ps(clipX, invW), half);
+    __m128 ndcY = _mm_mul_ps(_mm_mul_ps(clipY, invW), half);
+    __m128 sx = _mm_mul_ps(_mm_add_ps(ndcX, half), _mm_set1_ps(camera.displayWidth));
+    __m128 sy = _mm_mul_ps(_mm_sub_ps(half, ndcY), _mm_set1_ps(camera.displayHeight));
+
+    alignas(16) float outX[4];
+    alignas(16) float outY[4];
+    _mm_store_ps(outX, sx);
+    _mm_store_ps(outY, sy);
+    for (int i = 0; i < 4; i++) {
+        screenPos[i] = ImVec2(outX[i], outY[i]);
+    }
+
+    return ~behind & 0xF;
+}
+
+void WorldToScreenBatch(const CachedCameraData& camera, const Vector3* worldPos, size_t count, ImVec2* screenPos, uint32_t* inFrontMask) {
+    for (size_t word = 0; word < (count + 31) / 32; word++) {
+        inFrontMask[word] = 0;
+    }
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        uint32_t mask = WorldToScreen4(camera, worldPos + i, screenPos + i);
+        inFrontMask[i / 32] |= mask << (i % 32);
+    }
+
+    // Pad the tail out to a full group of 4
+    if (i < count) {
+        Vector3 tailIn[4];
+        ImVec2 tailOut[4];
+        size_t remaining = count - i;
+        for (size_t j = 0; j < 4; j++) {
+            tailIn[j] = worldPos[i + (j < remaining ? j : 0)];
+        }
+
+        uint32_t mask = WorldToScreen4(camera, tailIn, tailOut) & ((1u << remaining) - 1);
+        for (size_t j = 0; j < remaining; j++) {
+            screenPos[i + j] = tailOut[j];
+        }
+        inFrontMask[i / 32] |= mask << (i % 32);
+    }
+}
+
+void ExtractFrustumPlanes(const CachedCameraData& camera, Plane planes[5]) {
+    // Rows of the column-major view-projection matrix
+    const float* m = camera.viewProj.m16;
+    auto row = [m](int r) { return Plane{Vector3(m[r], m[4 + r], m[8 + r]), m[12 + r]}; };
+    auto combine = [](const Plane& a, const Plane& b, float sign) { return Plane{a.normal + b.normal * sign, a.distance + b.distance * sign}; };
+
+    Plane rowX = row(0);
+    Plane rowY = row(1);
+    Plane rowW = row(3);
+
+    planes[0] = row(2); // clip z >= 0
+    planes[1] = combine(rowW, rowX, 1.0f);
+    planes[2] = combine(rowW, rowX, -1.0f);
+    planes[3] = combine(rowW, rowY, 1.0f);
+    planes[4] = combine(rowW, rowY, -1.0f);
+}
+
+// Draws pre-measured ESP text at pos (top left)
+static void DrawESPText(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, const char* begin, const char* end) {
+    ImFont* font = FontManager::GetESPFont();
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+
+    if (shadow) {
+        // The baked outline is black and shares the text alpha, other shadow colours keep the offset passes
+        ImFont* outlinedFont = FontManager::GetESPOutlinedFont();
+        if (outlinedFont && (shadowColor & ~IM_COL32_A_MASK) == 0 && (shadowColor & IM_COL32_A_MASK) == (color & IM_COL32_A_MASK)) {
+            drawList->AddText(outlinedFont, FontManager::ESPFontSize, pos, color, begin, end);
+            return;
+        }
+
+        float offset = 1.0f * FontManager::ESPFontSize / font->FontSize;
+        drawList->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x + offset, pos.y + offset), shadowColor, begin, end);
+        drawList->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x - offset, pos.y - offset), shadowColor, begin, end);
+        drawList->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x + offset, pos.y - offset), shadowColor, begin, end);
+        drawList->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x - offset, pos.y + offset), shadowColor, begin, end);
+    }
+
+    drawList->AddText(font, FontManager::ESPFontSize, pos, color, begin, end);
 }
 
 ImVec2 RenderText(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, const char* text, ...) {
     va_list args;
     va_start(args, text);
     char buffer[1024];
-    vsnprintf(buffer, sizeof(buffer), text, args);
+    int length = vsnprintf(buffer, sizeof(buffer), text, args);
     va_end(args);
 
-    ImFont* font = FontManager::GetESPFont();
-    float scale = FontManager::ESPFontSize / font->FontSize;
+    if (length < 0)
+        return ImVec2(0, 0);
+    return RenderTextUnformatted(pos, color, shadowColor, shadow, centered, buffer, buffer + std::min(length, static_cast<int>(sizeof(buffer) - 1)));
+}
+
+ImVec2 RenderTextUnformatted(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, const char* text, const char* textEnd) {
+    if (!textEnd) {
+        textEnd = text + strlen(text);
+    }
 
-    ImVec2 textSize = ImGui::CalcTextSize(buffer);
-    textSize.x *= scale;
-    textSize.y *= scale;
+    ImVec2 textSize = FontManager::GetESPFont()->CalcTextSizeA(FontManager::ESPFontSize, FLT_MAX, 0.0f, text, textEnd);
     if (centered) {
         pos.x -= textSize.x / 2;
     }
 
-    if (shadow) {
-        float offset = 1.0f * scale;
-        ImGui::GetBackgroundDrawList()->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x + offset, pos.y + offset), shadowColor, buffer);
-        ImGui::GetBackgroundDrawList()->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x - offset, pos.y - offset), shadowColor, buffer);
-        ImGui::GetBackgroundDrawList()->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x + offset, pos.y - offset), shadowColor, buffer);
-        ImGui::GetBackgroundDrawList()->AddText(font, FontManager::ESPFontSize, ImVec2(pos.x - offset, pos.y + offset), shadowColor, buffer);
+    DrawESPText(pos, color, shadowColor, shadow, text, textEnd);
+    return textSize;
+}
+
+void SetLabelText(CachedLabel& label, const char* text, ...) {
+    va_list args;
+    va_start(args, text);
+    char buffer[1024];
+    int length = vsnprintf(buffer, sizeof(buffer), text, args);
+    va_end(args);
+
+    label.text.assign(buffer, std::min(std::max(length, 0), static_cast<int>(sizeof(buffer) - 1)));
+    label.measuredFont = nullptr;
+    MeasureLabel(label);
+}
+
+ImVec2 MeasureLabel(CachedLabel& label) {
+    ImFont* font = FontManager::GetESPFont();
+    if (label.measuredFont != font || label.measuredFontSize != FontManager::ESPFontSize) {
+        const char* begin = label.text.c_str();
+        label.size = font->CalcTextSizeA(FontManager::ESPFontSize, FLT_MAX, 0.0f, begin, begin + label.text.size());
+        label.measuredFont = font;
+        label.measuredFontSize = FontManager::ESPFontSize;
     }
+    return label.size;
+}
 
-    ImGui::GetBackgroundDrawList()->AddText(font, FontManager::ESPFontSize, pos, color, buffer);
+ImVec2 RenderLabel(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, CachedLabel& label) {
+    ImVec2 textSize = MeasureLabel(label);
+    if (centered) {
+        pos.x -= textSize.x / 2;
+    }
 
+    const char* begin = label.text.c_str();
+    DrawESPText(pos, color, shadowColor, shadow, begin, begin + label.text.size());
     return textSize;
 }
 
@@ -120,6 +256,12 @@ void RenderCircle(ImVec2 center, float radius, ImU32 color, int segments, float
     ImGui::GetBackgroundDrawList()->AddCircle(center, radius, color, segments, thickness);
 }
 
+void RenderDot(ImVec2 center, float radius, ImU32 color) {
+    ImDrawList* drawList = ImGui::GetBackgroundDrawList();
+    drawList->AddCircleFilled(center, radius + 1.0f, IM_COL32(0, 0, 0, (color >> IM_COL32_A_SHIFT) & 0xFF), 8);
+    drawList->AddCircleFilled(center, radius, color, 8);
+}
+
 void RenderHealthbar(ImVec2 pos, ImVec2 size, float health, float maxHealth, ImU32 fillColor, ImU32 bgColor) {
     if (maxHealth <= 0)
         return;
@@ -1,16 +1,54 @@
 #pragma once
 #include "Math.hpp"
 #include "ModStructs.hpp"
+#include <cstdint>
 #include <imgui.h>
 #include <memory>
+#include <string>
+
+// Formatted label text plus its measured size. Owners key it on the quantised values it displays
+// and only reformat when Changed() reports a difference, the render path then just draws the stored string.
+struct CachedLabel {
+    std::string text;
+    ImVec2 size;
+    int64_t key[2] = {INT64_MIN, INT64_MIN};
+    const ImFont* measuredFont = nullptr; // Size is re-measured when the ESP font or size changes
+    float measuredFontSize = 0.0f;
+
+    bool Changed(int64_t key0, int64_t key1 = 0) {
+        if (key[0] == key0 && key[1] == key1 && measuredFont)
+            return false;
+        key[0] = key0;
+        key[1] = key1;
+        return true;
+    }
+};
 
 namespace RenderUtils {
 void PrecomputeViewProjection(Camera* camera, CachedCameraData* cachedCameraData);
-bool WorldToScreen(const std::shared_ptr<CachedCameraData>& cameraData, const Vector3& worldPos, ImVec2& screenPos, bool& onScreen);
-bool WorldToScreen(const std::shared_ptr<CachedCameraData>& cameraData, const Vector3& worldPos, ImVec2& screenPos);
+// Projection functions take the camera snapshot by reference; load it once per frame/update and pass it down
+bool WorldToScreen(const CachedCameraData& camera, const Vector3& worldPos, ImVec2& screenPos, bool& onScreen);
+bool WorldToScreen(const CachedCameraData& camera, const Vector3& worldPos, ImVec2& screenPos);
+// Projects 4 points at once, returns a 4-bit mask of the points in front of the camera
+uint32_t WorldToScreen4(const CachedCameraData& camera, const Vector3* worldPos, ImVec2* screenPos);
+// Projects count points, bit i of inFrontMask[i / 32] is set when point i is in front of the camera.
+// inFrontMask must hold (count + 31) / 32 words.
+void WorldToScreenBatch(const CachedCameraData& camera, const Vector3* worldPos, size_t count, ImVec2* screenPos, uint32_t* inFrontMask);
+// Fills planes with the near, left, right, bottom and top planes of the camera snapshot, near matches the WorldToScreen in-front test
+void ExtractFrustumPlanes(const CachedCameraData& camera, Plane planes[5]);
+inline bool IsOnScreen(const CachedCameraData& camera, const ImVec2& screenPos) {
+    return screenPos.x >= 0 && screenPos.x <= camera.displayWidth && screenPos.y >= 0 && screenPos.y <= camera.displayHeight;
+}
 ImVec2 RenderText(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, const char* text, ...);
+// Fast path for text that is already formatted, skips the printf pass and copy. textEnd may be null for NUL-terminated text.
+ImVec2 RenderTextUnformatted(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, const char* text, const char* textEnd = nullptr);
+// Formats into the label and measures it with the ESP font
+void SetLabelText(CachedLabel& label, const char* text, ...);
+ImVec2 MeasureLabel(CachedLabel& label);
+ImVec2 RenderLabel(ImVec2 pos, ImU32 color, ImU32 shadowColor, bool shadow, bool centered, CachedLabel& label);
 void RenderBox(ImVec2 pos, ImVec2 size, ImU32 color, float thickness = 1.0f);
 void RenderLine(ImVec2 start, ImVec2 end, ImU32 color, float thickness = 1.0f);
 void RenderCircle(ImVec2 center, float radius, ImU32 color, int segments = 12, float thickness = 1.0f);
+void RenderDot(ImVec2 center, float radius, ImU32 color);
 void RenderHealthbar(ImVec2 pos, ImVec2 size, float health, float maxHealth, ImU32 fillColor, ImU32 bgColor);
 } // namespace RenderUtils
@@ -0,0 +1,167 @@
+#pragma once
+#include "Math.hpp"
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// Handle into a SlotMapStore. Handles to removed objects fail the generation check even after their slot is reused.
+struct SlotHandle {
+    uint32_t index = UINT32_MAX;
+    uint32_t generation = 0;
+};
+
+// Generational slot map with structure-of-arrays storage for tracked game objects.
+// Hot per-update fields (object pointer, position, category, flags) live in dense contiguous columns,
+// per-object cold data (display strings etc.) lives in a side table whose records have stable addresses.
+// Insert and remove are O(1); removal swaps the last dense element into the hole, so dense order is not stable.
+// With a retire sink set, removed cold records are moved there instead of being destroyed, for readers that may still hold them.
+template <typename TCold> class SlotMapStore {
+  private:
+    struct Slot {
+        uint32_t dense;
+        uint32_t generation;
+    };
+
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_denseToSlot;
+
+    std::vector<void*> m_objects;
+    std::vector<Vector3> m_positions;
+    std::vector<uint8_t> m_categories;
+    std::vector<uint8_t> m_flags;
+    std::vector<std::unique_ptr<TCold>> m_cold;
+
+    std::unordered_map<const void*, SlotHandle> m_objectLookup;
+    std::vector<std::unique_ptr<TCold>>* m_retired = nullptr;
+
+    void Retire(std::unique_ptr<TCold>& cold) {
+        if (m_retired && cold)
+            m_retired->push_back(std::move(cold));
+    }
+
+  public:
+    // Removed cold records are appended to retired from now on, nullptr destroys them right away
+    void SetRetireSink(std::vector<std::unique_ptr<TCold>>* retired) { m_retired = retired; }
+
+    // Tracks object, replacing any existing entry for the same object
+    SlotHandle Insert(void* object, const Vector3& position, uint8_t category, uint8_t flags, std::unique_ptr<TCold> cold) {
+        RemoveObject(object);
+
+        uint32_t slotIndex;
+        if (!m_freeSlots.empty()) {
+            slotIndex = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        } else {
+            slotIndex = static_cast<uint32_t>(m_slots.size());
+            m_slots.push_back({0, 0});
+        }
+
+        uint32_t dense = static_cast<uint32_t>(m_objects.size());
+        m_slots[slotIndex].dense = dense;
+        m_denseToSlot.push_back(slotIndex);
+        m_objects.push_back(object);
+        m_positions.push_back(position);
+        m_categories.push_back(category);
+        m_flags.push_back(flags);
+        m_cold.push_back(std::move(cold));
+
+        SlotHandle handle{slotIndex, m_slots[slotIndex].generation};
+        m_objectLookup[object] = handle;
+        return handle;
+    }
+
+    void RemoveAt(uint32_t dense) {
+        if (dense >= m_objects.size())
+            return;
+
+        uint32_t slotIndex = m_denseToSlot[dense];
+        uint32_t last = static_cast<uint32_t>(m_objects.size()) - 1;
+
+        m_objectLookup.erase(m_objects[dense]);
+        Retire(m_cold[dense]);
+
+        if (dense != last) {
+            m_objects[dense] = m_objects[last];
+            m_positions[dense] = m_positions[last];
+            m_categories[dense] = m_categories[last];
+            m_flags[dense] = m_flags[last];
+            m_cold[dense] = std::move(m_cold[last]);
+            m_denseToSlot[dense] = m_denseToSlot[last];
+            m_slots[m_denseToSlot[dense]].dense = dense;
+        }
+
+        m_objects.pop_back();
+        m_positions.pop_back();
+        m_categories.pop_back();
+        m_flags.pop_back();
+        m_cold.pop_back();
+        m_denseToSlot.pop_back();
+
+        m_slots[slotIndex].generation++;
+        m_freeSlots.push_back(slotIndex);
+    }
+
+    bool Remove(SlotHandle handle) {
+        uint32_t dense = GetDenseIndex(handle);
+        if (dense == UINT32_MAX)
+            return false;
+        RemoveAt(dense);
+        return true;
+    }
+
+    bool RemoveObject(const void* object) { return Remove(Find(object)); }
+
+    SlotHandle Find(const void* object) const {
+        auto it = m_objectLookup.find(object);
+        return it != m_objectLookup.end() ? it->second : SlotHandle{};
+    }
+
+    // Dense index of a live handle, UINT32_MAX for stale or invalid handles
+    uint32_t GetDenseIndex(SlotHandle handle) const {
+        if (handle.index >= m_slots.size() || m_slots[handle.index].generation != handle.generation)
+            return UINT32_MAX;
+        return m_slots[handle.index].dense;
+    }
+
+    SlotHandle GetHandle(uint32_t dense) const {
+        uint32_t slotIndex = m_denseToSlot[dense];
+        return SlotHandle{slotIndex, m_slots[slotIndex].generation};
+    }
+
+    bool IsValid(SlotHandle handle) const { return GetDenseIndex(handle) != UINT32_MAX; }
+
+    void Clear() {
+        // Bump every live slot so outstanding handles go stale
+        for (uint32_t slotIndex : m_denseToSlot) {
+            m_slots[slotIndex].generation++;
+            m_freeSlots.push_back(slotIndex);
+        }
+        m_denseToSlot.clear();
+        m_objects.clear();
+        m_positions.clear();
+        m_categories.clear();
+        m_flags.clear();
+        for (std::unique_ptr<TCold>& cold : m_cold) {
+            Retire(cold);
+        }
+        m_cold.clear();
+        m_objectLookup.clear();
+    }
+
+    uint32_t Size() const { return static_cast<uint32_t>(m_objects.size()); }
+    bool Empty() const { return m_objects.empty(); }
+
+    // Dense column access, valid for indices in [0, Size())
+    void* GetObject(uint32_t dense) const { return m_objects[dense]; }
+    Vector3& Position(uint32_t dense) { return m_positions[dense]; }
+    uint8_t Category(uint32_t dense) const { return m_categories[dense]; }
+    uint8_t& Flags(uint32_t dense) { return m_flags[dense]; }
+    TCold* Cold(uint32_t dense) const { return m_cold[dense].get(); }
+
+    void* const* Objects() const { return m_objects.data(); }
+    const Vector3* Positions() const { return m_positions.data(); }
+    const uint8_t* Categories() const { return m_categories.data(); }
+    const uint8_t* FlagsData() const { return m_flags.data(); }
+};
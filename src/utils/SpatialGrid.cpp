@@ -0,0 +1,190 @@
+#include "SpatialGrid.hpp"
+#include <algorithm>
+#include <cmath>
+
+static uint64_t PackCellKey(int32_t x, int32_t y, int32_t z) {
+    // 21 bits per axis, enough for +-1M cells
+    return (static_cast<uint64_t>(x & 0x1FFFFF) << 42) | (static_cast<uint64_t>(y & 0x1FFFFF) << 21) | static_cast<uint64_t>(z & 0x1FFFFF);
+}
+
+static float DistanceSquaredToBox(const Vector3& point, const Vector3& boxMin, const Vector3& boxMax) {
+    float dx = std::max(std::max(boxMin.x - point.x, 0.0f), point.x - boxMax.x);
+    float dy = std::max(std::max(boxMin.y - point.y, 0.0f), point.y - boxMax.y);
+    float dz = std::max(std::max(boxMin.z - point.z, 0.0f), point.z - boxMax.z);
+    return dx * dx + dy * dy + dz * dz;
+}
+
+SpatialGrid::SpatialGrid(float cellSize) : m_cellSize(cellSize), m_invCellSize(1.0f / cellSize) {}
+
+uint32_t SpatialGrid::GetOrCreateCell(const Vector3& position) {
+    int32_t x = static_cast<int32_t>(std::floor(position.x * m_invCellSize));
+    int32_t y = static_cast<int32_t>(std::floor(position.y * m_invCellSize));
+    int32_t z = static_cast<int32_t>(std::floor(position.z * m_invCellSize));
+
+    auto [it, inserted] = m_cellLookup.try_emplace(PackCellKey(x, y, z), static_cast<uint32_t>(m_cells.size()));
+    if (inserted) {
+        m_cells.push_back(Cell{x, y, z, 0, {}});
+    }
+    return it->second;
+}
+
+const SpatialGrid::Location* SpatialGrid::FindLocation(SlotHandle handle) const {
+    if (handle.index >= m_locations.size())
+        return nullptr;
+    const Location& location = m_locations[handle.index];
+    if (!location.valid || location.generation != handle.generation)
+        return nullptr;
+    return &location;
+}
+
+void SpatialGrid::GetCellBounds(const Cell& cell, Vector3& outMin, Vector3& outMax) const {
+    outMin = Vector3(cell.x * m_cellSize, cell.y * m_cellSize, cell.z * m_cellSize);
+    outMax = Vector3(outMin.x + m_cellSize, outMin.y + m_cellSize, outMin.z + m_cellSize);
+}
+
+void SpatialGrid::Insert(SlotHandle handle, const Vector3& position, uint8_t category) {
+    if (handle.index == UINT32_MAX)
+        return;
+
+    // Drop whatever still occupies this slot, including entries of an older generation
+    if (handle.index < m_locations.size() && m_locations[handle.index].valid) {
+        m_locations[handle.index].valid = false;
+        RemoveFromCell(m_locations[handle.index].cell, m_locations[handle.index].entry);
+    }
+
+    uint32_t cellIndex = GetOrCreateCell(position);
+    Cell& cell = m_cells[cellIndex];
+    cell.entries.push_back(Entry{handle, position, category});
+    cell.categoryMask |= 1u << (category & 31);
+
+    if (handle.index >= m_locations.size()) {
+        m_locations.resize(handle.index + 1, Location{0, 0, 0, false});
+    }
+    m_locations[handle.index] = Location{cellIndex, static_cast<uint32_t>(cell.entries.size() - 1), handle.generation, true};
+}
+
+void SpatialGrid::Move(SlotHandle handle, const Vector3& position) {
+    const Location* location = FindLocation(handle);
+    if (!location)
+        return;
+
+    Cell& cell = m_cells[location->cell];
+    Entry& entry = cell.entries[location->entry];
+    int32_t x = static_cast<int32_t>(std::floor(position.x * m_invCellSize));
+    int32_t y = static_cast<int32_t>(std::floor(position.y * m_invCellSize));
+    int32_t z = static_cast<int32_t>(std::floor(position.z * m_invCellSize));
+    if (x == cell.x && y == cell.y && z == cell.z) {
+        entry.position = position;
+        return;
+    }
+
+    uint8_t category = entry.category;
+    Remove(handle);
+    Insert(handle, position, category);
+}
+
+void SpatialGrid::RemoveFromCell(uint32_t cellIndex, uint32_t entryIndex) {
+    Cell& cell = m_cells[cellIndex];
+    uint32_t last = static_cast<uint32_t>(cell.entries.size()) - 1;
+    if (entryIndex != last) {
+        cell.entries[entryIndex] = cell.entries[last];
+        m_locations[cell.entries[entryIndex].handle.index].entry = entryIndex;
+    }
+    cell.entries.pop_back();
+
+    cell.categoryMask = 0;
+    for (const Entry& entry : cell.entries) {
+        cell.categoryMask |= 1u << (entry.category & 31);
+    }
+}
+
+void SpatialGrid::Remove(SlotHandle handle) {
+    const Location* location = FindLocation(handle);
+    if (!location)
+        return;
+
+    m_locations[handle.index].valid = false;
+    RemoveFromCell(location->cell, location->entry);
+}
+
+void SpatialGrid::Clear() {
+    m_cells.clear();
+    m_cellLookup.clear();
+    m_locations.clear();
+}
+
+void SpatialGrid::QueryFrustum(const Vector3& center, float maxDistance, const Plane* planes, int planeCount, std::vector<SlotHandle>& out) const {
+    float maxDistanceSq = maxDistance * maxDistance;
+
+    for (const Cell& cell : m_cells) {
+        if (cell.entries.empty())
+            continue;
+
+        Vector3 cellMin, cellMax;
+        GetCellBounds(cell, cellMin, cellMax);
+        if (DistanceSquaredToBox(center, cellMin, cellMax) > maxDistanceSq)
+            continue;
+
+        // Reject the cell if its corner furthest along the plane normal is still outside
+        bool inside = true;
+        for (int i = 0; i < planeCount && inside; i++) {
+            const Plane& plane = planes[i];
+            Vector3 corner(plane.normal.x >= 0 ? cellMax.x : cellMin.x, plane.normal.y >= 0 ? cellMax.y : cellMin.y,
+                           plane.normal.z >= 0 ? cellMax.z : cellMin.z);
+            inside = plane.normal.Dot(corner) + plane.distance >= 0;
+        }
+        if (!inside)
+            continue;
+
+        for (const Entry& entry : cell.entries) {
+            out.push_back(entry.handle);
+        }
+    }
+}
+
+void SpatialGrid::QueryNearest(const Vector3& center, uint8_t category, size_t count, std::vector<SlotHandle>& out) const {
+    out.clear();
+    if (count == 0)
+        return;
+
+    uint32_t categoryBit = 1u << (category & 31);
+    m_cellScratch.clear();
+    for (uint32_t i = 0; i < m_cells.size(); i++) {
+        const Cell& cell = m_cells[i];
+        if (!(cell.categoryMask & categoryBit))
+            continue;
+
+        Vector3 cellMin, cellMax;
+        GetCellBounds(cell, cellMin, cellMax);
+        m_cellScratch.emplace_back(DistanceSquaredToBox(center, cellMin, cellMax), i);
+    }
+    std::sort(m_cellScratch.begin(), m_cellScratch.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    // Max-heap of the best count candidates so far, stop once no remaining cell can beat the worst of them
+    auto heapCompare = [](const std::pair<float, SlotHandle>& a, const std::pair<float, SlotHandle>& b) { return a.first < b.first; };
+    m_nearestScratch.clear();
+    for (const auto& [cellDistanceSq, cellIndex] : m_cellScratch) {
+        if (m_nearestScratch.size() == count && cellDistanceSq > m_nearestScratch.front().first)
+            break;
+
+        for (const Entry& entry : m_cells[cellIndex].entries) {
+            if (entry.category != category)
+                continue;
+
+            float distanceSq = entry.position.DistanceSquared(center);
+            if (m_nearestScratch.size() < count) {
+                m_nearestScratch.emplace_back(distanceSq, entry.handle);
+                std::push_heap(m_nearestScratch.begin(), m_nearestScratch.end(), heapCompare);
+            } else if (distanceSq < m_nearestScratch.front().first) {
+                std::pop_heap(m_nearestScratch.begin(), m_nearestScratch.end(), heapCompare);
+                m_nearestScratch.back() = {distanceSq, entry.handle};
+                std::push_heap(m_nearestScratch.begin(), m_nearestScratch.end(), heapCompare);
+            }
+        }
+    }
+
+    std::sort_heap(m_nearestScratch.begin(), m_nearestScratch.end(), heapCompare);
+    for (const auto& candidate : m_nearestScratch) {
+        out.push_back(candidate.second);
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Math.hpp"
+#include "SlotMapStore.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Uniform 3D grid over tracked objects, keyed by SlotMapStore handles.
+// Only occupied cells are stored, so queries cost O(occupied cells) plus the entries of the cells that pass.
+class SpatialGrid {
+  private:
+    struct Entry {
+        SlotHandle handle;
+        Vector3 position;
+        uint8_t category;
+    };
+
+    struct Cell {
+        int32_t x, y, z;
+        uint32_t categoryMask; // Bit per category present in the cell
+        std::vector<Entry> entries;
+    };
+
+    // Where a handle's entry lives, indexed by SlotHandle::index
+    struct Location {
+        uint32_t cell;
+        uint32_t entry;
+        uint32_t generation;
+        bool valid;
+    };
+
+    float m_cellSize;
+    float m_invCellSize;
+    std::vector<Cell> m_cells;
+    std::unordered_map<uint64_t, uint32_t> m_cellLookup;
+    std::vector<Location> m_locations;
+
+    mutable std::vector<std::pair<float, uint32_t>> m_cellScratch;
+    mutable std::vector<std::pair<float, SlotHandle>> m_nearestScratch;
+
+    uint32_t GetOrCreateCell(const Vector3& position);
+    const Location* FindLocation(SlotHandle handle) const;
+    void RemoveFromCell(uint32_t cellIndex, uint32_t entryIndex);
+    void GetCellBounds(const Cell& cell, Vector3& outMin, Vector3& outMax) const;
+
+  public:
+    explicit SpatialGrid(float cellSize = 32.0f);
+
+    void Insert(SlotHandle handle, const Vector3& position, uint8_t category);
+    // Updates the stored position, changing cell only when the object crossed a cell border
+    void Move(SlotHandle handle, const Vector3& position);
+    void Remove(SlotHandle handle);
+    void Clear();
+
+    // Appends every entry in a cell that overlaps the sphere around center and lies inside all planes.
+    // Culling is per cell, callers still test the returned objects individually.
+    void QueryFrustum(const Vector3& center, float maxDistance, const Plane* planes, int planeCount, std::vector<SlotHandle>& out) const;
+    // Replaces out with up to count entries of category, nearest first
+    void QueryNearest(const Vector3& center, uint8_t category, size_t count, std::vector<SlotHandle>& out) const;
+
+    size_t GetCellCount() const { return m_cells.size(); }
+};
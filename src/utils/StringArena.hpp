@@ -0,0 +1,36 @@
+#pragma once
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Append-only storage for strings that are handed out as views. Blocks are never moved or freed before the arena itself,
+// so every view returned by Store stays valid for the arena's whole lifetime. Not thread-safe, callers serialize access.
+class StringArena {
+  private:
+    static constexpr size_t BlockSize = 16 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    size_t m_blockUsed = BlockSize; // Bytes used in m_blocks.back(), starts full so the first Store allocates
+
+    char* Allocate(size_t size, size_t align) {
+        size_t offset = (m_blockUsed + align - 1) & ~(align - 1);
+        if (offset + size > BlockSize) {
+            // Oversized strings get a block of their own
+            m_blocks.push_back(std::make_unique<char[]>(std::max(size, BlockSize)));
+            offset = 0;
+        }
+        m_blockUsed = offset + size;
+        return m_blocks.back().get() + offset;
+    }
+
+  public:
+    template <typename Char> std::basic_string_view<Char> Store(std::basic_string_view<Char> text) {
+        if (text.empty())
+            return {};
+        char* data = Allocate(text.size() * sizeof(Char), alignof(Char));
+        std::memcpy(data, text.data(), text.size() * sizeof(Char));
+        return {reinterpret_cast<const Char*>(data), text.size()};
+    }
+};
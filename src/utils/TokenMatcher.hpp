@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Aho-Corasick automaton over up to 64 substring patterns, built entirely at compile time.
+// Match() scans the text once and returns a bitmask with bit i set when patterns[i] occurs anywhere in it.
+// Tokens are upper-case game identifiers, so the alphabet is A-Z, 0-9 and '_' with every other byte folded into one symbol.
+template <size_t PatternCount, size_t MaxStates> class TokenMatcher {
+    static_assert(PatternCount <= 64, "TokenMatcher reports matches in a 64-bit mask");
+
+  public:
+    static constexpr int AlphabetSize = 38;
+
+    constexpr explicit TokenMatcher(const std::array<std::string_view, PatternCount>& patterns) : m_next{}, m_output{}, m_stateCount(1) {
+        // Trie of all patterns, m_next doubles as the goto function until the failure links are folded in
+        for (size_t p = 0; p < PatternCount; p++) {
+            uint16_t state = 0;
+            for (char c : patterns[p]) {
+                int symbol = Symbol(c);
+                if (m_next[state][symbol] == 0) {
+                    m_next[state][symbol] = static_cast<uint16_t>(m_stateCount++);
+                }
+                state = m_next[state][symbol];
+            }
+            m_output[state] |= uint64_t(1) << p;
+        }
+
+        // Breadth-first pass turning the trie into a full DFA: missing edges follow the failure link,
+        // and each state inherits the outputs of its failure state
+        std::array<uint16_t, MaxStates> fail{};
+        std::array<uint16_t, MaxStates> queue{};
+        size_t head = 0, tail = 0;
+        for (int symbol = 0; symbol < AlphabetSize; symbol++) {
+            uint16_t child = m_next[0][symbol];
+            if (child != 0) {
+                fail[child] = 0;
+                queue[tail++] = child;
+            }
+        }
+
+        while (head < tail) {
+            uint16_t state = queue[head++];
+            m_output[state] |= m_output[fail[state]];
+            for (int symbol = 0; symbol < AlphabetSize; symbol++) {
+                uint16_t child = m_next[state][symbol];
+                if (child != 0) {
+                    fail[child] = m_next[fail[state]][symbol];
+                    queue[tail++] = child;
+                } else {
+                    m_next[state][symbol] = m_next[fail[state]][symbol];
+                }
+            }
+        }
+    }
+
+    constexpr uint64_t Match(std::string_view text) const {
+        uint64_t matches = 0;
+        uint16_t state = 0;
+        for (char c : text) {
+            state = m_next[state][Symbol(c)];
+            matches |= m_output[state];
+        }
+        return matches;
+    }
+
+    constexpr size_t GetStateCount() const { return m_stateCount; }
+
+    // Bit for the pattern at index, for building rule masks next to the pattern table
+    static constexpr uint64_t Bit(size_t index) { return uint64_t(1) << index; }
+
+  private:
+    static constexpr int Symbol(char c) {
+        if (c >= 'A' && c <= 'Z')
+            return c - 'A';
+        if (c >= '0' && c <= '9')
+            return 26 + (c - '0');
+        if (c == '_')
+            return 36;
+        return 37;
+    }
+
+    std::array<std::array<uint16_t, AlphabetSize>, MaxStates> m_next;
+    std::array<uint64_t, MaxStates> m_output;
+    size_t m_stateCount;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Single-producer single-consumer triple buffer. The writer fills its private buffer and publishes it with one atomic exchange,
+// the reader picks up the newest published buffer with another. Neither side ever waits, and buffers are reused forever,
+// so anything they own (vector capacity etc.) is only allocated while it is still growing.
+// Every publish is numbered and the reader acknowledges the number of the buffer it holds, so the writer can tell
+// when nothing referenced by older buffers can still be read.
+template <typename T> class TripleBuffer {
+  private:
+    static constexpr uint8_t IndexMask = 0x3;
+    static constexpr uint8_t FreshBit = 0x4; // Set while the ready buffer holds data the reader has not taken yet
+
+    T m_buffers[3];
+    uint64_t m_sequences[3] = {}; // Publish number of each buffer, written before the buffer is handed over
+    std::atomic<uint8_t> m_ready{1};
+    std::atomic<uint64_t> m_acknowledged{0}; // Publish number of the buffer the reader holds
+    uint64_t m_published = 0;                // Writer only
+    uint8_t m_write = 0;                     // Writer only
+    uint8_t m_read = 2;                      // Reader only
+
+  public:
+    // Writer: buffer to fill for the next Publish, still holds whatever was written to it two publishes ago
+    T& GetWriteBuffer() { return m_buffers[m_write]; }
+
+    // Writer: hands the write buffer to the reader and takes back the stale ready buffer
+    void Publish() {
+        m_sequences[m_write] = ++m_published;
+        uint8_t previous = m_ready.exchange(m_write | FreshBit, std::memory_order_acq_rel);
+        m_write = previous & IndexMask;
+    }
+
+    // Writer: number of the last Publish, 0 before the first one
+    uint64_t PublishedSequence() const { return m_published; }
+
+    // Writer: number of the buffer the reader currently holds. The reader only ever moves to newer buffers,
+    // so nothing that was unreachable from the buffer with this number can be read again.
+    uint64_t AcknowledgedSequence() const { return m_acknowledged.load(std::memory_order_acquire); }
+
+    // Reader: swaps in the newest published buffer if there is one, otherwise keeps returning the current one
+    const T& Acquire() {
+        if (m_ready.load(std::memory_order_relaxed) & FreshBit) {
+            uint8_t previous = m_ready.exchange(m_read, std::memory_order_acq_rel);
+            m_read = previous & IndexMask;
+            m_acknowledged.store(m_sequences[m_read], std::memory_order_release);
+        }
+        return m_buffers[m_read];
+    }
+};
@@ -0,0 +1,78 @@
+#include "Utf16.hpp"
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define UTF16_SSE2
+#endif
+
+namespace Utf16 {
+static char* EncodeCodePoint(uint32_t codePoint, char* out) {
+    if (codePoint < 0x80) {
+        *out++ = static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+        *out++ = static_cast<char>(0xC0 | (codePoint >> 6));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+        *out++ = static_cast<char>(0xE0 | (codePoint >> 12));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+        *out++ = static_cast<char>(0xF0 | (codePoint >> 18));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        *out++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    return out;
+}
+
+size_t ToUtf8(std::u16string_view input, char* out) {
+    const char16_t* src = input.data();
+    const char16_t* end = src + input.size();
+    char* dst = out;
+
+    while (src < end) {
+#ifdef UTF16_SSE2
+        // 16 units per step while they are all ASCII: one test for any bit above 0x7F, then narrow with an unsigned pack
+        const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        while (end - src >= 16) {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+            __m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, _mm_setzero_si128())) != 0xFFFF)
+                break;
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm_packus_epi16(low, high));
+            src += 16;
+            dst += 16;
+        }
+        if (src == end)
+            break;
+#endif
+
+        uint32_t unit = *src++;
+        if (unit < 0x80) {
+            *dst++ = static_cast<char>(unit);
+            continue;
+        }
+
+        uint32_t codePoint = unit;
+        if (unit >= 0xD800 && unit <= 0xDBFF) {
+            if (src < end && *src >= 0xDC00 && *src <= 0xDFFF) {
+                codePoint = 0x10000 + ((unit - 0xD800) << 10) + (*src++ - 0xDC00);
+            } else {
+                codePoint = 0xFFFD; // High surrogate without its pair
+            }
+        } else if (unit >= 0xDC00 && unit <= 0xDFFF) {
+            codePoint = 0xFFFD; // Low surrogate without a high one before it
+        }
+        dst = EncodeCodePoint(codePoint, dst);
+    }
+
+    return static_cast<size_t>(dst - out);
+}
+
+void ToUtf8(std::u16string_view input, std::string& out) {
+    out.resize(MaxUtf8Length(input.size()));
+    out.resize(ToUtf8(input, out.data()));
+}
+} // namespace Utf16
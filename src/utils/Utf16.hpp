@@ -0,0 +1,16 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Utf16 {
+// Worst case UTF-8 size of a UTF-16 string: 3 bytes per unit, a surrogate pair takes 4 bytes for its 2 units
+constexpr size_t MaxUtf8Length(size_t utf16Length) { return utf16Length * 3; }
+
+// Transcodes input into out, which must hold at least MaxUtf8Length(input.size()) bytes, and returns the bytes written.
+// Runs of ASCII are converted 16 units at a time, unpaired surrogates become U+FFFD. No terminator is written.
+size_t ToUtf8(std::u16string_view input, char* out);
+
+// Same, replacing the contents of out and reusing its capacity (or its small-string storage for short names)
+void ToUtf8(std::u16string_view input, std::string& out);
+} // namespace Utf16
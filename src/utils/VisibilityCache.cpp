@@ -0,0 +1,128 @@
+#include "VisibilityCache.hpp"
+#include "globals/globals.hpp"
+#include "hooks/hooks.hpp"
+#include <algorithm>
+#include <cfloat>
+
+void VisibilityCache::BeginUpdate() {
+    m_frame++;
+    m_canRaycast = false;
+
+    if (!Hooks::Physics_get_defaultPhysicsScene_Injected || !Hooks::PhysicsScene_Internal_Raycast_Injected || !Hooks::Component_get_transform) {
+        return;
+    }
+
+    Camera* camera = Hooks::Camera_get_main();
+    if (!camera) {
+        return;
+    }
+
+    void* transform = Hooks::Component_get_transform(static_cast<void*>(camera));
+    if (!transform) {
+        return;
+    }
+
+    Hooks::Transform_get_position_Injected(transform, &m_cameraPosition);
+    Hooks::Physics_get_defaultPhysicsScene_Injected(&m_scene);
+
+    m_layerMask = 0;
+    if (G::worldLayer >= 0)
+        m_layerMask |= (1 << G::worldLayer);
+    if (G::ignoreRaycastLayer >= 0)
+        m_layerMask |= (1 << G::ignoreRaycastLayer);
+
+    m_canRaycast = true;
+}
+
+bool VisibilityCache::Query(const void* key, const Vector3& position, float distance, bool onScreen) {
+    if (!m_canRaycast) {
+        return true;
+    }
+
+    auto [it, inserted] = m_entries.try_emplace(key);
+    Entry& entry = it->second;
+    if (inserted) {
+        entry.visible = true;
+        entry.tested = false;
+        entry.lastTestFrame = m_frame;
+    }
+
+    entry.position = position;
+    entry.lastSeenFrame = m_frame;
+    // On-screen objects are re-tested 4x as often, and weight falls off with distance (1.0 at 0m, 0.5 at 50m)
+    entry.weight = (onScreen ? 4.0f : 1.0f) / (1.0f + distance / 50.0f);
+
+    return entry.visible;
+}
+
+bool VisibilityCache::Touch(const void* key) {
+    auto it = m_entries.find(key);
+    if (it == m_entries.end()) {
+        return true;
+    }
+
+    it->second.lastSeenFrame = m_frame;
+    return it->second.visible;
+}
+
+void VisibilityCache::EndUpdate(int raycastBudget) {
+    m_candidates.clear();
+
+    for (auto it = m_entries.begin(); it != m_entries.end();) {
+        if (it->second.lastSeenFrame != m_frame) {
+            it = m_entries.erase(it);
+            continue;
+        }
+
+        Entry& entry = it->second;
+        // Age-weighted round robin: untested objects go first, everything else ages until it wins a slot
+        float score = entry.tested ? static_cast<float>(m_frame - entry.lastTestFrame + 1) * entry.weight : FLT_MAX;
+        m_candidates.emplace_back(score, &entry);
+        ++it;
+    }
+
+    if (!m_canRaycast || m_candidates.empty() || raycastBudget <= 0) {
+        return;
+    }
+
+    size_t budget = std::min(static_cast<size_t>(raycastBudget), m_candidates.size());
+    if (budget < m_candidates.size()) {
+        std::nth_element(m_candidates.begin(), m_candidates.begin() + budget, m_candidates.end(),
+                         [](const std::pair<float, Entry*>& a, const std::pair<float, Entry*>& b) { return a.first > b.first; });
+    }
+
+    for (size_t i = 0; i < budget; i++) {
+        Entry* entry = m_candidates[i].second;
+        entry->visible = Raycast(entry->position);
+        entry->tested = true;
+        entry->lastTestFrame = m_frame;
+    }
+}
+
+bool VisibilityCache::Raycast(const Vector3& position) const {
+    Vector3 direction = position - m_cameraPosition;
+    float distance = direction.Length();
+
+    if (distance < 0.1f) {
+        return true;
+    }
+
+    direction.Normalize();
+
+    Ray_Value ray;
+    ray.m_Origin = m_cameraPosition;
+    ray.m_Direction = direction;
+
+    RaycastHit_Value hitInfo = {};
+    PhysicsScene_Value scene = m_scene;
+
+    bool hitSomething =
+        Hooks::PhysicsScene_Internal_Raycast_Injected(&scene, &ray, distance - 1.0f, &hitInfo, m_layerMask, QueryTriggerInteraction_Value::UseGlobal);
+
+    return !hitSomething;
+}
+
+void VisibilityCache::Clear() {
+    m_entries.clear();
+    m_candidates.clear();
+}
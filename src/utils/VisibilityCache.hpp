@@ -0,0 +1,48 @@
+#pragma once
+#include "Math.hpp"
+#include "game/GameStructs.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Temporal occlusion cache for ESP. Queries return the last raycast result for an object,
+// and only a budgeted slice of objects is re-tested per update (oldest and most relevant first).
+class VisibilityCache {
+  private:
+    struct Entry {
+        Vector3 position;
+        float weight;           // Higher for near / on-screen objects
+        uint32_t lastTestFrame; // Update index of the last raycast
+        uint32_t lastSeenFrame; // Update index of the last query
+        bool visible;
+        bool tested;
+    };
+
+    std::unordered_map<const void*, Entry> m_entries;
+    std::vector<std::pair<float, Entry*>> m_candidates; // Reused between updates to avoid allocations
+
+    uint32_t m_frame = 0;
+    bool m_canRaycast = false;
+    Vector3 m_cameraPosition;
+    PhysicsScene_Value m_scene = {};
+    int32_t m_layerMask = 0;
+
+    bool Raycast(const Vector3& position) const;
+
+  public:
+    // Resolves camera origin, physics scene and layer mask once for the whole update
+    void BeginUpdate();
+    // Returns the cached result for key and records its position/priority for scheduling.
+    // Objects that have never been tested report visible until their first raycast.
+    bool Query(const void* key, const Vector3& position, float distance, bool onScreen);
+    // Keeps key tracked this update without changing its position or priority, returns the cached result.
+    // Lets callers refresh an object less often than every update without losing its entry.
+    bool Touch(const void* key);
+    // Re-tests at most raycastBudget objects and drops entries that were not queried this update
+    void EndUpdate(int raycastBudget);
+
+    void Remove(const void* key) { m_entries.erase(key); }
+    void Clear();
+
+    size_t GetTrackedCount() const { return m_entries.size(); }
+};
@@ -0,0 +1,251 @@
+#include "TestCheck.hpp"
+#include "utils/CatalogCache.hpp"
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+constexpr uint64_t Key = 0x1234567890ABCDEFull;
+
+// Header offsets from CatalogCache.cpp, which rewritten payloads need to re-sign
+constexpr size_t HeaderSize = 32;
+constexpr size_t PayloadSizeOffset = 16;
+constexpr size_t PayloadHashOffset = 24;
+
+static RoR2Item MakeItem(int index, const char* name, std::vector<int32_t> tags) {
+    RoR2Item item{};
+    item.index = index;
+    item.displayName = std::string(name) + " (display)";
+    item.name = name;
+    item.nameToken = std::string("ITEM_") + name + "_NAME";
+    item.pickupToken = std::string("ITEM_") + name + "_PICKUP";
+    item.descriptionToken = std::string("ITEM_") + name + "_DESC";
+    item.loreToken = std::string("ITEM_") + name + "_LORE";
+    item.tier = static_cast<ItemTier_Value>(index % 5);
+    item.tierName = "Tier" + std::to_string(index % 5);
+    item.isDroppable = index % 2 == 0;
+    item.canScrap = index % 3 == 0;
+    item.canRestack = true;
+    item.canRemove = index % 2 == 1;
+    item.isConsumed = false;
+    item.hidden = index == 2;
+    item.tags = std::move(tags);
+    return item;
+}
+
+static CatalogSnapshot MakeSnapshot() {
+    CatalogSnapshot snapshot;
+    snapshot.itemDefCount = 3;
+    snapshot.items.push_back(MakeItem(0, "Syringe", {1, 2}));
+    snapshot.items.push_back(MakeItem(1, "Caf\xC3\xA9", {}));
+    snapshot.items.push_back(MakeItem(2, "Hidden", {3, 4, 5, 6}));
+    snapshot.specialItems = {{"Syringe", 0}, {"Hidden", 2}};
+
+    snapshot.masterCount = 2;
+    snapshot.enemies = {{0, "BeetleMaster", "Beetle"}, {1, "LemurianMaster", "Lemurian"}};
+
+    snapshot.buffCount = 40;
+    snapshot.elites = {{"Blazing", 12}, {"Overloading", 17}};
+
+    snapshot.pickupCount = 3;
+    snapshot.pickupNames = {{0, "Syringe"}, {1, ""}, {2, "Hidden"}};
+    return snapshot;
+}
+
+static bool SameItem(const RoR2Item& a, const RoR2Item& b) {
+    return a.index == b.index && a.displayName == b.displayName && a.name == b.name && a.nameToken == b.nameToken && a.pickupToken == b.pickupToken &&
+           a.descriptionToken == b.descriptionToken && a.loreToken == b.loreToken && a.tier == b.tier && a.tierName == b.tierName &&
+           a.isDroppable == b.isDroppable && a.canScrap == b.canScrap && a.canRestack == b.canRestack && a.canRemove == b.canRemove &&
+           a.isConsumed == b.isConsumed && a.hidden == b.hidden && a.tags == b.tags;
+}
+
+static bool SameSnapshot(const CatalogSnapshot& a, const CatalogSnapshot& b) {
+    if (a.itemDefCount != b.itemDefCount || a.items.size() != b.items.size())
+        return false;
+    for (size_t i = 0; i < a.items.size(); i++) {
+        if (!SameItem(a.items[i], b.items[i]))
+            return false;
+    }
+    if (a.masterCount != b.masterCount || a.enemies.size() != b.enemies.size())
+        return false;
+    for (size_t i = 0; i < a.enemies.size(); i++) {
+        const RoR2Enemy& x = a.enemies[i];
+        const RoR2Enemy& y = b.enemies[i];
+        if (x.masterIndex != y.masterIndex || x.masterName != y.masterName || x.displayName != y.displayName)
+            return false;
+    }
+    return a.specialItems == b.specialItems && a.buffCount == b.buffCount && a.elites == b.elites && a.pickupCount == b.pickupCount &&
+           a.pickupNames == b.pickupNames;
+}
+
+// Deserialize into a snapshot holding a marker, so a failed load can be checked to leave it alone
+static bool TryLoad(const std::vector<uint8_t>& file, size_t size, uint64_t key, CatalogSnapshot& out) {
+    out = CatalogSnapshot();
+    out.itemDefCount = 12345;
+    return CatalogCache::Deserialize(file.data(), size, key, out);
+}
+
+// Builds a file around a hand-written payload with a valid header, so the payload reaches the reader past the hash check
+static std::vector<uint8_t> SignedFile(const std::vector<uint8_t>& payload) {
+    std::vector<uint8_t> file = CatalogCache::Serialize(CatalogSnapshot(), Key);
+    file.resize(HeaderSize);
+    file.insert(file.end(), payload.begin(), payload.end());
+
+    uint64_t payloadSize = payload.size();
+    uint64_t payloadHash = CatalogCache::Hash(payload.data(), payload.size());
+    std::memcpy(file.data() + PayloadSizeOffset, &payloadSize, sizeof(payloadSize));
+    std::memcpy(file.data() + PayloadHashOffset, &payloadHash, sizeof(payloadHash));
+    return file;
+}
+
+template <typename T> static void Append(std::vector<uint8_t>& out, T value) {
+    size_t offset = out.size();
+    out.resize(offset + sizeof(T));
+    std::memcpy(out.data() + offset, &value, sizeof(T));
+}
+
+static void TestRoundTrip() {
+    CatalogSnapshot snapshot = MakeSnapshot();
+    std::vector<uint8_t> file = CatalogCache::Serialize(snapshot, Key);
+
+    CatalogSnapshot loaded;
+    CHECK(TryLoad(file, file.size(), Key, loaded));
+    CHECK(SameSnapshot(snapshot, loaded));
+
+    // Serializing is deterministic, so an unchanged catalog rewrites the same bytes
+    CHECK(CatalogCache::Serialize(loaded, Key) == file);
+
+    // Sections that weren't recorded survive as -1 and empty
+    CatalogSnapshot empty;
+    std::vector<uint8_t> emptyFile = CatalogCache::Serialize(empty, Key);
+    CHECK(TryLoad(emptyFile, emptyFile.size(), Key, loaded));
+    CHECK(SameSnapshot(empty, loaded));
+    CHECK(loaded.itemDefCount == -1 && loaded.pickupCount == -1);
+}
+
+static void TestWrongKey() {
+    std::vector<uint8_t> file = CatalogCache::Serialize(MakeSnapshot(), Key);
+
+    CatalogSnapshot loaded;
+    CHECK(!TryLoad(file, file.size(), Key + 1, loaded));
+    CHECK(loaded.itemDefCount == 12345);
+
+    // Magic and version are checked the same way
+    std::vector<uint8_t> badMagic = file;
+    badMagic[0] ^= 0xFF;
+    CHECK(!TryLoad(badMagic, badMagic.size(), Key, loaded));
+
+    std::vector<uint8_t> badVersion = file;
+    uint32_t version = CatalogCache::Version + 1;
+    std::memcpy(badVersion.data() + 4, &version, sizeof(version));
+    CHECK(!TryLoad(badVersion, badVersion.size(), Key, loaded));
+
+    CHECK(!CatalogCache::Deserialize(nullptr, 0, Key, loaded));
+}
+
+static void TestTruncation() {
+    std::vector<uint8_t> file = CatalogCache::Serialize(MakeSnapshot(), Key);
+
+    // Every shorter length, through the header and every field of the payload
+    size_t accepted = 0;
+    for (size_t size = 0; size < file.size(); size++) {
+        CatalogSnapshot loaded;
+        if (TryLoad(file, size, Key, loaded))
+            accepted++;
+        else
+            CHECK(loaded.itemDefCount == 12345);
+    }
+    CHECK(accepted == 0);
+
+    // Trailing bytes are rejected too
+    std::vector<uint8_t> longer = file;
+    longer.push_back(0);
+    CatalogSnapshot loaded;
+    CHECK(!TryLoad(longer, longer.size(), Key, loaded));
+}
+
+static void TestCorruptedPayload() {
+    std::vector<uint8_t> file = CatalogCache::Serialize(MakeSnapshot(), Key);
+
+    // Any flipped payload byte fails the hash
+    size_t accepted = 0;
+    for (size_t i = HeaderSize; i < file.size(); i++) {
+        std::vector<uint8_t> corrupted = file;
+        corrupted[i] ^= 0x5A;
+        CatalogSnapshot loaded;
+        if (TryLoad(corrupted, corrupted.size(), Key, loaded))
+            accepted++;
+    }
+    CHECK(accepted == 0);
+}
+
+// A count that slipped past the hash (a bug in the writer, or a file signed by a different build of the format) must be
+// bounded by the bytes left before anything is reserved, rather than reserving billions of elements and throwing
+static void TestCorruptedCounts() {
+    auto loadWithoutThrowing = [](const std::vector<uint8_t>& file) {
+        CatalogSnapshot loaded;
+        try {
+            bool ok = TryLoad(file, file.size(), Key, loaded);
+            CHECK(loaded.itemDefCount == 12345);
+            return ok;
+        } catch (const std::bad_alloc&) {
+            CHECK(!"GetCount let an oversized count through to reserve");
+        } catch (const std::length_error&) {
+            CHECK(!"GetCount let an oversized count through to reserve");
+        }
+        return true;
+    };
+
+    // Top-level item count
+    std::vector<uint8_t> items;
+    Append<int32_t>(items, 1);
+    Append<uint32_t>(items, 0xFFFFFFFF);
+    CHECK(!loadWithoutThrowing(SignedFile(items)));
+
+    // Tag count inside an otherwise valid item
+    std::vector<uint8_t> tags;
+    Append<int32_t>(tags, 1);
+    Append<uint32_t>(tags, 1);
+    Append<int32_t>(tags, 0); // index
+    for (int i = 0; i < 6; i++) {
+        Append<uint32_t>(tags, 0); // Empty strings
+    }
+    Append<int32_t>(tags, 0);  // tier
+    Append<uint32_t>(tags, 0); // tierName
+    Append<uint8_t>(tags, 0);  // flags
+    Append<uint32_t>(tags, 0x40000000);
+    CHECK(!loadWithoutThrowing(SignedFile(tags)));
+
+    // Enemy count after empty item sections, and a string length past the end
+    std::vector<uint8_t> enemies;
+    Append<int32_t>(enemies, 0);
+    Append<uint32_t>(enemies, 0);
+    Append<uint32_t>(enemies, 0);
+    Append<int32_t>(enemies, 5);
+    Append<uint32_t>(enemies, 0x7FFFFFFF);
+    CHECK(!loadWithoutThrowing(SignedFile(enemies)));
+
+    std::vector<uint8_t> longString;
+    Append<int32_t>(longString, 0);
+    Append<uint32_t>(longString, 0);
+    Append<uint32_t>(longString, 1);
+    Append<uint32_t>(longString, 0xFFFFFFF0); // Special item name length
+    CHECK(!loadWithoutThrowing(SignedFile(longString)));
+
+    // A count that fits the remaining bytes is still fine, it just runs out of records
+    std::vector<uint8_t> fits;
+    Append<int32_t>(fits, 0);
+    Append<uint32_t>(fits, 0);
+    Append<uint32_t>(fits, 2);
+    Append<uint32_t>(fits, 0);
+    Append<int32_t>(fits, 7);
+    CHECK(!loadWithoutThrowing(SignedFile(fits)));
+}
+
+int main() {
+    TestRoundTrip();
+    TestWrongKey();
+    TestTruncation();
+    TestCorruptedPayload();
+    TestCorruptedCounts();
+    return CheckResult("CatalogCache");
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdio>
+
+// Minimal checks for the host tests: a failed CHECK prints its location and is counted, main returns the count
+inline int g_checkFailures = 0;
+
+#define CHECK(condition)                                                                                                                                       \
+    do {                                                                                                                                                       \
+        if (!(condition)) {                                                                                                                                    \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);                                                                 \
+            g_checkFailures++;                                                                                                                                 \
+        }                                                                                                                                                      \
+    } while (0)
+
+inline int CheckResult(const char* suite) {
+    if (g_checkFailures == 0) {
+        std::printf("%s: all checks passed\n", suite);
+        return 0;
+    }
+    std::fprintf(stderr, "%s: %d checks failed\n", suite, g_checkFailures);
+    return 1;
+}
@@ -0,0 +1,213 @@
+#include "TestCheck.hpp"
+#include "utils/Utf16.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Behaviour change from mono_string_to_utf8, which StringToUtf8 used before: Mono's converter rejects a string containing
+// an unpaired surrogate as a whole (it returns NULL and StringToUtf8 returned ""), while Utf16::ToUtf8 replaces just the
+// unpaired unit with U+FFFD (EF BF BD) and keeps the rest of the text. Valid UTF-16 converts to the same bytes either way.
+
+// One unit at a time with the same replacement rule, the reference the SSE2 path is checked and timed against
+static std::string ReferenceToUtf8(std::u16string_view input) {
+    std::string out;
+    for (size_t i = 0; i < input.size(); i++) {
+        uint32_t codePoint = input[i];
+        if (codePoint >= 0xD800 && codePoint <= 0xDBFF) {
+            if (i + 1 < input.size() && input[i + 1] >= 0xDC00 && input[i + 1] <= 0xDFFF) {
+                codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (input[i + 1] - 0xDC00);
+                i++;
+            } else {
+                codePoint = 0xFFFD;
+            }
+        } else if (codePoint >= 0xDC00 && codePoint <= 0xDFFF) {
+            codePoint = 0xFFFD;
+        }
+
+        if (codePoint < 0x80) {
+            out += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codePoint >> 6));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codePoint >> 12));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (codePoint >> 18));
+            out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+    return out;
+}
+
+static std::string Convert(std::u16string_view input) {
+    std::string out;
+    Utf16::ToUtf8(input, out);
+    return out;
+}
+
+static std::u16string AsciiRun(size_t length) {
+    std::u16string text;
+    for (size_t i = 0; i < length; i++) {
+        text += static_cast<char16_t>(u'a' + i % 26);
+    }
+    return text;
+}
+
+static void TestAsciiRuns() {
+    // Shorter than, exactly and longer than one 16-unit SSE2 block, plus multiples and the scalar tail after them
+    for (size_t length : {0, 1, 7, 15, 16, 17, 31, 32, 33, 47, 48, 100}) {
+        std::u16string text = AsciiRun(length);
+        std::string expected(text.begin(), text.end());
+        CHECK(Convert(text) == expected);
+
+        // The raw overload writes exactly the returned bytes and nothing past them
+        std::vector<char> buffer(Utf16::MaxUtf8Length(length) + 1, '#');
+        size_t written = Utf16::ToUtf8(text, buffer.data());
+        CHECK(written == length);
+        CHECK(std::memcmp(buffer.data(), expected.data(), length) == 0);
+        CHECK(buffer[written] == '#');
+    }
+
+    // DEL is still ASCII, the block test must only reject units above 0x7F
+    CHECK(Convert(std::u16string(20, u'\x7F')) == std::string(20, '\x7F'));
+}
+
+static void TestNonAsciiInsideBlocks() {
+    // A single non-ASCII unit at every position of a 40-unit run, so it lands in the first block, the second and the tail
+    for (size_t position = 0; position < 40; position++) {
+        std::u16string text = AsciiRun(40);
+        text[position] = u'\u00E9';
+        CHECK(Convert(text) == ReferenceToUtf8(text));
+    }
+}
+
+static void TestBmp() {
+    CHECK(Convert(u"\u00E9") == "\xC3\xA9");                                             // Two bytes
+    CHECK(Convert(u"\u07FF\u0800") == "\xDF\xBF\xE0\xA0\x80");                           // Two and three byte boundary
+    CHECK(Convert(u"\u20AC") == "\xE2\x82\xAC");                                         // Three bytes
+    CHECK(Convert(u"\uFFFF") == "\xEF\xBF\xBF");                                         // Last BMP code point
+    CHECK(Convert(u"Caf\u00E9 \u65E5\u672C") == "Caf\xC3\xA9 \xE6\x97\xA5\xE6\x9C\xAC"); // Mixed with ASCII
+}
+
+static void TestAstral() {
+    CHECK(Convert(u"\U0001F600") == "\xF0\x9F\x98\x80");
+    CHECK(Convert(u"\U00010000") == "\xF0\x90\x80\x80");
+    CHECK(Convert(u"\U0010FFFF") == "\xF4\x8F\xBF\xBF");
+
+    // Pairs straddling the end of an ASCII block
+    std::u16string text = AsciiRun(15) + u"\U0001F600" + AsciiRun(16);
+    CHECK(Convert(text) == ReferenceToUtf8(text));
+    CHECK(Convert(text).size() == 15 + 4 + 16);
+}
+
+static void TestLoneSurrogates() {
+    const std::string replacement = "\xEF\xBF\xBD";
+
+    std::u16string loneHigh = u"a";
+    loneHigh += static_cast<char16_t>(0xD83D);
+    CHECK(Convert(loneHigh) == "a" + replacement); // High surrogate at the end
+
+    std::u16string highThenAscii;
+    highThenAscii += static_cast<char16_t>(0xD83D);
+    highThenAscii += u"b";
+    CHECK(Convert(highThenAscii) == replacement + "b"); // The unit after an unpaired high surrogate is kept
+
+    std::u16string loneLow = u"a";
+    loneLow += static_cast<char16_t>(0xDE00);
+    loneLow += u"b";
+    CHECK(Convert(loneLow) == "a" + replacement + "b");
+
+    std::u16string highHighLow;
+    highHighLow += static_cast<char16_t>(0xD83D);
+    highHighLow += static_cast<char16_t>(0xD83D);
+    highHighLow += static_cast<char16_t>(0xDE00);
+    CHECK(Convert(highHighLow) == replacement + "\xF0\x9F\x98\x80"); // Only the second high surrogate pairs
+
+    std::u16string lowHigh;
+    lowHigh += static_cast<char16_t>(0xDE00);
+    lowHigh += static_cast<char16_t>(0xD83D);
+    CHECK(Convert(lowHigh) == replacement + replacement); // Reversed pair
+
+    // Worst case output still fits MaxUtf8Length
+    std::u16string allLow(32, static_cast<char16_t>(0xDC00));
+    CHECK(Convert(allLow).size() == 32 * 3);
+    CHECK(Convert(allLow).size() <= Utf16::MaxUtf8Length(allLow.size()));
+}
+
+static void TestStringReuse() {
+    std::string out = "previous contents that are longer";
+    Utf16::ToUtf8(u"short", out);
+    CHECK(out == "short");
+
+    out.reserve(256);
+    const char* storage = out.data();
+    Utf16::ToUtf8(AsciiRun(64), out);
+    CHECK(out.size() == 64);
+    CHECK(out.data() == storage); // Capacity is reused
+}
+
+// Token and display-name shaped input: mostly short ASCII, some longer descriptions and a share of non-ASCII text
+static std::vector<std::u16string> BenchmarkCorpus() {
+    std::vector<std::u16string> corpus;
+    for (size_t i = 0; i < 4096; i++) {
+        std::u16string text = AsciiRun(8 + (i * 37) % 120);
+        if (i % 8 == 0)
+            text += u" \u00E9\u65E5\U0001F600";
+        corpus.push_back(std::move(text));
+    }
+    return corpus;
+}
+
+template <typename ConvertFn> static double TimeNsPerUnit(const std::vector<std::u16string>& corpus, size_t totalUnits, int rounds, ConvertFn convert) {
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; round++) {
+        for (const std::u16string& text : corpus) {
+            convert(text);
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    return ns / (static_cast<double>(totalUnits) * rounds);
+}
+
+static void RunBenchmark() {
+    std::vector<std::u16string> corpus = BenchmarkCorpus();
+    size_t totalUnits = 0;
+    for (const std::u16string& text : corpus) {
+        totalUnits += text.size();
+        CHECK(Convert(text) == ReferenceToUtf8(text));
+    }
+
+    constexpr int Rounds = 200;
+    std::string out;
+    size_t sink = 0;
+    double reference = TimeNsPerUnit(corpus, totalUnits, Rounds, [&](const std::u16string& text) { sink += ReferenceToUtf8(text).size(); });
+    double transcoder = TimeNsPerUnit(corpus, totalUnits, Rounds, [&](const std::u16string& text) {
+        Utf16::ToUtf8(text, out);
+        sink += out.size();
+    });
+
+    std::printf("Utf16 benchmark: %zu strings, %zu units, %d rounds (sink %zu)\n", corpus.size(), totalUnits, Rounds, sink);
+    std::printf("  scalar reference: %.3f ns/unit\n", reference);
+    std::printf("  Utf16::ToUtf8:    %.3f ns/unit (%.2fx)\n", transcoder, reference / transcoder);
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) {
+        RunBenchmark();
+        return CheckResult("Utf16 benchmark");
+    }
+
+    TestAsciiRuns();
+    TestNonAsciiInsideBlocks();
+    TestBmp();
+    TestAstral();
+    TestLoneSurrogates();
+    TestStringReuse();
+    return CheckResult("Utf16");
+}